@@ -4,12 +4,12 @@
 #include "MarioCharacter.h"
 #include "MarioCapProjectile.h"
 #include "Capture/CaptureComponent.h"
+#include "Capture/PlayerTargetSubsystem.h"
 #include "Camera/CameraComponent.h"
 #include "GameFramework/SpringArmComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/PlayerController.h"
 #include "Camera/PlayerCameraManager.h"
-#include "TimerManager.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/BoxComponent.h"
 #include "EnhancedInputComponent.h"
@@ -18,10 +18,18 @@
 #include "Animation/AnimInstance.h"
 #include "Components/SkeletalMeshComponent.h"
 
-#include "Capture/CapturableInterface.h"
+#include "Capture/CaptureCapability.h"
 #include "Kismet/GameplayStatics.h"
 #include "Progress/MarioGameInstance.h"
+#include "Dev/MarioBenchTimings.h"
+#include "World/DeterministicSimSubsystem.h"
+#include "World/LedgeEdgeSubsystem.h"
+#include "World/IceTileGridSubsystem.h"
+#include "MarioOdyssey/MarioOdysseyStats.h"
+#include "MarioSceneQuery.h"
 
+// 벽 슬라이드/킥 상태 전환 추적(기본 비활성: log LogMarioWall Verbose 로 켬)
+DEFINE_LOG_CATEGORY_STATIC(LogMarioWall, Log, All);
 
 AMarioCharacter::AMarioCharacter()
 {
@@ -58,17 +66,14 @@ AMarioCharacter::AMarioCharacter()
 	FollowCamera->SetupAttachment(SpringArm);
 	FollowCamera->bUsePawnControlRotation = false;
 	
-	//wall, ledge 디텍터 컴포넌트 생성, 조절
-	WallDetector = CreateDefaultSubobject<UBoxComponent>(TEXT("WallDetector"));
-	WallDetector->SetupAttachment(GetCapsuleComponent());
-	WallDetector->SetBoxExtent(FVector(5.f, 30.f, 45.f));
-	WallDetector->SetRelativeLocation(FVector(40.f, 0.f, -5.f));
-	WallDetector->SetCanEverAffectNavigation(false);
-
+	//ledge 디텍터 컴포넌트 생성, 조절(벽은 이동 스윕 결과를 재사용하므로 디텍터 없음)
+	// 손 위치/높이 창 기준으로만 쓰므로 오버랩 생성 안 함(모서리는 캐시 격자에서 조회)
 	LedgeDetector = CreateDefaultSubobject<UBoxComponent>(TEXT("LedgeDetector"));
 	LedgeDetector->SetupAttachment(GetCapsuleComponent());
 	LedgeDetector->SetBoxExtent(FVector(10.f, 45.f, 25.f));
 	LedgeDetector->SetRelativeLocation(FVector(45.f, 0.f, 55.f));
+	LedgeDetector->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	LedgeDetector->SetGenerateOverlapEvents(false);
 	LedgeDetector->SetCanEverAffectNavigation(false);
 	
 	//웅크리기
@@ -96,61 +101,18 @@ void AMarioCharacter::OnCaptureBegin()
 	}
 
 	// HitStun 정리(캡쳐 시작 시 스턴 잔여물 제거)
-	if (UWorld* World = GetWorld())
-	{
-		World->GetTimerManager().ClearTimer(HitStunTimer);
-	}
 	bInputLocked = false;
 	bHitStun = false;
 	
-	//Roll 정리
-	if (bIsRolling)
-	{
-		AbortRoll(true);
-	}
-	
-	//Dive 정리
-	EndDive();
-	
-	//GroundPound, 반동점프 정리
-	if (UWorld* World = GetWorld())
-	{
-		World->GetTimerManager().ClearTimer(GroundPoundPrepareTimer);
-		World->GetTimerManager().ClearTimer(GroundPoundStunTimer);
-	}
-	bIsGroundPoundPreparing = false;
-	bIsGroundPounding = false;
-	bGroundPoundStunned = false;
-	bIsPoundJumping = false;
-	bGroundPoundUsed = false;
-	EndPoundJumpWindow();
-	State.GroundPound = EGroundPoundPhase::None;
-	
-	//Wall action 정리
-	if (UWorld* World = GetWorld())
-	{
-		World->GetTimerManager().ClearTimer(WallSlideStartToLoopTimer);
-		World->GetTimerManager().ClearTimer(WallKickStateTimer);
-		World->GetTimerManager().ClearTimer(WallKickInputLockTimer);
-		World->GetTimerManager().ClearTimer(WallEndOverlapGraceTimer);
-	}
+	//Roll/Dive/GroundPound/Wall 정리: 각 상태 Exit 훅이 이동값을 원복하고, 상태별 타이머는 State와 함께 사라짐
+	ResetMoveState();
 	bWallOverlapping = false;
-	bWallKickInputLocked = false;
 	WallKickStartTime = -1000.f;
-	if (WallActionState != EWallActionState::None)
-	{
-		ResetWallSlide();
-	}
-	else
-	{
-		CurrentWallNormal = FVector::ZeroVector;
-	}
+	CurrentWallNormal = FVector::ZeroVector;
 	
-	//점프, 특수 점프 정리
+	//점프 정리
 	JumpStage = 0;
 	LastLandedTime = -1.f;
-	bIsLongJumping = false;
-	bIsBackflipping = false;
 	
 	//슬로프 부스트 정리
 	bIsDownhillBoosting = false;
@@ -170,9 +132,6 @@ void AMarioCharacter::OnCaptureBegin()
 	}
 	bAnimIsCrouched = false;
 	
-	//State 컨테이너 정리
-	State = FMarioState{};
-	
 	//물리, 이동 원복
 	if (UCharacterMovementComponent* MoveComp = GetCharacterMovement())
 	{
@@ -186,6 +145,7 @@ void AMarioCharacter::OnCaptureBegin()
 		MoveComp->BrakingDecelerationWalking = DefaultBrakingDecelWalking;
 		MoveComp->BrakingFrictionFactor = DefaultBrakingFrictionFactor;
 	}
+	bOnIceFloor = false; // 마찰을 기본값으로 되돌렸으므로 다음 틱에 얼음 여부 다시 판정
 	PostCaptureInvulnEndTime = -1.f;
 	ApplyMoveSpeed();
 }
@@ -193,36 +153,13 @@ void AMarioCharacter::OnCaptureBegin()
 void AMarioCharacter::OnCaptureEnd()
 {
 	// HitStun 정리(언캡쳐 직후 스턴/입력락 잔여물 제거)
-	if (UWorld* World = GetWorld())
-	{
-		World->GetTimerManager().ClearTimer(HitStunTimer);
-	}
 	bInputLocked = false;
 	bHitStun = false;
 
 	//언캡쳐 후, 마리오 조작 가능 상태 복귀
-	if (bIsRolling) AbortRoll(true);
-	EndDive();
-	if (WallActionState != EWallActionState::None) ResetWallSlide();
-	
-	if (UWorld* World = GetWorld())
-	{
-		World->GetTimerManager().ClearTimer(GroundPoundPrepareTimer);
-		World->GetTimerManager().ClearTimer(GroundPoundStunTimer);
-		World->GetTimerManager().ClearTimer(WallKickStateTimer);
-		World->GetTimerManager().ClearTimer(WallKickInputLockTimer);
-		World->GetTimerManager().ClearTimer(WallEndOverlapGraceTimer);
-		World->GetTimerManager().ClearTimer(RollPhaseTimer);
-	}
-	bIsGroundPoundPreparing = false;
-	bIsGroundPounding = false;
-	bGroundPoundStunned = false;
-	bIsPoundJumping = false;
-	EndPoundJumpWindow();
-	State.GroundPound = EGroundPoundPhase::None;
+	ResetMoveState();
 	
 	bWallOverlapping = false;
-	bWallKickInputLocked = false;
 	WallKickStartTime = -1000.f;
 	
 	bIsRunning = false;
@@ -237,8 +174,6 @@ void AMarioCharacter::OnCaptureEnd()
 	
 	JumpStage = 0;
 	LastLandedTime = -1.f;
-	bIsLongJumping = false;
-	bIsBackflipping = false;
 	
 	bIsDownhillBoosting = false;
 	DownhillBoostAlpha = 0.f;
@@ -246,8 +181,6 @@ void AMarioCharacter::OnCaptureEnd()
 	
 	CachedMoveInput = FVector2D::ZeroVector;
 	
-	State = FMarioState{};
-	
 	//카메라 보간 타겟 컨트롤 로데이션 맞추기
 	if (Controller)
 	{
@@ -265,6 +198,7 @@ void AMarioCharacter::OnCaptureEnd()
 		MoveComp->BrakingDecelerationWalking = DefaultBrakingDecelWalking;
 		MoveComp->BrakingFrictionFactor = DefaultBrakingFrictionFactor;
 	}
+	bOnIceFloor = false; // 마찰을 기본값으로 되돌렸으므로 다음 틱에 얼음 여부 다시 판정
 	
 	if (UWorld* World = GetWorld())
 	{
@@ -289,6 +223,17 @@ bool AMarioCharacter::IsPostCaptureInvulnActive() const
 void AMarioCharacter::BeginPlay()
 {
 	Super::BeginPlay();
+
+	// AI들이 매 틱 플레이어를 다시 찾지 않도록 레지스트리에 등록
+	if (UPlayerTargetSubsystem* Targets = UPlayerTargetSubsystem::Get(this))
+	{
+		Targets->RegisterMario(this);
+	}
+
+	UDeterministicSimSubsystem::ApplyToMovement(GetCharacterMovement());
+
+	// 모자는 여기서 1회만 스폰(던질 때 스폰하지 않음)
+	EnsureCapActor();
 	
 	CurrentHP = MaxHP;
 	InitHPFromGameInstance();
@@ -358,18 +303,15 @@ void AMarioCharacter::BeginPlay()
 
 				if (bLockUntilFadeOut)
 				{
-					if (UWorld* World = GetWorld())
+					const float Wait = FMath::Max(0.f, FadeOutSeconds);
+					if (Wait <= KINDA_SMALL_NUMBER)
+					{
+						Timeline.Cancel(ETimelineTag::TravelFadeUnlock);
+						EndTravelFadeUnlock();
+					}
+					else
 					{
-						World->GetTimerManager().ClearTimer(TravelFadeUnlockTimer);
-						const float Wait = FMath::Max(0.f, FadeOutSeconds);
-						if (Wait <= KINDA_SMALL_NUMBER)
-						{
-							EndTravelFadeUnlock();
-						}
-						else
-						{
-							World->GetTimerManager().SetTimer(TravelFadeUnlockTimer, this, &AMarioCharacter::EndTravelFadeUnlock, Wait, false);
-						}
+						Timeline.Schedule(ETimelineTag::TravelFadeUnlock, Wait, &AMarioCharacter::EndTravelFadeUnlock);
 					}
 				}
 			}
@@ -388,26 +330,30 @@ void AMarioCharacter::BeginPlay()
 		DefaultBrakingFrictionFactor = MoveComp->BrakingFrictionFactor;
 	}
 	
-	// wall, ledge 디텍터 델리게이트 바인딩
-	if (WallDetector)
+	// 몬스터 접촉(블로킹) 데미지/넉백: Capsule Hit로 처리
+	if (UCapsuleComponent* Capsule = GetCapsuleComponent())
 	{
-		WallDetector->OnComponentBeginOverlap.AddDynamic(this, &AMarioCharacter::OnWallDetectorBeginOverlap);
-		WallDetector->OnComponentEndOverlap.AddDynamic(this, &AMarioCharacter::OnWallDetectorEndOverlap);
+		Capsule->OnComponentHit.AddDynamic(this, &AMarioCharacter::OnMarioCapsuleHit);
 	}
 
-	if (LedgeDetector)
+
+}
+
+void AMarioCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UPlayerTargetSubsystem* Targets = UPlayerTargetSubsystem::Get(this))
 	{
-		LedgeDetector->OnComponentBeginOverlap.AddDynamic(this, &AMarioCharacter::OnLedgeDetectorBeginOverlap);
-		LedgeDetector->OnComponentEndOverlap.AddDynamic(this, &AMarioCharacter::OnLedgeDetectorEndOverlap);
+		Targets->UnregisterMario(this);
 	}
 
-	// 몬스터 접촉(블로킹) 데미지/넉백: Capsule Hit로 처리
-	if (UCapsuleComponent* Capsule = GetCapsuleComponent())
+	if (CapActor)
 	{
-		Capsule->OnComponentHit.AddDynamic(this, &AMarioCharacter::OnMarioCapsuleHit);
+		CapActor->OnRetired.Unbind();
+		CapActor->Destroy();
+		CapActor = nullptr;
 	}
 
-
+	Super::EndPlay(EndPlayReason);
 }
 
 void AMarioCharacter::InitHPFromGameInstance()
@@ -491,46 +437,27 @@ bool AMarioCharacter::TeleportToCheckpoint(bool bResetVelocity)
 void AMarioCharacter::Landed(const FHitResult& Hit)
 {
 	Super::Landed(Hit);
-	EndDive();
-	//엉덩방아
-	if (bIsGroundPounding)
-	{
-		bIsGroundPounding = false;
-		bGroundPoundStunned = true;
-		bWaitingForPoundJump = true;
-		bPoundJumpConsumed = false;
-		State.GroundPound = EGroundPoundPhase::Stunned;
-		State.bPoundJumpWindowOpen = true;
-		State.bPoundJumpConsumed = false;
-		JumpStage = 0;
-		GetCharacterMovement()->SetMovementMode(MOVE_Walking);
-		
+	//엉덩방아 착지 -> 경직(반동 점프 창 열림)
+	if (State.MoveState == EMarioMoveState::GroundPound)
+	{
 		//TODO: 착지 애니메이션 / 충격파
-		
-		GetWorld()->GetTimerManager().SetTimer(
-			GroundPoundStunTimer, this, &AMarioCharacter::EndGroundPoundStun,
-			GroundPoundStunTime, false);
+		ChangeMoveState(EMarioMoveState::GroundPoundStun);
 	}
 	else
 	{
-		bGroundPoundUsed = false;
+		State.bGroundPoundUsed = false;
 		EndPoundJumpWindow();
-	}
-	
-	if (bIsGroundPoundPreparing) // preparing 상태에서 착지가 되버릴시 이동 영구 막힘 방지
-	{
-		bIsGroundPoundPreparing = false;
-		bGroundPoundUsed = false;
 
-		GetWorld()->GetTimerManager().ClearTimer(GroundPoundPrepareTimer);
-
-		if (UCharacterMovementComponent* MoveComp = GetCharacterMovement())
+		// 공중기/벽/공중제비(preparing) 상태는 착지로 종료
+		// (preparing 상태에서 착지가 되버릴시 이동 영구 막힘 방지: Exit 훅이 중력 원복)
+		const EMarioStateGroup Group = GetMoveStateGroup();
+		if (Group == EMarioStateGroup::Air || Group == EMarioStateGroup::Wall
+			|| State.MoveState == EMarioMoveState::GroundPoundPrepare)
 		{
-			MoveComp->GravityScale = DefaultGravityScale;
+			ChangeMoveState(EMarioMoveState::None);
 		}
-
-		State.GroundPound = EGroundPoundPhase::None;
 	}
+	State.AirOrigin = EMarioAirAction::None;
 	
 	LastLandedTime = GetWorld()->GetTimeSeconds(); // 마지막 착지 시간 불러오기
 	
@@ -538,260 +465,79 @@ void AMarioCharacter::Landed(const FHitResult& Hit)
 	{
 		JumpStage = 0;
 	}
-	
-	bIsLongJumping = false;
-	bIsBackflipping = false;
-	bIsPoundJumping = false;
-	GetWorld()->GetTimerManager().ClearTimer(WallKickStateTimer);
 
-	// 착지하면 Wall 관련은 무조건 Reset 함수로 정리
-	if (WallActionState != EWallActionState::None)
-	{
-		ResetWallSlide(); // 여기서 bOrientRotationToMovement 원복
-	}
-	else
+	// 혹시라도 false로 남아있으면 착지 시 강제 원복
+	if (UCharacterMovementComponent* MoveComp = GetCharacterMovement())
 	{
-		// 혹시라도 false로 남아있으면 착지 시 강제 원복
-		if (UCharacterMovementComponent* MoveComp = GetCharacterMovement())
-		{
-			MoveComp->bOrientRotationToMovement = bDefaultOrientRotationToMovement;
-		}
+		MoveComp->bOrientRotationToMovement = bDefaultOrientRotationToMovement;
 	}
 
-	GetWorld()->GetTimerManager().ClearTimer(WallKickInputLockTimer);
 	EndWallKickInputLock();
 	
 	ApplyMoveSpeed();
+	RefreshAnimState();
 }
 
-///디텍터 오버랩 콜백
-void AMarioCharacter::OnWallDetectorBeginOverlap(UPrimitiveComponent* OverlappedComp, AActor* OtherActor,
-	UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+void AMarioCharacter::Tick(float DeltaTime)
 {
-	if (!OtherActor || OtherActor == this) return;
-	bWallOverlapping = true;
-
-	// EndOverlap 유예 타이머가 걸려있었다면, 다시 닿은 순간 취소
-	if (GetWorld())
-	{
-		GetWorld()->GetTimerManager().ClearTimer(WallEndOverlapGraceTimer);
-	}
-
-	// 이미 슬라이드 상태면 StartWallSlide를 다시 호출하지 않음(타이머/회전 리셋 방지)
-	if (WallActionState == EWallActionState::SlideStart || WallActionState == EWallActionState::SlideLoop)
-	{
-		return;
-	}
-
-	UCharacterMovementComponent* MoveComp = GetCharacterMovement();
-	if (!MoveComp)
-	{
-		return;
-	}
-
-	// “벽에 지상에서 닿은 상태 → 점프/낙하로 Falling 전환”은 BeginOverlap이 1번만 오고 끝나는 경우가 있음.
-	// 그래서 Falling이 아니면 바로 버리지 말고 NextTick에 1회 시도(성공하면 Slide 진입, 아니면 그냥 return)
-	if (!MoveComp->IsFalling())
-	{
-		if (WallActionState == EWallActionState::None && GetWorld())
-		{
-			GetWorld()->GetTimerManager().SetTimerForNextTick(this, &AMarioCharacter::TryEnterWallSlideFromCurrentOverlap);
-		}
-		return;
-	}
+	MARIO_SCOPE_CYCLE(STAT_MarioOdyssey_MarioTick);
+	FMarioBenchScope BenchTickScope(BenchTimings ? &BenchTimings->TickCycles : nullptr);
 
+	Super::Tick(DeltaTime);
 
-	const float Now = GetWorld()->GetTimeSeconds();
-	const bool bRecentlyWallKicked = (Now - WallKickStartTime) <= WallKickSlideReenterWindow;
-	const bool bFromWallKick = (WallActionState == EWallActionState::WallKick) || bRecentlyWallKicked;
-
-	// WallKick(또는 직후)면 연속 벽차기를 위해 Slide 진입 허용
-	// 단, Kick 직후 즉시 같은 벽 재포획만 아주 짧게 방지
-	if (bFromWallKick)
-	{
-		if ((Now - WallKickStartTime) < WallKickMinReenterDelay)
-		{
-			return;
-		}
-	}
-	else
-	{
-		// WallKick이 아닌 경우는 기존처럼 None 상태에서만 진입 허용
-		if (WallActionState != EWallActionState::None)
-		{
-			return;
-		}
-
-		if (!IsWallActionCandidate())
-		{
-			return;
-		}
-	}
+	// 사망 연출/페이드 예약
+	Timeline.Tick(this, DeltaTime);
 
-	// 보조로 법선/정면/수직벽 판정
-	FHitResult WallHit;
-	if (!TryGetWallHitFromDetector(SweepResult, WallHit))
-	{
-		return;
-	}
+	// 상태 타이머/전이 + 상태별 Tick(롤 조향, 벽 슬라이드 물리)
+	TickMoveState(DeltaTime);
 
-	if (!PassesWallFilters(WallHit))
+	if (!IsRolling())
 	{
-		return;
-	}
+		FMarioBenchScope BenchScope(BenchTimings ? &BenchTimings->DownhillBoostCycles : nullptr);
+		UpdateDownhillBoost(DeltaTime);
 
-	// 실제로 WallKick 상태/입력락이 남아있다면 정리 후 Slide로 전환
-	if (WallActionState == EWallActionState::WallKick || bWallKickInputLocked)
-	{
-		CancelWallKickForSlideEntry();
+		// 롤은 자체 마찰값을 쓰고 종료 시 진입 전 값으로 복원하므로 롤 중에는 얼음 상태를 바꾸지 않는다
+		UpdateIceFloor();
 	}
 
-	StartWallSlide(WallHit);
+	RefreshAnimState();
 }
 
-void AMarioCharacter::OnWallDetectorEndOverlap(UPrimitiveComponent* OverlappedComp, AActor* OtherActor,
-	UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
+void AMarioCharacter::UpdateIceFloor()
 {
-	if (!OtherActor || OtherActor == this) return;
-	bWallOverlapping = false;
+	UCharacterMovementComponent* MoveComp = GetCharacterMovement();
+	if (!MoveComp) return;
 
-	// SlideStart/Loop 중 EndOverlap은 “진짜로 벽에서 떨어짐”일 수도 있고,
-	// 회전 고정/박스 얇음/프레임 미세 분리로 “순간 EndOverlap”만 나는 경우도 있음.
-	// 그래서 바로 Reset하지 말고, 짧게 유예 후 실제 벽 존재를 재검증한다.
-	if (WallActionState == EWallActionState::SlideStart || WallActionState == EWallActionState::SlideLoop)
+	bool bOnIce = false;
+	if (MoveComp->IsMovingOnGround() && MoveComp->CurrentFloor.bBlockingHit)
 	{
-		if (GetWorld())
+		if (const UIceTileGridSubsystem* Grid = UIceTileGridSubsystem::Get(this))
 		{
-			GetWorld()->GetTimerManager().ClearTimer(WallEndOverlapGraceTimer);
-			GetWorld()->GetTimerManager().SetTimer(
-				WallEndOverlapGraceTimer, this, &AMarioCharacter::ConfirmWallContactAfterEndOverlap,
-				WallEndOverlapGraceTime, false);
+			bOnIce = Grid->IsIceAt(MoveComp->CurrentFloor.HitResult.ImpactPoint);
 		}
-		return;
 	}
-}
-
-void AMarioCharacter::OnLedgeDetectorBeginOverlap(UPrimitiveComponent* OverlappedComp, AActor* OtherActor,
-	UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
-{
-	if (!OtherActor || OtherActor == this) return;
-	UE_LOG(LogTemp, Log, TEXT("[LedgeDetector] BeginOverlap: %s"), *OtherActor->GetName());
-}
-
-void AMarioCharacter::OnLedgeDetectorEndOverlap(UPrimitiveComponent* OverlappedComp, AActor* OtherActor,
-	UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
-{
-	if (!OtherActor || OtherActor == this) return;
-	UE_LOG(LogTemp, Log, TEXT("[LedgeDetector] EndOverlap: %s"), *OtherActor->GetName());
-}
-///
 
-void AMarioCharacter::Tick(float DeltaTime)
-{
-	Super::Tick(DeltaTime);
-	if (bIsRolling)
-{
-    UCharacterMovementComponent* MoveComp = GetCharacterMovement();
-    if (!MoveComp)
-    {
-        return;
-    }
+	if (bOnIce == bOnIceFloor)
+	{
+		return;
+	}
+	bOnIceFloor = bOnIce;
 
-    // 떨어지면 즉시 Abort
-    if (!MoveComp->IsMovingOnGround())
-    {
-        AbortRoll(false);
-    }
-    else
-    {
-        // 롤 중 속도 상한은 RollSpeed
-        MoveComp->MaxWalkSpeed = RollSpeed;
-    	MoveComp->MaxWalkSpeedCrouched = RollSpeed;
-        // 현재 입력 기반
-        FVector DesiredDir = RollDirection;
-
-        const FVector2D Input = CachedMoveInput;
-        const float InputMag = Input.Size();
-
-        if (Controller && InputMag > 0.1f)
-        {
-            const FRotator ControlRot = Controller->GetControlRotation();
-            const FRotator YawRot(0.f, ControlRot.Yaw, 0.f);
-
-            const FVector Forward = FRotationMatrix(YawRot).GetUnitAxis(EAxis::X);
-            const FVector Right   = FRotationMatrix(YawRot).GetUnitAxis(EAxis::Y);
-
-            DesiredDir = (Right * Input.X + Forward * Input.Y);
-            DesiredDir.Z = 0.f;
-            DesiredDir.Normalize();
-        }
-
-        // 반대 입력이면 RollEnd로 전이 
-        if (RollPhase == ERollPhase::Loop && InputMag > 0.1f)
-        {
-            const float Dot = FVector::DotProduct(RollDirection, DesiredDir);
-            if (Dot <= RollReverseCancelDot)
-            {
-                BeginRollEnd();
-            }
-        }
-
-        // 방향을 부드럽게 갱신
-        if (RollPhase != ERollPhase::End && InputMag > 0.1f)
-        {
-            RollDirection = FMath::VInterpTo(RollDirection, DesiredDir, DeltaTime, RollSteerInterpSpeed);
-            RollDirection.Z = 0.f;
-            RollDirection.Normalize();
-        }
-
-        // 캐릭터 회전도 롤 방향으로
-        SetActorRotation(RollDirection.Rotation());
-    	
-        //    StartForceTime 동안은 입력 없어도 추진, 이후엔 입력 있을 때만 추진.
-        bool bDrive = false;
-
-        if (RollPhase != ERollPhase::End)
-        {
-            if (RollStartForceInputRemaining > 0.f)
-            {
-                RollStartForceInputRemaining -= DeltaTime;
-                bDrive = true;
-            }
-            else if (InputMag > 0.1f)
-            {
-                bDrive = true;
-            }
-        }
-
-        if (bDrive)
-        {
-            AddMovementInput(RollDirection, 1.0f);
-        }
-
-        // 속도가 충분히 떨어지면 자동으로 End 진입
-        const float Speed2D = MoveComp->Velocity.Size2D();
-        if (RollPhase == ERollPhase::Loop && Speed2D <= RollEndSpeed2D)
-        {
-            BeginRollEnd();
-        }
-    }
-}
-	if (Controller) // 카메라 위치에 따른 보간(웅크리기)
+	if (bOnIce)
 	{
-		const FRotator Current = Controller->GetControlRotation();
-		const FRotator Smoothed = FMath::RInterpTo(
-			Current,
-			TargetControlRotation,
-			DeltaTime,
-			CameraRotationInterpSpeed
-		);
+		PreIceGroundFriction = MoveComp->GroundFriction;
+		PreIceBrakingDecelWalking = MoveComp->BrakingDecelerationWalking;
+		PreIceBrakingFrictionFactor = MoveComp->BrakingFrictionFactor;
 
-		Controller->SetControlRotation(Smoothed);
+		MoveComp->GroundFriction = IceGroundFriction;
+		MoveComp->BrakingDecelerationWalking = IceBrakingDecelWalking;
+		MoveComp->BrakingFrictionFactor = IceBrakingFrictionFactor;
 	}
-	if (!bIsRolling)
+	else
 	{
-		UpdateWallSlidePhysics(DeltaTime);
-		UpdateDownhillBoost(DeltaTime);
+		MoveComp->GroundFriction = PreIceGroundFriction;
+		MoveComp->BrakingDecelerationWalking = PreIceBrakingDecelWalking;
+		MoveComp->BrakingFrictionFactor = PreIceBrakingFrictionFactor;
 	}
 }
 
@@ -908,13 +654,10 @@ void AMarioCharacter::StartDeathSequence()
 	bGameOver = true;
 	bIsDead = true;
 
-	if (UWorld* World = GetWorld())
-	{
-		World->GetTimerManager().ClearTimer(HitStunTimer);
-		World->GetTimerManager().ClearTimer(DeathAnimLeadTimer);
-		World->GetTimerManager().ClearTimer(DeathFadeInTimer);
-		World->GetTimerManager().ClearTimer(DeathFadeOutTimer);
-	}
+	State.HitStunRemaining = 0.f;
+	Timeline.Cancel(ETimelineTag::DeathAnimLead);
+	Timeline.Cancel(ETimelineTag::DeathFadeIn);
+	Timeline.Cancel(ETimelineTag::DeathFadeOut);
 
 	// 캡쳐 중이라면 먼저 해제
 	if (CaptureComp && CaptureComp->IsCapturing())
@@ -946,17 +689,14 @@ void AMarioCharacter::StartDeathSequence()
 		}
 	}
 
-	if (UWorld* World = GetWorld())
+	const float Lead = FMath::Max(0.f, DeathAnimLeadSeconds);
+	if (Lead <= KINDA_SMALL_NUMBER)
 	{
-		const float Lead = FMath::Max(0.f, DeathAnimLeadSeconds);
-		if (Lead <= KINDA_SMALL_NUMBER)
-		{
-			BeginDeathFadeIn();
-		}
-		else
-		{
-			World->GetTimerManager().SetTimer(DeathAnimLeadTimer, this, &AMarioCharacter::BeginDeathFadeIn, Lead, false);
-		}
+		BeginDeathFadeIn();
+	}
+	else
+	{
+		Timeline.Schedule(ETimelineTag::DeathAnimLead, Lead, &AMarioCharacter::BeginDeathFadeIn);
 	}
 }
 
@@ -969,17 +709,14 @@ void AMarioCharacter::BeginDeathFadeIn()
 
 	ForceBlackFade(0.f, 1.f, DeathFadeInSeconds);
 
-	if (UWorld* World = GetWorld())
+	const float Wait = FMath::Max(0.f, DeathFadeInSeconds) + FMath::Max(0.f, DeathBlackHoldSeconds);
+	if (Wait <= KINDA_SMALL_NUMBER)
 	{
-		const float Wait = FMath::Max(0.f, DeathFadeInSeconds) + FMath::Max(0.f, DeathBlackHoldSeconds);
-		if (Wait <= KINDA_SMALL_NUMBER)
-		{
-			PerformRespawnFromDeath();
-		}
-		else
-		{
-			World->GetTimerManager().SetTimer(DeathFadeInTimer, this, &AMarioCharacter::PerformRespawnFromDeath, Wait, false);
-		}
+		PerformRespawnFromDeath();
+	}
+	else
+	{
+		Timeline.Schedule(ETimelineTag::DeathFadeIn, Wait, &AMarioCharacter::PerformRespawnFromDeath);
 	}
 }
 
@@ -1011,17 +748,14 @@ void AMarioCharacter::PerformRespawnFromDeath()
 
 	ForceBlackFade(1.f, 0.f, DeathFadeOutSeconds);
 
-	if (UWorld* World = GetWorld())
+	const float Wait = FMath::Max(0.f, DeathFadeOutSeconds);
+	if (Wait <= KINDA_SMALL_NUMBER)
 	{
-		const float Wait = FMath::Max(0.f, DeathFadeOutSeconds);
-		if (Wait <= KINDA_SMALL_NUMBER)
-		{
-			FinishDeathSequence();
-		}
-		else
-		{
-			World->GetTimerManager().SetTimer(DeathFadeOutTimer, this, &AMarioCharacter::FinishDeathSequence, Wait, false);
-		}
+		FinishDeathSequence();
+	}
+	else
+	{
+		Timeline.Schedule(ETimelineTag::DeathFadeOut, Wait, &AMarioCharacter::FinishDeathSequence);
 	}
 }
 
@@ -1080,47 +814,35 @@ float AMarioCharacter::TakeDamage(float DamageAmount, struct FDamageEvent const&
 	// 생존 시 피격 스턴
 	if (CurrentHP > 0.f)
 	{
-		if (bIsRolling)
+		if (IsRolling())
 		{
 			AbortRoll(true);
 		}
-		EndDive();
 
-		if (bIsGroundPoundPreparing || bIsGroundPounding)
+		// 공중제비/낙하 중이면 취소(Prepare Exit 훅이 중력 원복)
+		if (IsGroundPoundAirborne())
 		{
-			bIsGroundPoundPreparing = false;
-			bIsGroundPounding = false;
-			bGroundPoundUsed = false;
-			bGroundPoundStunned = false;
-			bWaitingForPoundJump = false;
-
-			if (UWorld* World = GetWorld())
-			{
-				World->GetTimerManager().ClearTimer(GroundPoundPrepareTimer);
-				World->GetTimerManager().ClearTimer(GroundPoundStunTimer);
-			}
+			State.bGroundPoundUsed = false;
+			ChangeMoveState(EMarioMoveState::None);
+			EndPoundJumpWindow();
 
 			if (UCharacterMovementComponent* MoveComp = GetCharacterMovement())
 			{
-				MoveComp->GravityScale = DefaultGravityScale;
 				MoveComp->SetMovementMode(MOVE_Falling);
 			}
-
-			EndPoundJumpWindow();
-			State.GroundPound = EGroundPoundPhase::None;
 		}
 
-		bIsLongJumping = false;
-		bIsBackflipping = false;
-		bIsPoundJumping = false;
-
-		if (UWorld* World = GetWorld())
+		// 다이브/롱점프/백덤블링/반동점프 종료, 매달리기는 놓침
+		const EMarioStateGroup Group = GetMoveStateGroup();
+		if (Group == EMarioStateGroup::Air || Group == EMarioStateGroup::Ledge)
 		{
-			bHitStun = true;
-			bInputLocked = true;
-			World->GetTimerManager().ClearTimer(HitStunTimer);
-			World->GetTimerManager().SetTimer(HitStunTimer, this, &AMarioCharacter::ClearHitStun, HitStunSeconds, false);
+			ChangeMoveState(EMarioMoveState::None);
 		}
+		State.AirOrigin = EMarioAirAction::None;
+
+		bHitStun = true;
+		bInputLocked = true;
+		State.HitStunRemaining = FMath::Max(HitStunSeconds, KINDA_SMALL_NUMBER);
 
 		if (UCharacterMovementComponent* MoveComp = GetCharacterMovement())
 		{
@@ -1152,7 +874,7 @@ void AMarioCharacter::OnMarioCapsuleHit(UPrimitiveComponent* HitComp, AActor* Ot
 			return;
 		}
 		// 몬스터 판정: CapturableInterface(권장) or 태그(보조)
-		const bool bIsMonster = OtherActor->GetClass()->ImplementsInterface(UCapturableInterface::StaticClass())
+		const bool bIsMonster = CaptureCapability::IsCapturableClass(OtherActor->GetClass())
 			|| OtherActor->ActorHasTag(FName(TEXT("Monster")))
 			|| OtherActor->ActorHasTag(FName(TEXT("Capturable")));
 		if (!bIsMonster)
@@ -1188,11 +910,9 @@ void AMarioCharacter::OnMarioCapsuleHit(UPrimitiveComponent* HitComp, AActor* Ot
 
 void AMarioCharacter::OnThrowCapReleased()
 {
-	if (!ActiveCap) return;
-
-	if (AMarioCapProjectile* Cap = Cast<AMarioCapProjectile>(ActiveCap))
+	if (CapActor && CapActor->IsInFlight())
 	{
-		Cap->NotifyHoldReleased();
+		CapActor->NotifyHoldReleased();
 	}
 }
 
@@ -1208,24 +928,25 @@ void AMarioCharacter::Move(const FInputActionValue& Value) // 이동
 {
 	if (bInputLocked) return; // 피격 스턴 중 이동/조작 금지
 
-	if (WallActionState == EWallActionState::SlideStart || WallActionState == EWallActionState::SlideLoop)
+	if (bWallKickInputLocked)
 	{
 		return;
 	}
-	if (bWallKickInputLocked)
+	// 매달린 동안 입력은 모서리 좌우 이동으로(TickLedgeHang에서 소비)
+	if (GetMoveStateGroup() == EMarioStateGroup::Ledge)
 	{
+		State.LedgeMoveInput = Value.Get<FVector2D>();
 		return;
 	}
-	if (!State.CanMove())
-		return;
-	if (bIsDiving)
+	// 벽 슬라이드 / 그라운드파운드 / 다이브 중 이동 금지
+	if (HasMoveStateFlag(EMarioStateFlags::BlockMove))
 	{
 		return;
 	}
 	const FVector2D Input = Value.Get<FVector2D>();
 	CachedMoveInput = Input;
 	
-	if (bIsRolling) return;
+	if (IsRolling()) return;
 	if (!Controller) return;
 	
 	const FRotator ControlRot = Controller->GetControlRotation();
@@ -1252,12 +973,22 @@ void AMarioCharacter::OnCrouchPressed(const FInputActionValue& Value)
 
 	if (!GetCharacterMovement()) return;
 
+	// 매달리기 중 웅크리기 = 놓기(Exit 훅이 Falling 복귀 + 재잡기 지연)
+	if (GetMoveStateGroup() == EMarioStateGroup::Ledge)
+	{
+		if (State.MoveState != EMarioMoveState::LedgeClimb)
+		{
+			ChangeMoveState(EMarioMoveState::None);
+		}
+		return;
+	}
+
 	const bool bOnGround = GetCharacterMovement()->IsMovingOnGround();
 
 	if (bOnGround)
 	{
 		// GroundPound 착지후에는 다이브 불가
-		if (bGroundPoundStunned || bWaitingForPoundJump)
+		if (State.MoveState == EMarioMoveState::GroundPoundStun)
 		{
 			return;
 		}
@@ -1267,7 +998,7 @@ void AMarioCharacter::OnCrouchPressed(const FInputActionValue& Value)
 	else
 	{
 		// 이미 GroundPound 진행 중(Preparing/Pounding)이라면 C 재입력 = Dive
-		if (bIsGroundPoundPreparing || bIsGroundPounding)
+		if (IsGroundPoundAirborne())
 		{
 			StartDiveFromCurrentContext();
 			return;
@@ -1282,7 +1013,7 @@ void AMarioCharacter::OnCrouchReleased(const FInputActionValue& Value)
 	// 물리적 홀드 상태는 언제든 해제 반영
 	bCrouchHeld = false;
 	
-	if (bIsRolling)
+	if (IsRolling())
 		return;
 	
 	// 지상에서 실제 웅크림 상태였다면만 해제
@@ -1298,10 +1029,8 @@ void AMarioCharacter::UpdateDownhillBoost(float DeltaSeconds)
 	UCharacterMovementComponent* MoveComp = GetCharacterMovement();
     if (!MoveComp) return;
 
-    // 특수 상태에서는 부스트 금지
-    if (bIsDiving) { ForceDisableDownhillBoost(DeltaSeconds); return; }
-    if (!State.CanMove()) { ForceDisableDownhillBoost(DeltaSeconds); return; }
-	if (bIsRolling) { ForceDisableDownhillBoost(DeltaSeconds); return; }
+    // 특수 상태(다이브/그라운드파운드/롤)에서는 부스트 금지
+    if (HasMoveStateFlag(EMarioStateFlags::NoBoost)) { ForceDisableDownhillBoost(DeltaSeconds); return; }
 	if (bIsCrouched || bCrouchHeld)
 	{
 		ForceDisableDownhillBoost(DeltaSeconds);
@@ -1325,7 +1054,7 @@ void AMarioCharacter::UpdateDownhillBoost(float DeltaSeconds)
 		MoveComp->MaxWalkSpeed = BaselineSpeed + BoostMaxAddSpeed * DownhillBoostAlpha; // 서서히 감소
 		return;
 	}
-    const FVector Vel2D(MoveComp->Velocity.X, MoveComp->Velocity.Y, 0.f);
+    const FVector2D Vel2D(MoveComp->Velocity.X, MoveComp->Velocity.Y);
     const float Speed2D = Vel2D.Size();
     if (Speed2D < MinSpeedForBoost)
     {
@@ -1340,35 +1069,16 @@ void AMarioCharacter::UpdateDownhillBoost(float DeltaSeconds)
         return;
     }
 
-    const FVector FloorNormal = Floor.HitResult.ImpactNormal.GetSafeNormal();
-    const FVector Up = FVector::UpVector;
-
-    // 경사 각도
-    const float CosAngle = FVector::DotProduct(FloorNormal, Up);
-    const float SlopeAngleDeg = FMath::RadiansToDegrees(
-        FMath::Acos(FMath::Clamp(CosAngle, -1.f, 1.f)));
-
-    const bool bSlopeEnough = (SlopeAngleDeg >= MinSlopeAngleDeg);
-
-    // 내리막 방향(중력 방향을 바닥 평면에 투영)
-    const FVector GravityDir = -Up;
-    FVector DownhillDir = GravityDir - FVector::DotProduct(GravityDir, FloorNormal) * FloorNormal;
-    if (!DownhillDir.Normalize())
-    {
-        ForceDisableDownhillBoost(DeltaSeconds);
-        return;
-    }
-
-    const FVector VelDir = Vel2D.GetSafeNormal();
-    FVector Downhill2D(DownhillDir.X, DownhillDir.Y, 0.f);
-    if (!Downhill2D.Normalize())
+    // 경사/내리막 방향은 바닥 면이 바뀔 때만 다시 계산
+    const FMarioSlopeEval& Slope = DownhillSlopeCache.Get(Floor.HitResult, MinSlopeAngleDeg);
+    if (!Slope.bHasDownhill)
     {
         ForceDisableDownhillBoost(DeltaSeconds);
         return;
     }
 
-    const float DownhillDot = FVector::DotProduct(VelDir, Downhill2D);
-	const bool bIsRunningDownhill = bIsRunning && bSlopeEnough && (DownhillDot >= DownhillDotThreshold);
+	const bool bIsRunningDownhill = bIsRunning && Slope.bSteepEnough
+		&& MarioSlope::IsMovingDownhill(Slope, Vel2D, Speed2D, DownhillDotThreshold);
 
     // 유지 시간
     if (bIsRunningDownhill)
@@ -1415,19 +1125,29 @@ void AMarioCharacter::OnJumpPressed() // 3단 점프, 반동 점프 구현
 {
 	if (bInputLocked) return; // 피격 스턴 중 점프 금지
 
-	if (bIsRolling)
+	if (IsRolling())
 	{
 		AbortRoll(true);
 	}
 	
-	if (WallActionState == EWallActionState::SlideStart || WallActionState == EWallActionState::SlideLoop)
+	if (IsWallSliding())
 	{
 		ExecuteWallKick();
 		return;
 	}
 
+	// 매달리기 중 점프 = 올라서기(ClimbEnd 끝나면 FinishLedgeClimb)
+	if (GetMoveStateGroup() == EMarioStateGroup::Ledge)
+	{
+		if (State.MoveState != EMarioMoveState::LedgeClimb)
+		{
+			ChangeMoveState(EMarioMoveState::LedgeClimb);
+		}
+		return;
+	}
+
 	// WallKick 상태 중에는 일반 점프 로직으로 들어가지 않게 방지
-	if (WallActionState == EWallActionState::WallKick)
+	if (State.MoveState == EMarioMoveState::WallKick)
 	{
 		return;
 	}
@@ -1437,40 +1157,23 @@ void AMarioCharacter::OnJumpPressed() // 3단 점프, 반동 점프 구현
 		return;
 	}
 	
-	bIsPoundJumping = false;
-	if (bIsGroundPoundPreparing || bIsGroundPounding )
+	if (IsGroundPoundAirborne())
 		return;
 	
-	if (bWaitingForPoundJump)
+	if (State.MoveState == EMarioMoveState::GroundPoundStun)
 	{
-		if (bPoundJumpConsumed)
+		// 경직 중에는 반동 점프 창이 열려 있을 때만 점프(1회, 상태가 바뀌므로 자동 소비)
+		if (!State.bPoundJumpWindowOpen)
 			return;
 
-		bPoundJumpConsumed = true;
-		bWaitingForPoundJump = false;
-		bIsPoundJumping = true;
-		bGroundPoundStunned = false;
-		bGroundPoundUsed = false;
-		
-		State.GroundPound = EGroundPoundPhase::None;
-		State.bPoundJumpWindowOpen = false;
-		State.bPoundJumpConsumed = true;
-		
-		GetWorld()->GetTimerManager().ClearTimer(GroundPoundStunTimer);
+		ChangeMoveState(EMarioMoveState::PoundJump);
 
 		LaunchCharacter(FVector(0.f, 0.f, PoundJumpZVelocity), true, true);
-		GetWorld()->GetTimerManager().SetTimerForNextTick(this, &AMarioCharacter::TryEnterWallSlideFromCurrentOverlap);
 		return;
 	}
 	
-	if (bGroundPoundStunned)
-		return;
-	
-	TryCrouchDerivedJump();
-	
-	if (bIsLongJumping || bIsBackflipping)
+	if (TryCrouchDerivedJump())
 	{
-		GetWorld()->GetTimerManager().SetTimerForNextTick(this, &AMarioCharacter::TryEnterWallSlideFromCurrentOverlap);
 		return;
 	}
 	const float CurrentTime = GetWorld()->GetTimeSeconds();
@@ -1502,7 +1205,6 @@ void AMarioCharacter::OnJumpPressed() // 3단 점프, 반동 점프 구현
 	}
 	
 	Jump();
-	GetWorld()->GetTimerManager().SetTimerForNextTick(this, &AMarioCharacter::TryEnterWallSlideFromCurrentOverlap);
 }
 
 void AMarioCharacter::OnRunPressed()
@@ -1520,7 +1222,7 @@ void AMarioCharacter::OnRunPressed()
 
 void AMarioCharacter::OnRunReleased()
 {
-	if (bIsRolling)
+	if (IsRolling())
 		return;
 	bIsRunning = false;
 	ApplyMoveSpeed();
@@ -1531,37 +1233,30 @@ void AMarioCharacter::OnGroundPoundPressed()
 {
 	if (bInputLocked) return; // 피격 스턴 중 엉덩방아 금지
 
-	if (bIsRolling) return;
+	if (IsRolling()) return;
 	if (GetCharacterMovement()->IsMovingOnGround())
 	{
 		return;
 	}
-	if (bIsLongJumping)
+	if (State.AirOrigin == EMarioAirAction::LongJump)
 	{
 		return;
 	}
 	if (!GetCharacterMovement()->IsFalling()) //공중 일때 가능
 		return;
 	
-	if (bGroundPoundUsed) // 이미 사용했다면 무시
+	if (State.bGroundPoundUsed) // 이미 사용했다면 무시
 		return;
 	
-	bGroundPoundUsed = true;
-	bIsGroundPoundPreparing = true;
-	State.GroundPound = EGroundPoundPhase::Preparing;
+	State.bGroundPoundUsed = true;
 	
 	// GroundPound 시작 시점의 “바라보던 방향” 저장(캐릭터 기반)
 	
 	StoredPoundFacingDir = GetActorForwardVector().GetSafeNormal();
 	bHasStoredPoundFacingDir = true;
 	
-	
-	GetCharacterMovement()->StopMovementImmediately();
-	GetCharacterMovement()->GravityScale = 0.f;
-	GetCharacterMovement()->SetMovementMode(MOVE_Falling);
-	//TODO  :  공중제비 애니메이션 재생
-	
-	GetWorld()->GetTimerManager().SetTimer(GroundPoundPrepareTimer, this, &AMarioCharacter::StartGroundPound, GroundPoundPrepareTime, false);
+	// 공중제비 -> (GroundPoundPrepareTime 경과) -> 낙하는 상태 테이블이 진행
+	ChangeMoveState(EMarioMoveState::GroundPoundPrepare);
 }
 
 void AMarioCharacter::BeginCrouchHold()
@@ -1592,17 +1287,17 @@ void AMarioCharacter::EndCrouchHold()
 	ApplyMoveSpeed();
 }
 
-void AMarioCharacter::TryCrouchDerivedJump()
+bool AMarioCharacter::TryCrouchDerivedJump()
 {
-	if (!GetCharacterMovement()) return;
+	if (!GetCharacterMovement()) return false;
 
 	// 지상에서만
 	if (!GetCharacterMovement()->IsMovingOnGround())
-		return;
+		return false;
 
 	// 웅크리기 의도(홀드 또는 실제 crouched)
 	if (!(bIsCrouched || bCrouchHeld))
-		return;
+		return false;
 
 	const float Speed2D = FMath::Max(CrouchStartSpeed2D, GetVelocity().Size2D());
 
@@ -1610,6 +1305,7 @@ void AMarioCharacter::TryCrouchDerivedJump()
 	else DoBackflip();
 	
 	CrouchStartSpeed2D = 0.f;
+	return true;
 }
 
 void AMarioCharacter::DoLongJump()
@@ -1620,8 +1316,7 @@ void AMarioCharacter::DoLongJump()
 		UnCrouch();
 	}
 
-	bIsLongJumping = true;
-	bIsBackflipping = false;
+	ChangeMoveState(EMarioMoveState::LongJump);
 
 	// 3단 점프 체인 끊기(롱점프는 별도 기술)
 	JumpStage = 0;
@@ -1640,8 +1335,7 @@ void AMarioCharacter::DoBackflip()
 		UnCrouch();
 	}
 
-	bIsBackflipping = true;
-	bIsLongJumping = false;
+	ChangeMoveState(EMarioMoveState::Backflip);
 
 	JumpStage = 0;
 	LastLandedTime = 0.f;
@@ -1659,11 +1353,11 @@ void AMarioCharacter::StartDiveFromCurrentContext()
 	UCharacterMovementComponent* MoveComp = GetCharacterMovement();
 	if (!MoveComp) return;
 	
-	if (bGroundPoundStunned || bWaitingForPoundJump) // 스턴, 반동중에는 다이브 금지
+	if (State.MoveState == EMarioMoveState::GroundPoundStun) // 스턴, 반동중에는 다이브 금지
 		return;
 	
 	// 이미 다이브 중이면 무시
-	if (bIsDiving) return;
+	if (State.MoveState == EMarioMoveState::Dive) return;
 
 	// 사용할 방향 결정(저장된 방향 우선)
 	FVector DiveDir = bHasStoredPoundFacingDir ? StoredPoundFacingDir : GetActorForwardVector();
@@ -1673,25 +1367,12 @@ void AMarioCharacter::StartDiveFromCurrentContext()
 		DiveDir = GetActorForwardVector().GetSafeNormal();
 	}
 
-	// GroundPound 관련 상태 강제 종료
-	bIsGroundPoundPreparing = false;
-	bIsGroundPounding = false;
-	bGroundPoundStunned = false;
-
 	// 반동점프 창도 닫기
 	EndPoundJumpWindow();
-	bWaitingForPoundJump = false;
 
-	// 타이머 정리
-	GetWorld()->GetTimerManager().ClearTimer(GroundPoundPrepareTimer);
-	GetWorld()->GetTimerManager().ClearTimer(GroundPoundStunTimer);
+	// GroundPound 관련 상태 강제 종료 + Dive 상태 on
+	ChangeMoveState(EMarioMoveState::Dive);
 
-	// State 동기화
-	State.GroundPound = EGroundPoundPhase::None;
-	State.AirAction = EMarioAirAction::Dive;
-
-	// Dive 상태 on
-	bIsDiving = true;
 	//점프 연계 초기화
 	JumpStage = 0;
 	LastLandedTime = 0.f;
@@ -1717,16 +1398,13 @@ void AMarioCharacter::StartDiveFromCurrentContext()
 
 void AMarioCharacter::EndDive()
 {
-	if (!bIsDiving) return;
-
-	bIsDiving = false;
+	if (State.MoveState != EMarioMoveState::Dive) return;
 
-	// State 정리
-	if (State.AirAction == EMarioAirAction::Dive)
-	{
-		State.AirAction = EMarioAirAction::None;
-	}
+	ChangeMoveState(EMarioMoveState::None);
+}
 
+void AMarioCharacter::ExitDive(EMarioMoveState NextState)
+{
 	// 이동/회전 원복
 	if (UCharacterMovementComponent* MoveComp = GetCharacterMovement())
 	{
@@ -1741,11 +1419,10 @@ void AMarioCharacter::ThrowCap()
 {
 	if (bInputLocked) return; // 피격 스턴 중 모자 던지기 금지
 
-	if (ActiveCap) return;
-	if (!CapProjectileClass) return;
+	if (CapActor && CapActor->IsInFlight()) return;
 
-	UWorld* World = GetWorld();
-	if (!World) return;
+	AMarioCapProjectile* Cap = EnsureCapActor();
+	if (!Cap) return;
 
 	// 던지기 애니
 	const bool bInAir = GetCharacterMovement() && GetCharacterMovement()->IsFalling();
@@ -1762,43 +1439,47 @@ void AMarioCharacter::ThrowCap()
 		+ GetActorRightVector() * CapSpawnOffset.Y
 		+ FVector(0.f, 0.f, CapSpawnOffset.Z);
 
-	const FRotator SpawnRot = GetActorRotation();
+	Cap->Launch(SpawnLoc, GetActorRotation(), GetActorForwardVector(), CapThrowSpeed);
+}
+
+AMarioCapProjectile* AMarioCharacter::EnsureCapActor()
+{
+	if (CapActor) return CapActor;
+	if (!CapProjectileClass) return nullptr;
+
+	UWorld* World = GetWorld();
+	if (!World) return nullptr;
 
 	FActorSpawnParameters Params;
 	Params.Owner = this;
 	Params.Instigator = this;
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
 
-	AMarioCapProjectile* Cap = World->SpawnActor<AMarioCapProjectile>(CapProjectileClass, SpawnLoc, SpawnRot, Params);
-	if (!Cap) return;
-
-	ActiveCap = Cap;
-	Cap->OnDestroyed.AddDynamic(this, &AMarioCharacter::OnCapDestroyed);
-
-	const FVector Dir = GetActorForwardVector();
-	Cap->FireInDirection(Dir, CapThrowSpeed);
+	// 스폰 직후 BeginPlay에서 숨김/비활성 상태가 된다
+	CapActor = World->SpawnActor<AMarioCapProjectile>(CapProjectileClass, GetActorLocation(), GetActorRotation(), Params);
+	if (CapActor)
+	{
+		CapActor->OnRetired.BindUObject(this, &AMarioCharacter::OnCapRetired);
+	}
+	return CapActor;
 }
 
-void AMarioCharacter::OnCapDestroyed(AActor* DestroyedActor)
+void AMarioCharacter::OnCapRetired(ECapRetireReason Reason)
 {
-	if (DestroyedActor && DestroyedActor == ActiveCap)
+	if (Reason == ECapRetireReason::Captured || (CaptureComp && CaptureComp->IsCapturing()))
 	{
-		ActiveCap = nullptr;
-		
-		if (CaptureComp && CaptureComp->IsCapturing())
-		{
-			return;
-		}
-		
-		// 잡는 애니
-		const bool bInAir = GetCharacterMovement() && GetCharacterMovement()->IsFalling();
-		if (bInAir)
-		{
-			if (Montage_CatchCap_Air) PlayAnimMontage(Montage_CatchCap_Air);
-		}
-		else
-		{
-			if (Montage_CatchCap_Ground) PlayAnimMontage(Montage_CatchCap_Ground);
-		}
+		return;
+	}
+
+	// 잡는 애니
+	const bool bInAir = GetCharacterMovement() && GetCharacterMovement()->IsFalling();
+	if (bInAir)
+	{
+		if (Montage_CatchCap_Air) PlayAnimMontage(Montage_CatchCap_Air);
+	}
+	else
+	{
+		if (Montage_CatchCap_Ground) PlayAnimMontage(Montage_CatchCap_Ground);
 	}
 }
 
@@ -1809,20 +1490,13 @@ bool AMarioCharacter::CanStartRoll() const
 
 	if (bInputLocked) return false; // 피격 스턴 중 롤 시작 금지
 
-	if (bIsRolling) return false;
 	if (!MoveComp->IsMovingOnGround()) return false;
 
 	// 웅크리기 상태에서만
 	if (!bIsCrouched) return false;
 
-	// 특수 상태에서는 금지
-	if (!State.CanMove()) return false; // GroundPound Preparing/Pounding/Stunned 포함
-	if (bIsDiving) return false;
-	if (bIsLongJumping || bIsBackflipping || bIsPoundJumping) return false;
-	if (bIsGroundPoundPreparing || bIsGroundPounding) return false;
-	if (bGroundPoundStunned || bWaitingForPoundJump) return false;
-
-	return true;
+	// 특수 상태(롤/공중기/그라운드파운드/벽)에서는 금지
+	return State.MoveState == EMarioMoveState::None;
 }
 
 FVector AMarioCharacter::ComputeRollDirection() const
@@ -1841,8 +1515,6 @@ FVector AMarioCharacter::ComputeRollDirection() const
 
 void AMarioCharacter::StartRoll()
 {
-	bIsRolling = true;
-	RollPhase = ERollPhase::Start;
 	RollStartForceInputRemaining = RollStartForceInputTime;
 
 	// 달리기 플래그는 롤이 소비
@@ -1851,13 +1523,19 @@ void AMarioCharacter::StartRoll()
 	// 방향 초기화(입력 없으면 전방)
 	RollDirection = ComputeRollDirection();
 
+	// Start -> Loop -> End 전이는 상태 테이블(RollStartDuration/RollLoopDuration/RollEndDuration)
+	ChangeMoveState(EMarioMoveState::RollStart);
+}
+
+void AMarioCharacter::EnterRollGroup(EMarioMoveState PrevState)
+{
 	if (UCharacterMovementComponent* Move = GetCharacterMovement())
 	{
-		// 롤용 세팅
+		// 롤용 세팅. 얼음 위라면 현재 값은 얼음 보정값이므로 얼음 진입 전 기본값을 저장
 		DefaultMaxAcceleration = Move->MaxAcceleration;
-		DefaultGroundFriction = Move->GroundFriction;
-		DefaultBrakingDecelWalking = Move->BrakingDecelerationWalking;
-		DefaultBrakingFrictionFactor = Move->BrakingFrictionFactor;
+		DefaultGroundFriction = bOnIceFloor ? PreIceGroundFriction : Move->GroundFriction;
+		DefaultBrakingDecelWalking = bOnIceFloor ? PreIceBrakingDecelWalking : Move->BrakingDecelerationWalking;
+		DefaultBrakingFrictionFactor = bOnIceFloor ? PreIceBrakingFrictionFactor : Move->BrakingFrictionFactor;
 		bDefaultOrientRotationToMovement = Move->bOrientRotationToMovement;
 
 		Move->bOrientRotationToMovement = false;
@@ -1869,66 +1547,165 @@ void AMarioCharacter::StartRoll()
 		Move->BrakingDecelerationWalking = RollBrakingDecel;
 		Move->BrakingFrictionFactor = 0.5f;
 	}
-
-	// Start -> Loop 타이머(혹은 AnimNotify로 대체 가능)
-	GetWorldTimerManager().ClearTimer(RollPhaseTimer);
-	GetWorldTimerManager().SetTimer(RollPhaseTimer, this, &AMarioCharacter::EnterRollLoop, RollStartDuration, false);
 }
 
-void AMarioCharacter::EnterRollLoop()
+void AMarioCharacter::TickRoll(float DeltaTime)
 {
-	if (!bIsRolling) return;
+	UCharacterMovementComponent* MoveComp = GetCharacterMovement();
+	if (!MoveComp)
+	{
+		return;
+	}
+
+	// 떨어지면 즉시 Abort
+	if (!MoveComp->IsMovingOnGround())
+	{
+		AbortRoll(false);
+		return;
+	}
 
-	RollPhase = ERollPhase::Loop;
+	// 롤 중 속도 상한은 RollSpeed
+	MoveComp->MaxWalkSpeed = RollSpeed;
+	MoveComp->MaxWalkSpeedCrouched = RollSpeed;
+	// 현재 입력 기반
+	FVector DesiredDir = RollDirection;
 
-	GetWorld()->GetTimerManager().ClearTimer(RollPhaseTimer);
+	const FVector2D Input = CachedMoveInput;
+	const float InputMag = Input.Size();
 
-	if (RollLoopDuration <= 0.f)
+	if (Controller && InputMag > 0.1f)
 	{
-		return;
+		const FRotator ControlRot = Controller->GetControlRotation();
+		const FRotator YawRot(0.f, ControlRot.Yaw, 0.f);
+
+		const FVector Forward = FRotationMatrix(YawRot).GetUnitAxis(EAxis::X);
+		const FVector Right   = FRotationMatrix(YawRot).GetUnitAxis(EAxis::Y);
+
+		DesiredDir = (Right * Input.X + Forward * Input.Y);
+		DesiredDir.Z = 0.f;
+		DesiredDir.Normalize();
 	}
 
-	GetWorld()->GetTimerManager().SetTimer(
-		RollPhaseTimer,
-		this,
-		&AMarioCharacter::BeginRollEnd,
-		RollLoopDuration,
-		false
-	);
+	// 반대 입력이면 RollEnd로 전이 
+	if (State.MoveState == EMarioMoveState::RollLoop && InputMag > 0.1f)
+	{
+		const float Dot = FVector::DotProduct(RollDirection, DesiredDir);
+		if (Dot <= RollReverseCancelDot)
+		{
+			BeginRollEnd();
+		}
+	}
+
+	// 방향을 부드럽게 갱신
+	if (State.MoveState != EMarioMoveState::RollEnd && InputMag > 0.1f)
+	{
+		RollDirection = FMath::VInterpTo(RollDirection, DesiredDir, DeltaTime, RollSteerInterpSpeed);
+		RollDirection.Z = 0.f;
+		RollDirection.Normalize();
+	}
+
+	// 캐릭터 회전도 롤 방향으로
+	SetActorRotation(RollDirection.Rotation());
+	
+	//    StartForceTime 동안은 입력 없어도 추진, 이후엔 입력 있을 때만 추진.
+	bool bDrive = false;
+
+	if (State.MoveState != EMarioMoveState::RollEnd)
+	{
+		if (RollStartForceInputRemaining > 0.f)
+		{
+			RollStartForceInputRemaining -= DeltaTime;
+			bDrive = true;
+		}
+		else if (InputMag > 0.1f)
+		{
+			bDrive = true;
+		}
+	}
+
+	if (bDrive)
+	{
+		AddMovementInput(RollDirection, 1.0f);
+	}
+
+	// 속도가 충분히 떨어지면 자동으로 End 진입
+	const float Speed2D = MoveComp->Velocity.Size2D();
+	if (State.MoveState == EMarioMoveState::RollLoop && Speed2D <= RollEndSpeed2D)
+	{
+		BeginRollEnd();
+	}
 }
 
 void AMarioCharacter::BeginRollEnd()
 {
-	if (!bIsRolling) return;
-
-	RollPhase = ERollPhase::End;
+	if (!IsRolling()) return;
 
-	GetWorld()->GetTimerManager().ClearTimer(RollPhaseTimer);
-	GetWorld()->GetTimerManager().SetTimer(
-		RollPhaseTimer,
-		this,
-		&AMarioCharacter::FinishRoll,
-		RollEndDuration,
-		false
-	);
+	ChangeMoveState(EMarioMoveState::RollEnd);
 }
 
 void AMarioCharacter::FinishRoll()
 {
-	EndRollInternal(true);
+	AbortRoll(true);
 }
 
 void AMarioCharacter::AbortRoll(bool bForceStandUp)
 {
-	EndRollInternal(bForceStandUp);
+	if (!IsRolling()) return;
+
+	// 점프 캔슬 같은 경우엔 백점블링으로 새지 않게 강제로 스탠딩 처리
+	if (bForceStandUp)
+	{
+		bCrouchHeld = false;
+	}
+
+	ChangeMoveState(EMarioMoveState::None);
 }
 
-void AMarioCharacter::StartGroundPound()
+void AMarioCharacter::ExitRollGroup(EMarioMoveState NextState)
+{
+	RollStartForceInputRemaining = 0.f;
+
+	if (UCharacterMovementComponent* Move = GetCharacterMovement())
+	{
+		Move->bOrientRotationToMovement = bDefaultOrientRotationToMovement;
+		Move->MaxAcceleration = DefaultMaxAcceleration;
+		Move->GroundFriction = DefaultGroundFriction;
+		Move->BrakingDecelerationWalking = DefaultBrakingDecelWalking;
+		Move->BrakingFrictionFactor = DefaultBrakingFrictionFactor;
+	}
+	bOnIceFloor = false; // 기본 마찰로 되돌렸으므로 다음 틱에 얼음 여부 다시 판정(얼음 위면 다시 적용)
+
+	// 롤 종료 후 C를 누르고 있지 않다면 일어남
+	if (!bCrouchHeld && bIsCrouched)
+	{
+		UnCrouch();
+	}
+
+	ApplyMoveSpeed();
+}
+
+void AMarioCharacter::EnterGroundPoundPrepare(EMarioMoveState PrevState)
+{
+	UCharacterMovementComponent* MoveComp = GetCharacterMovement();
+	if (!MoveComp) return;
+
+	MoveComp->StopMovementImmediately();
+	MoveComp->GravityScale = 0.f;
+	MoveComp->SetMovementMode(MOVE_Falling);
+	//TODO  :  공중제비 애니메이션 재생
+}
+
+void AMarioCharacter::ExitGroundPoundPrepare(EMarioMoveState NextState)
+{
+	// Prepare에서 0으로 만들었던 중력 복구(낙하/다이브/착지/피격 공통)
+	if (UCharacterMovementComponent* MoveComp = GetCharacterMovement())
+	{
+		MoveComp->GravityScale = DefaultGravityScale;
+	}
+}
+
+void AMarioCharacter::EnterGroundPound(EMarioMoveState PrevState)
 {
-	bIsGroundPoundPreparing = false;
-	bIsGroundPounding = true;
-	State.GroundPound = EGroundPoundPhase::Pounding;
-	
 	//다시 낙하 상태
 	GetCharacterMovement()->SetMovementMode(MOVE_Falling);
 	GetCharacterMovement()->GravityScale = DefaultGravityScale;
@@ -1938,55 +1715,397 @@ void AMarioCharacter::StartGroundPound()
 	LaunchCharacter(FVector(0.f, 0.f, -GroundPoundForce),true, true);
 }
 
-void AMarioCharacter::EndGroundPoundStun()
+void AMarioCharacter::EnterGroundPoundStun(EMarioMoveState PrevState)
+{
+	State.bPoundJumpWindowOpen = true;
+	JumpStage = 0;
+	GetCharacterMovement()->SetMovementMode(MOVE_Walking);
+}
+
+void AMarioCharacter::ExitGroundPoundStun(EMarioMoveState NextState)
 {
-	bGroundPoundStunned = false;
 	EndPoundJumpWindow();
-	bGroundPoundUsed = false;
-	State.GroundPound = EGroundPoundPhase::None;
+	State.bGroundPoundUsed = false;
 }
 
 void AMarioCharacter::EndPoundJumpWindow()
 {
-	bWaitingForPoundJump = false;
-	bPoundJumpConsumed = false;
 	State.bPoundJumpWindowOpen = false;
-	State.bPoundJumpConsumed = false;
 }
 
-void AMarioCharacter::EndRollInternal(bool bForceStandUp)
+void AMarioCharacter::EnterAirGroup(EMarioMoveState PrevState)
 {
-	if (!bIsRolling) return;
+	// 착지 전까지 유지되는 공중기 출처(벽 슬라이드 후보 판정/AnimBP용)
+	switch (State.MoveState)
+	{
+	case EMarioMoveState::LongJump:  State.AirOrigin = EMarioAirAction::LongJump; break;
+	case EMarioMoveState::Backflip:  State.AirOrigin = EMarioAirAction::Backflip; break;
+	case EMarioMoveState::PoundJump: State.AirOrigin = EMarioAirAction::PoundJump; break;
+	case EMarioMoveState::Dive:      State.AirOrigin = EMarioAirAction::Dive; break;
+	default: break;
+	}
+}
+// move state machine
+namespace
+{
+	// 수직 벽 판정: Normal과 Up의 각도 70~110도  <=>  |Normal.Z| <= cos70
+	constexpr float WallMaxAbsNormalZ = 0.342f;
 
-	bIsRolling = false;
-	RollPhase = ERollPhase::None;
-	RollStartForceInputRemaining = 0.f;
+	// 모서리 윗면 판정: 약 45도 이하 경사만 디딜 수 있는 면으로 인정
+	constexpr float LedgeMinTopNormalZ = 0.7f;
 
-	GetWorldTimerManager().ClearTimer(RollPhaseTimer);
+	// 0 이하면 꺼진 카운트다운. 이번 틱에 0에 도달했으면 true
+	bool ConsumeCountdown(float& Remaining, float DeltaSeconds)
+	{
+		if (Remaining <= 0.f)
+		{
+			return false;
+		}
+		Remaining -= DeltaSeconds;
+		if (Remaining > 0.f)
+		{
+			return false;
+		}
+		Remaining = 0.f;
+		return true;
+	}
+}
 
-	if (UCharacterMovementComponent* Move = GetCharacterMovement())
+const AMarioCharacter::FMoveStateDesc& AMarioCharacter::GetMoveStateDesc(EMarioMoveState InState)
+{
+	static const TStaticArray<FMoveStateDesc, (int32)EMarioMoveState::Count> Table = []()
 	{
-		Move->bOrientRotationToMovement = bDefaultOrientRotationToMovement;
-		Move->MaxAcceleration = DefaultMaxAcceleration;
-		Move->GroundFriction = DefaultGroundFriction;
-		Move->BrakingDecelerationWalking = DefaultBrakingDecelWalking;
-		Move->BrakingFrictionFactor = DefaultBrakingFrictionFactor;
+		TStaticArray<FMoveStateDesc, (int32)EMarioMoveState::Count> T(InPlace);
+
+		auto Row = [&T](EMarioMoveState InRowState) -> FMoveStateDesc& { return T[(int32)InRowState]; };
+
+		// 구르기: Start -> Loop -> End -> None
+		{
+			FMoveStateDesc& D = Row(EMarioMoveState::RollStart);
+			D.Group = EMarioStateGroup::Roll;
+			D.Flags = EMarioStateFlags::NoBoost;
+			D.Duration = &AMarioCharacter::RollStartDuration;
+			D.NextOnTimeout = EMarioMoveState::RollLoop;
+			D.OnTick = &AMarioCharacter::TickRoll;
+		}
+		{
+			FMoveStateDesc& D = Row(EMarioMoveState::RollLoop);
+			D.Group = EMarioStateGroup::Roll;
+			D.Flags = EMarioStateFlags::NoBoost;
+			D.Duration = &AMarioCharacter::RollLoopDuration; // 0이면 반대입력/감속으로만 End
+			D.NextOnTimeout = EMarioMoveState::RollEnd;
+			D.OnTick = &AMarioCharacter::TickRoll;
+		}
+		{
+			FMoveStateDesc& D = Row(EMarioMoveState::RollEnd);
+			D.Group = EMarioStateGroup::Roll;
+			D.Flags = EMarioStateFlags::NoBoost;
+			D.Duration = &AMarioCharacter::RollEndDuration;
+			D.OnTimeout = &AMarioCharacter::FinishRoll;
+			D.OnTick = &AMarioCharacter::TickRoll;
+		}
+
+		// 공중기: 착지(Landed)까지 유지
+		Row(EMarioMoveState::LongJump).Group = EMarioStateGroup::Air;
+		Row(EMarioMoveState::Backflip).Group = EMarioStateGroup::Air;
+		Row(EMarioMoveState::PoundJump).Group = EMarioStateGroup::Air;
+		{
+			FMoveStateDesc& D = Row(EMarioMoveState::Dive);
+			D.Group = EMarioStateGroup::Air;
+			D.Flags = EMarioStateFlags::BlockMove | EMarioStateFlags::NoBoost;
+			D.OnExit = &AMarioCharacter::ExitDive;
+		}
+
+		// 엉덩방아: Prepare -> Pound -> (착지) Stun -> None
+		{
+			FMoveStateDesc& D = Row(EMarioMoveState::GroundPoundPrepare);
+			D.Group = EMarioStateGroup::GroundPound;
+			D.Flags = EMarioStateFlags::BlockMove | EMarioStateFlags::NoBoost;
+			D.Duration = &AMarioCharacter::GroundPoundPrepareTime;
+			D.NextOnTimeout = EMarioMoveState::GroundPound;
+			D.OnEnter = &AMarioCharacter::EnterGroundPoundPrepare;
+			D.OnExit = &AMarioCharacter::ExitGroundPoundPrepare;
+		}
+		{
+			FMoveStateDesc& D = Row(EMarioMoveState::GroundPound);
+			D.Group = EMarioStateGroup::GroundPound;
+			D.Flags = EMarioStateFlags::BlockMove | EMarioStateFlags::NoBoost;
+			D.OnEnter = &AMarioCharacter::EnterGroundPound;
+		}
+		{
+			FMoveStateDesc& D = Row(EMarioMoveState::GroundPoundStun);
+			D.Group = EMarioStateGroup::GroundPound;
+			D.Flags = EMarioStateFlags::BlockMove | EMarioStateFlags::NoBoost;
+			D.Duration = &AMarioCharacter::GroundPoundStunTime;
+			D.NextOnTimeout = EMarioMoveState::None;
+			D.OnEnter = &AMarioCharacter::EnterGroundPoundStun;
+			D.OnExit = &AMarioCharacter::ExitGroundPoundStun;
+		}
+
+		// 벽: SlideStart -> SlideLoop, Kick은 WallKickStateDuration 뒤 None
+		{
+			FMoveStateDesc& D = Row(EMarioMoveState::WallSlideStart);
+			D.Group = EMarioStateGroup::Wall;
+			D.Flags = EMarioStateFlags::BlockMove;
+			D.Duration = &AMarioCharacter::WallSlideStartDuration;
+			D.NextOnTimeout = EMarioMoveState::WallSlideLoop;
+			D.OnEnter = &AMarioCharacter::EnterWallSlideStart;
+			D.OnExit = &AMarioCharacter::ExitWallSlide;
+			D.OnTick = &AMarioCharacter::TickWallSlide;
+		}
+		{
+			FMoveStateDesc& D = Row(EMarioMoveState::WallSlideLoop);
+			D.Group = EMarioStateGroup::Wall;
+			D.Flags = EMarioStateFlags::BlockMove;
+			D.OnEnter = &AMarioCharacter::EnterWallSlideLoop;
+			D.OnExit = &AMarioCharacter::ExitWallSlide;
+			D.OnTick = &AMarioCharacter::TickWallSlide;
+		}
+		{
+			FMoveStateDesc& D = Row(EMarioMoveState::WallKick);
+			D.Group = EMarioStateGroup::Wall;
+			D.Duration = &AMarioCharacter::WallKickStateDuration;
+			D.NextOnTimeout = EMarioMoveState::None;
+		}
+
+		// 매달리기: HangStart -> Hang(좌우 이동) -> (점프) Climb -> 윗면
+		{
+			FMoveStateDesc& D = Row(EMarioMoveState::LedgeHangStart);
+			D.Group = EMarioStateGroup::Ledge;
+			D.Flags = EMarioStateFlags::BlockMove | EMarioStateFlags::NoBoost;
+			D.Duration = &AMarioCharacter::LedgeHangStartDuration;
+			D.NextOnTimeout = EMarioMoveState::LedgeHang;
+		}
+		{
+			FMoveStateDesc& D = Row(EMarioMoveState::LedgeHang);
+			D.Group = EMarioStateGroup::Ledge;
+			D.Flags = EMarioStateFlags::BlockMove | EMarioStateFlags::NoBoost;
+			D.OnTick = &AMarioCharacter::TickLedgeHang;
+		}
+		{
+			FMoveStateDesc& D = Row(EMarioMoveState::LedgeClimb);
+			D.Group = EMarioStateGroup::Ledge;
+			D.Flags = EMarioStateFlags::BlockMove | EMarioStateFlags::NoBoost;
+			D.Duration = &AMarioCharacter::LedgeClimbDuration;
+			D.OnTimeout = &AMarioCharacter::FinishLedgeClimb;
+		}
+		return T;
+	}();
+
+	return Table[(int32)InState];
+}
+
+const AMarioCharacter::FMoveGroupDesc& AMarioCharacter::GetMoveGroupDesc(EMarioStateGroup InGroup)
+{
+	static const TStaticArray<FMoveGroupDesc, (int32)EMarioStateGroup::Count> Table = []()
+	{
+		TStaticArray<FMoveGroupDesc, (int32)EMarioStateGroup::Count> T(InPlace);
+
+		T[(int32)EMarioStateGroup::Roll].OnEnter = &AMarioCharacter::EnterRollGroup;
+		T[(int32)EMarioStateGroup::Roll].OnExit = &AMarioCharacter::ExitRollGroup;
+		T[(int32)EMarioStateGroup::Air].OnEnter = &AMarioCharacter::EnterAirGroup;
+		T[(int32)EMarioStateGroup::Wall].OnEnter = &AMarioCharacter::EnterWallGroup;
+		T[(int32)EMarioStateGroup::Wall].OnExit = &AMarioCharacter::ExitWallGroup;
+		T[(int32)EMarioStateGroup::Ledge].OnEnter = &AMarioCharacter::EnterLedgeGroup;
+		T[(int32)EMarioStateGroup::Ledge].OnExit = &AMarioCharacter::ExitLedgeGroup;
+		return T;
+	}();
+
+	return Table[(int32)InGroup];
+}
+
+void AMarioCharacter::ChangeMoveState(EMarioMoveState NewState)
+{
+	const EMarioMoveState PrevState = State.MoveState;
+	const FMoveStateDesc& PrevDesc = GetMoveStateDesc(PrevState);
+	const FMoveStateDesc& NewDesc = GetMoveStateDesc(NewState);
+
+	// 훅 안에서 State.MoveState를 읽어도 새 상태가 보이도록 먼저 갱신
+	State.MoveState = NewState;
+	State.StateElapsed = 0.f;
+
+	if (PrevDesc.OnExit)
+	{
+		(this->*PrevDesc.OnExit)(NewState);
 	}
 
-	// 점프 캔슬 같은 경우엔 백점블링으로 새지 않게 강제로 스탠딩 처리
-	if (bForceStandUp)
+	if (PrevDesc.Group != NewDesc.Group)
+	{
+		const FMoveGroupDesc& PrevGroup = GetMoveGroupDesc(PrevDesc.Group);
+		if (PrevGroup.OnExit)
+		{
+			(this->*PrevGroup.OnExit)(NewState);
+		}
+
+		const FMoveGroupDesc& NewGroup = GetMoveGroupDesc(NewDesc.Group);
+		if (NewGroup.OnEnter)
+		{
+			(this->*NewGroup.OnEnter)(PrevState);
+		}
+	}
+
+	if (NewDesc.OnEnter)
+	{
+		(this->*NewDesc.OnEnter)(PrevState);
+	}
+
+	RefreshAnimState();
+}
+
+void AMarioCharacter::ResetMoveState()
+{
+	// 캡쳐 전환 등에서 롤이 끊기면 웅크리기 홀드도 같이 해제
+	if (IsRolling())
 	{
 		bCrouchHeld = false;
 	}
 
-	// 롤 종료 후 C를 누르고 있지 않다면 일어남
-	if (!bCrouchHeld && bIsCrouched)
+	// Exit 훅으로 이동값 원복 후 잔여 카운트다운/예약 전부 폐기
+	ChangeMoveState(EMarioMoveState::None);
+	EndWallKickInputLock();
+	State = FMarioState{};
+	WallContactTime = -1.f;
+
+	RefreshAnimState();
+}
+
+void AMarioCharacter::TickMoveState(float DeltaSeconds)
+{
+	// 상태와 독립적인 카운트다운(기존 FTimerHandle 대체)
+	if (ConsumeCountdown(State.HitStunRemaining, DeltaSeconds))
 	{
-		UnCrouch();
+		ClearHitStun();
+	}
+	if (ConsumeCountdown(State.WallKickLockRemaining, DeltaSeconds))
+	{
+		EndWallKickInputLock();
 	}
 
-	ApplyMoveSpeed();
+	// 직전 이동 스윕의 벽 접촉으로 슬라이드 진입/유지 판정
+	UpdateWallContact();
+
+	// 낙하 중 모서리 잡기(캐시 격자 조회 + 확인 트레이스 1회)
+	UpdateLedgeGrab();
+
+	const EMarioMoveState TickedState = State.MoveState;
+	const FMoveStateDesc& Desc = GetMoveStateDesc(TickedState);
+	State.StateElapsed += DeltaSeconds;
+
+	const float Duration = Desc.Duration ? this->*Desc.Duration : 0.f;
+	if (Duration > 0.f && State.StateElapsed >= Duration)
+	{
+		if (Desc.OnTimeout)
+		{
+			(this->*Desc.OnTimeout)();
+		}
+		else
+		{
+			ChangeMoveState(Desc.NextOnTimeout);
+		}
+	}
+
+	// 타임아웃으로 바뀌었으면 새 상태 Tick은 다음 프레임부터
+	if (State.MoveState == TickedState && Desc.OnTick)
+	{
+		(this->*Desc.OnTick)(DeltaSeconds);
+	}
 }
+
+void AMarioCharacter::RefreshAnimState()
+{
+	const EMarioMoveState MoveState = State.MoveState;
+	const EMarioStateGroup Group = GetMoveStateGroup();
+
+	int32 Word = 0;
+	Word |= ((int32)MoveState & MarioAnimWord::MoveStateMask) << MarioAnimWord::MoveStateShift;
+	Word |= ((int32)Group & MarioAnimWord::NibbleMask) << MarioAnimWord::GroupShift;
+	Word |= ((int32)State.AirOrigin & MarioAnimWord::NibbleMask) << MarioAnimWord::AirOriginShift;
+	Word |= (FMath::Clamp(JumpStage, 0, 3) & MarioAnimWord::JumpStageMask) << MarioAnimWord::JumpStageShift;
+
+	auto SetFlag = [&Word](EMarioAnimFlag Flag, bool bOn)
+	{
+		if (bOn)
+		{
+			Word |= 1 << (MarioAnimWord::FlagShift + (int32)Flag);
+		}
+	};
+	SetFlag(EMarioAnimFlag::Crouched, bAnimIsCrouched);
+	SetFlag(EMarioAnimFlag::Running, bIsRunning);
+	SetFlag(EMarioAnimFlag::DownhillBoosting, bIsDownhillBoosting);
+	SetFlag(EMarioAnimFlag::HitStun, bHitStun);
+	SetFlag(EMarioAnimFlag::Dead, bIsDead);
+	SetFlag(EMarioAnimFlag::PoundJumpWindow, State.bPoundJumpWindowOpen);
+	SetFlag(EMarioAnimFlag::WallOverlapping, bWallOverlapping);
+	AnimStateWord = Word;
+
+	// 기존 AnimBP 에셋용 미러(게임플레이 코드는 읽지 않음)
+	bIsRolling = Group == EMarioStateGroup::Roll;
+	switch (MoveState)
+	{
+	case EMarioMoveState::RollStart: RollPhase = ERollPhase::Start; break;
+	case EMarioMoveState::RollLoop:  RollPhase = ERollPhase::Loop; break;
+	case EMarioMoveState::RollEnd:   RollPhase = ERollPhase::End; break;
+	default:                         RollPhase = ERollPhase::None; break;
+	}
+
+	bIsLongJumping = State.AirOrigin == EMarioAirAction::LongJump;
+	bIsBackflipping = State.AirOrigin == EMarioAirAction::Backflip;
+	bIsPoundJumping = State.AirOrigin == EMarioAirAction::PoundJump;
+	bPoundJumpConsumed = bIsPoundJumping;
+	bIsDiving = MoveState == EMarioMoveState::Dive;
+
+	bIsGroundPoundPreparing = MoveState == EMarioMoveState::GroundPoundPrepare;
+	bIsGroundPounding = MoveState == EMarioMoveState::GroundPound;
+	bGroundPoundStunned = MoveState == EMarioMoveState::GroundPoundStun;
+	bWaitingForPoundJump = bGroundPoundStunned && State.bPoundJumpWindowOpen;
+	bGroundPoundUsed = State.bGroundPoundUsed;
+
+	switch (MoveState)
+	{
+	case EMarioMoveState::WallSlideStart: WallActionState = EWallActionState::SlideStart; break;
+	case EMarioMoveState::WallSlideLoop:  WallActionState = EWallActionState::SlideLoop; break;
+	case EMarioMoveState::WallKick:       WallActionState = EWallActionState::WallKick; break;
+	default:                              WallActionState = EWallActionState::None; break;
+	}
+
+	switch (MoveState)
+	{
+	case EMarioMoveState::LedgeHangStart: LedgeActionState = ELedgeState::HangStart; break;
+	case EMarioMoveState::LedgeClimb:     LedgeActionState = ELedgeState::ClimbEnd; break;
+	case EMarioMoveState::LedgeHang:
+		LedgeActionState = State.LedgeShimmyDir > 0 ? ELedgeState::MoveRight
+			: State.LedgeShimmyDir < 0 ? ELedgeState::MoveLeft
+			: ELedgeState::HangLoop;
+		break;
+	default:                              LedgeActionState = ELedgeState::None; break;
+	}
+}
+
+EMarioMoveState AMarioCharacter::UnpackAnimMoveState(int32 Word)
+{
+	return (EMarioMoveState)((Word >> MarioAnimWord::MoveStateShift) & MarioAnimWord::MoveStateMask);
+}
+
+EMarioStateGroup AMarioCharacter::UnpackAnimStateGroup(int32 Word)
+{
+	return (EMarioStateGroup)((Word >> MarioAnimWord::GroupShift) & MarioAnimWord::NibbleMask);
+}
+
+EMarioAirAction AMarioCharacter::UnpackAnimAirOrigin(int32 Word)
+{
+	return (EMarioAirAction)((Word >> MarioAnimWord::AirOriginShift) & MarioAnimWord::NibbleMask);
+}
+
+int32 AMarioCharacter::UnpackAnimJumpStage(int32 Word)
+{
+	return (Word >> MarioAnimWord::JumpStageShift) & MarioAnimWord::JumpStageMask;
+}
+
+bool AMarioCharacter::IsAnimFlagSet(int32 Word, EMarioAnimFlag Flag)
+{
+	return (Word & (1 << (MarioAnimWord::FlagShift + (int32)Flag))) != 0;
+}
+
 // wall action
 bool AMarioCharacter::IsWallActionCandidate() const
 {
@@ -1998,18 +2117,18 @@ bool AMarioCharacter::IsWallActionCandidate() const
 
 	// WallAction 대상: 일반 점프(1~3단) + 백덤블링 + 반동점프
 	// 제외: 롱점프/다이브/그라운드파운드 계열/롤
-	if (bIsLongJumping || bIsDiving || bIsRolling)
+	if (State.AirOrigin == EMarioAirAction::LongJump || State.AirOrigin == EMarioAirAction::Dive || IsRolling())
 	{
 		return false;
 	}
 
-	if (bIsGroundPoundPreparing || bIsGroundPounding || bGroundPoundStunned)
+	if (GetMoveStateGroup() == EMarioStateGroup::GroundPound)
 	{
 		return false;
 	}
 
-	// 포함 백덤블링 / 반동점프
-	if (bIsBackflipping || bIsPoundJumping)
+	// 포함 백덤블링 / 반동점프(벽차기를 거쳐도 착지 전까지 유지)
+	if (State.AirOrigin == EMarioAirAction::Backflip || State.AirOrigin == EMarioAirAction::PoundJump)
 	{
 		return true;
 	}
@@ -2018,99 +2137,60 @@ bool AMarioCharacter::IsWallActionCandidate() const
 	return (JumpStage >= 1 && JumpStage <= 3);
 }
 
-bool AMarioCharacter::TryGetWallHitFromDetector(const FHitResult& SweepResult, FHitResult& OutHit) const
+bool AMarioCharacter::SweepForWall(const FVector& Dir, FHitResult& OutHit) const
 {
-	// Overlap SweepResult에 노멀이 유효하게 들어오는 케이스 먼저 사용
-	if (!SweepResult.ImpactNormal.IsNearlyZero() && SweepResult.bBlockingHit)
-	{
-		OutHit = SweepResult;
-		return true;
-	}
-
-	if (!WallDetector || !GetWorld())
+	UWorld* World = GetWorld();
+	if (!World || Dir.IsNearlyZero())
 	{
 		return false;
 	}
 
-	const FVector Start = WallDetector->GetComponentLocation();
+	const FVector Start = GetActorLocation();
+	const FVector End = Start + Dir * (GetCapsuleComponent()->GetScaledCapsuleRadius() + WallTraceDistance);
 
-	// 오버랩은 WorldStatic/WorldDynamic 대상으로 하고 있으므로, 스윕도 ObjectType 기반으로 맞춤.
+	// 벽 접촉은 WorldStatic/WorldDynamic 기준
 	FCollisionObjectQueryParams ObjParams;
 	ObjParams.AddObjectTypesToQuery(ECC_WorldStatic);
 	ObjParams.AddObjectTypesToQuery(ECC_WorldDynamic);
 
 	FCollisionQueryParams Params(SCENE_QUERY_STAT(WallSlideTrace), false, this);
-	Params.AddIgnoredActor(this);
-
-	const FCollisionShape Shape = FCollisionShape::MakeSphere(WallTraceRadius);
-
-	// 다방향 시도: Vel2D(있으면) → Forward/Back → Right/Left
-	TArray<FVector, TInlineAllocator<5>> Dirs;
-
-	FVector Vel2D = GetVelocity();
-	Vel2D.Z = 0.f;
-	if (!Vel2D.IsNearlyZero())
-	{
-		Dirs.Add(Vel2D.GetSafeNormal());
-	}
 
-	FVector F = GetActorForwardVector(); F.Z = 0.f;
-	if (!F.IsNearlyZero()) F.Normalize();
-
-	FVector R = GetActorRightVector(); R.Z = 0.f;
-	if (!R.IsNearlyZero()) R.Normalize();
+	return MarioSceneQuery::SweepSingleByObjectType(World,
+		OutHit, Start, End, FQuat::Identity, ObjParams, FCollisionShape::MakeSphere(WallTraceRadius), Params)
+		&& OutHit.bBlockingHit;
+}
 
-	if (!F.IsNearlyZero())
-	{
-		Dirs.Add(F);
-		Dirs.Add(-F);
-	}
-	if (!R.IsNearlyZero())
+bool AMarioCharacter::PassesWallFilters(const FHitResult& WallHit, const FVector& ApproachVelocity) const
+{
+	if (!WallHit.bBlockingHit)
 	{
-		Dirs.Add(R);
-		Dirs.Add(-R);
+		return false;
 	}
 
-	for (const FVector& Dir : Dirs)
+	// 월드 지형만 벽으로 인정(굼바/주먹/보스 같은 Pawn 캡슐에는 붙거나 차지 않음)
+	const UPrimitiveComponent* WallComp = WallHit.GetComponent();
+	if (!WallComp)
 	{
-		if (Dir.IsNearlyZero()) continue;
-
-		const FVector End = Start + Dir * WallTraceDistance;
-
-		FHitResult Hit;
-		const bool bHit = GetWorld()->SweepSingleByObjectType(
-			Hit, Start, End, FQuat::Identity, ObjParams, Shape, Params);
-
-		if (bHit && Hit.bBlockingHit)
-		{
-			OutHit = Hit;
-			return true;
-		}
+		return false;
 	}
 
-	return false;
-}
-
-bool AMarioCharacter::PassesWallFilters(const FHitResult& WallHit) const
-{
-	if (!WallHit.bBlockingHit)
+	const ECollisionChannel WallType = WallComp->GetCollisionObjectType();
+	if (WallType != ECC_WorldStatic && WallType != ECC_WorldDynamic)
 	{
 		return false;
 	}
 
 	// 수직 벽 필터: 70~110도 허용
-	// Normal과 Up의 각도 = acos(Normal.Z)
-	// 70~110도면 Normal.Z가 [-cos70, +cos70] 범위
-	const float MaxAbsNormalZ = FMath::Cos(FMath::DegreesToRadians(70.f)); // 약 0.342
 	const FVector N = WallHit.ImpactNormal.GetSafeNormal();
-	if (FMath::Abs(N.Z) > MaxAbsNormalZ)
+	if (FMath::Abs(N.Z) > WallMaxAbsNormalZ)
 	{
 		return false;
 	}
 
 	// "거의 정면" 접근 필터
 	// Forward 기반보다 "수평 속도 방향"이 백덤블링/반동점프에서 더 안정적
-	FVector Vel2D = GetVelocity();
+	// (충돌 뒤엔 이동 컴포넌트가 벽 방향 성분을 깎으므로 충돌 직전 속도를 받는다)
+	FVector Vel2D = ApproachVelocity;
 	Vel2D.Z = 0.f;
 
 	FVector ApproachDir = Vel2D.GetSafeNormal();
@@ -2141,12 +2221,42 @@ bool AMarioCharacter::PassesWallFilters(const FHitResult& WallHit) const
 
 void AMarioCharacter::StartWallSlide(const FHitResult& WallHit)
 {
-	// 상태 진입 (AnimBP용)
-	WallActionState = EWallActionState::SlideStart;
-
 	// 캐시
 	CurrentWallNormal = WallHit.ImpactNormal.GetSafeNormal();
-	
+
+	// SlideStart -> (WallSlideStartDuration 경과) -> SlideLoop 은 상태 테이블이 진행
+	ChangeMoveState(EMarioMoveState::WallSlideStart);
+}
+
+void AMarioCharacter::EnterWallGroup(EMarioMoveState PrevState)
+{
+	// 기존 공중기 플래그는 벽 상태로 "캔슬" 처리(애니 충돌 방지 목적)
+	if (State.AirOrigin == EMarioAirAction::LongJump || State.AirOrigin == EMarioAirAction::Dive)
+	{
+		State.AirOrigin = EMarioAirAction::None;
+	}
+}
+
+void AMarioCharacter::ExitWallGroup(EMarioMoveState NextState)
+{
+	CurrentWallNormal = FVector::ZeroVector;
+
+	if (UCharacterMovementComponent* MoveComp = GetCharacterMovement())
+	{
+		MoveComp->GravityScale = DefaultGravityScale;
+
+		// 킥 직후 입력락 중이면 회전 원복은 EndWallKickInputLock이 담당
+		if (!bWallKickInputLocked)
+		{
+			MoveComp->bOrientRotationToMovement = bDefaultOrientRotationToMovement;
+		}
+	}
+
+	UE_LOG(LogMarioWall, Verbose, TEXT("[Wall] Exit -> %s"), *UEnum::GetValueAsString(NextState));
+}
+
+void AMarioCharacter::EnterWallSlideStart(EMarioMoveState PrevState)
+{
 	// Slide 중엔 정면을 벽 쪽으로 고정해야 함
 	if (UCharacterMovementComponent* MoveComp = GetCharacterMovement())
 	{
@@ -2187,46 +2297,42 @@ void AMarioCharacter::StartWallSlide(const FHitResult& WallHit)
 	}
 	ApplyWallSlideMovementSettings(true);
 	UpdateWallSlidePhysics(0.f); // 진입 순간에도 바로 속도 정리(튀는 값 방지)
-	
-	// 기존 공중기 플래그는 벽 상태로 "캔슬" 처리(애니 충돌 방지 목적)
-	bIsLongJumping = false;
-
-	// Start -> Loop 전이 (타이머 사용)
-	GetWorld()->GetTimerManager().ClearTimer(WallSlideStartToLoopTimer);
-	GetWorld()->GetTimerManager().SetTimer(
-		WallSlideStartToLoopTimer, this, &AMarioCharacter::EnterWallSlideLoop,
-		WallSlideStartDuration, false);
 
-	UE_LOG(LogTemp, Log, TEXT("[Wall] Enter SlideStart  Normal=(%.2f %.2f %.2f)"),
+	UE_LOG(LogMarioWall, Verbose, TEXT("[Wall] Enter SlideStart  Normal=(%.2f %.2f %.2f)"),
 		CurrentWallNormal.X, CurrentWallNormal.Y, CurrentWallNormal.Z);
 }
 
-void AMarioCharacter::EnterWallSlideLoop()
+void AMarioCharacter::EnterWallSlideLoop(EMarioMoveState PrevState)
 {
-	if (WallActionState == EWallActionState::SlideStart)
-	{
-		WallActionState = EWallActionState::SlideLoop;
+	UpdateWallSlidePhysics(0.f); // 상승/하강 분기는 여기서 단일 처리
 
-		UpdateWallSlidePhysics(0.f); // 상승/하강 분기는 여기서 단일 처리
+	UE_LOG(LogMarioWall, Verbose, TEXT("[Wall] Enter SlideLoop"));
+}
 
-		UE_LOG(LogTemp, Log, TEXT("[Wall] Enter SlideLoop"));
+void AMarioCharacter::ExitWallSlide(EMarioMoveState NextState)
+{
+	// Start -> Loop 사이에서는 슬라이드 이동값 유지
+	if (NextState != EMarioMoveState::WallSlideStart && NextState != EMarioMoveState::WallSlideLoop)
+	{
+		ApplyWallSlideMovementSettings(false);
 	}
 }
 
-void AMarioCharacter::ResetWallSlide()
+void AMarioCharacter::TickWallSlide(float DeltaTime)
 {
-	GetWorld()->GetTimerManager().ClearTimer(WallSlideStartToLoopTimer);
+	FMarioBenchScope BenchScope(BenchTimings ? &BenchTimings->WallSlideCycles : nullptr);
+	UpdateWallSlidePhysics(DeltaTime);
+}
 
-	WallActionState = EWallActionState::None;
-	CurrentWallNormal = FVector::ZeroVector;
-	if (UCharacterMovementComponent* MoveComp = GetCharacterMovement())
+void AMarioCharacter::ResetWallSlide()
+{
+	if (GetMoveStateGroup() != EMarioStateGroup::Wall)
 	{
-		MoveComp->GravityScale = DefaultGravityScale;
-		MoveComp->bOrientRotationToMovement = bDefaultOrientRotationToMovement;
-		ApplyWallSlideMovementSettings(false);
+		return;
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("[Wall] Reset -> None"));
+	// 이동값/회전/중력 원복은 벽 그룹 Exit 훅에서
+	ChangeMoveState(EMarioMoveState::None);
 }
 
 void AMarioCharacter::ApplyWallSlideMovementSettings(bool bEnable)
@@ -2254,7 +2360,7 @@ void AMarioCharacter::ApplyWallSlideMovementSettings(bool bEnable)
 
 void AMarioCharacter::UpdateWallSlidePhysics(float DeltaTime)
 {
-	if (!(WallActionState == EWallActionState::SlideStart || WallActionState == EWallActionState::SlideLoop))
+	if (!IsWallSliding())
 	{
 		return;
 	}
@@ -2272,7 +2378,7 @@ void AMarioCharacter::UpdateWallSlidePhysics(float DeltaTime)
 
 	FVector V = Move->Velocity;
 
-	// 벽 노멀 성분 제거(벽에서 떨어지거나 파고드는 성분 제거)
+	// 벽 노멀 성분은 벽 쪽 고정 속도로 교체(벽에서 떨어지는 성분 제거 + 이동 스윕이 계속 벽을 치게)
 	FVector N = CurrentWallNormal;
 	N.Z = 0.f;
 	N = N.GetSafeNormal();
@@ -2280,7 +2386,7 @@ void AMarioCharacter::UpdateWallSlidePhysics(float DeltaTime)
 	if (!N.IsNearlyZero())
 	{
 		const float AlongN = FVector::DotProduct(V, N);
-		V -= N * AlongN;
+		V -= N * (AlongN + WallSlideStickSpeed);
 	}
 
 	// 핵심 분기
@@ -2303,17 +2409,14 @@ void AMarioCharacter::UpdateWallSlidePhysics(float DeltaTime)
 void AMarioCharacter::ExecuteWallKick()
 {
 	// SlideStart/Loop에서만 허용
-	if (!(WallActionState == EWallActionState::SlideStart || WallActionState == EWallActionState::SlideLoop))
+	if (!IsWallSliding())
 	{
 		return;
 	}
-	// SlideStart->Loop 전이 타이머는 즉시 끊기
-	GetWorld()->GetTimerManager().ClearTimer(WallSlideStartToLoopTimer);
-	
-	ApplyWallSlideMovementSettings(false);
 	
-	// WallKick 상태로 전환(AnimBP가 KickJump 애니 재생)
-	WallActionState = EWallActionState::WallKick;
+	// WallKick 상태로 전환(AnimBP가 KickJump 애니 재생, WallKickStateDuration 뒤 None)
+	// 슬라이드 Exit 훅이 이동값 원복, SlideStart->Loop 전이도 여기서 끊김
+	ChangeMoveState(EMarioMoveState::WallKick);
 
 	// 방향: 벽 노멀의 XY만 사용 (Normal은 "벽 → 캐릭터" 방향)
 	FVector N = CurrentWallNormal;
@@ -2338,10 +2441,6 @@ void AMarioCharacter::ExecuteWallKick()
 	// 먼저 정면을 발사 방향으로 고정(= 180도 전환 효과)
 	FaceDirection2D(LaunchVel);
 
-	// 기존 공중기 플래그 정리(충돌 방지)
-	bIsLongJumping = false;
-	bIsDiving = false;
-
 	WallKickStartTime = GetWorld()->GetTimeSeconds();
 	BeginWallKickInputLock();
 
@@ -2352,35 +2451,10 @@ void AMarioCharacter::ExecuteWallKick()
 	// Launch
 	LaunchCharacter(LaunchVel, true, true);
 
-	// WallKick 상태 유지(애니 재생 창)
-	GetWorld()->GetTimerManager().ClearTimer(WallKickStateTimer);
-	GetWorld()->GetTimerManager().SetTimer(
-		WallKickStateTimer, this, &AMarioCharacter::EndWallKickState,
-		WallKickStateDuration, false);
-
-	UE_LOG(LogTemp, Log, TEXT("[Wall] Execute WallKick  Vel=(%.1f %.1f %.1f)"),
+	UE_LOG(LogMarioWall, Verbose, TEXT("[Wall] Execute WallKick  Vel=(%.1f %.1f %.1f)"),
 		LaunchVel.X, LaunchVel.Y, LaunchVel.Z);
 }
 
-void AMarioCharacter::EndWallKickState()
-{
-	if (WallActionState == EWallActionState::WallKick)
-	{
-		WallActionState = EWallActionState::None;
-		CurrentWallNormal = FVector::ZeroVector;
-		
-		if (UCharacterMovementComponent* MoveComp = GetCharacterMovement())
-		{
-			if (!bWallKickInputLocked)
-			{
-				MoveComp->bOrientRotationToMovement = bDefaultOrientRotationToMovement;
-			}
-		}
-		
-		UE_LOG(LogTemp, Log, TEXT("[Wall] End WallKick -> None"));
-	}
-}
-
 void AMarioCharacter::BeginWallKickInputLock()
 {
 	UCharacterMovementComponent* MoveComp = GetCharacterMovement();
@@ -2402,10 +2476,7 @@ void AMarioCharacter::BeginWallKickInputLock()
 	
 	MoveComp->bOrientRotationToMovement = false;
 	
-	GetWorld()->GetTimerManager().ClearTimer(WallKickInputLockTimer);
-	GetWorld()->GetTimerManager().SetTimer(
-		WallKickInputLockTimer, this, &AMarioCharacter::EndWallKickInputLock,
-		WallKickInputLockDuration, false);
+	State.WallKickLockRemaining = FMath::Max(WallKickInputLockDuration, KINDA_SMALL_NUMBER);
 }
 
 void AMarioCharacter::EndWallKickInputLock()
@@ -2419,11 +2490,12 @@ void AMarioCharacter::EndWallKickInputLock()
 	}
 
 	bWallKickInputLocked = false;
+	State.WallKickLockRemaining = 0.f;
 
 	MoveComp->AirControl = CachedAirControl;
 	MoveComp->MaxAcceleration = CachedMaxAcceleration;
 	
-	if (WallActionState == EWallActionState::None)
+	if (GetMoveStateGroup() != EMarioStateGroup::Wall)
 	{
 		MoveComp->bOrientRotationToMovement = bDefaultOrientRotationToMovement;
 	}
@@ -2431,79 +2503,130 @@ void AMarioCharacter::EndWallKickInputLock()
 
 void AMarioCharacter::CancelWallKickForSlideEntry()
 {
-	if (!GetWorld()) return;
-
-	// WallKick 상태를 유지하려는 타이머들 제거
-	GetWorld()->GetTimerManager().ClearTimer(WallKickStateTimer);
-	GetWorld()->GetTimerManager().ClearTimer(WallKickInputLockTimer);
-
-	// 이동 파라미터 복구
+	// WallKick 상태 경과는 SlideStart 진입 시 함께 끊기므로 입력락만 해제(이동 파라미터 복구)
 	EndWallKickInputLock();
 }
 
-void AMarioCharacter::TryEnterWallSlideFromCurrentOverlap()
+void AMarioCharacter::MoveBlockedBy(const FHitResult& Impact)
 {
-	// 이미 어떤 Wall 상태면 중복 진입 금지
-	if (WallActionState != EWallActionState::None)
+	Super::MoveBlockedBy(Impact);
+
+	// 수직에 가까운 면만 기록(바닥/천장 충돌은 무시). 판정은 다음 Tick의 UpdateWallContact에서
+	const FVector N = Impact.ImpactNormal;
+	if (!Impact.bBlockingHit || FMath::Abs(N.Z) > WallMaxAbsNormalZ)
 	{
 		return;
 	}
 
-	// bWallOverlapping이 순간적으로 false여도(착지/미세 분리) Trace로 판정해서 진입 가능하게 둔다.
+	const UCharacterMovementComponent* MoveComp = GetCharacterMovement();
+	WallContactHit = Impact;
+	// HandleImpact 시점의 Velocity는 아직 벽 방향 성분이 남아있는 충돌 직전 값
+	WallContactVelocity = MoveComp ? MoveComp->Velocity : GetVelocity();
+	WallContactTime = GetWorld()->GetTimeSeconds();
+}
+
+bool AMarioCharacter::HasRecentWallContact() const
+{
+	return WallContactTime >= 0.f && (GetWorld()->GetTimeSeconds() - WallContactTime) <= WallContactGraceTime;
+}
+
+void AMarioCharacter::UpdateWallContact()
+{
+	// 지상에서 벽에 붙어 달리다 점프한 경우도 최근 접촉(유예 시간 내)으로 바로 진입 판정된다
+	bWallOverlapping = HasRecentWallContact();
 
-	UCharacterMovementComponent* MoveComp = GetCharacterMovement();
-	if (!MoveComp || !MoveComp->IsFalling())
+	if (IsWallSliding())
 	{
+		if (bWallOverlapping)
+		{
+			UpdateWallNormalFromContact();
+			return;
+		}
+
+		// 유예 시간 동안 스윕 접촉이 끊겼으면 현재 벽 방향으로 1회만 재확인
+		FHitResult WallHit;
+		if (SweepForWall(-CurrentWallNormal, WallHit) && PassesWallFilters(WallHit, -CurrentWallNormal))
+		{
+			WallContactHit = WallHit;
+			WallContactVelocity = -CurrentWallNormal;
+			WallContactTime = GetWorld()->GetTimeSeconds();
+			bWallOverlapping = true;
+			UpdateWallNormalFromContact();
+			return;
+		}
+
+		ResetWallSlide();
 		return;
 	}
 
-	// 기존 조건 재사용(점프 1~3단 / 백덤블링 / 반동점프)
-	if (!IsWallActionCandidate())
+	// 공중 + 근처 벽 접촉이 있을 때만 진입 판정
+	if (!bWallOverlapping)
 	{
 		return;
 	}
 
-	// 현재 오버랩 상태에서 "벽 히트" 재확인
-	FHitResult DummySweep;
-	FHitResult WallHit;
-	if (!TryGetWallHitFromDetector(DummySweep, WallHit))
+	const UCharacterMovementComponent* MoveComp = GetCharacterMovement();
+	if (!MoveComp || !MoveComp->IsFalling())
 	{
 		return;
 	}
 
-	if (!PassesWallFilters(WallHit))
+	const float Now = GetWorld()->GetTimeSeconds();
+	const bool bRecentlyWallKicked = (Now - WallKickStartTime) <= WallKickSlideReenterWindow;
+	const bool bFromWallKick = (State.MoveState == EMarioMoveState::WallKick) || bRecentlyWallKicked;
+
+	// WallKick(또는 직후)면 연속 벽차기를 위해 Slide 진입 허용
+	// 단, Kick 직후 즉시 같은 벽 재포획만 아주 짧게 방지(킥 이전 접촉도 여기서 걸러짐)
+	if (bFromWallKick)
 	{
-		return;
+		if ((Now - WallKickStartTime) < WallKickMinReenterDelay || WallContactTime < WallKickStartTime + WallKickMinReenterDelay)
+		{
+			return;
+		}
 	}
+	else
+	{
+		// WallKick이 아닌 경우는 기존처럼 벽 상태가 아닐 때만 진입 허용
+		if (GetMoveStateGroup() == EMarioStateGroup::Wall)
+		{
+			return;
+		}
 
-	StartWallSlide(WallHit);
-}
+		if (!IsWallActionCandidate())
+		{
+			return;
+		}
+	}
 
-void AMarioCharacter::ConfirmWallContactAfterEndOverlap()
-{
-	// 그 사이에 상태가 바뀌었으면 무시
-	if (!(WallActionState == EWallActionState::SlideStart || WallActionState == EWallActionState::SlideLoop))
+	if (!PassesWallFilters(WallContactHit, WallContactVelocity))
 	{
 		return;
 	}
 
-	// 유예 중에 다시 오버랩이 들어왔으면 유지
-	if (bWallOverlapping)
+	// 실제로 WallKick 상태/입력락이 남아있다면 정리 후 Slide로 전환
+	if (State.MoveState == EMarioMoveState::WallKick || bWallKickInputLocked)
 	{
-		return;
+		CancelWallKickForSlideEntry();
 	}
 
-	// 실제로 아직 벽이 가까이 있으면 유지, 아니면 Reset
-	FHitResult DummySweep;
-	FHitResult WallHit;
-	if (TryGetWallHitFromDetector(DummySweep, WallHit) && PassesWallFilters(WallHit))
+	StartWallSlide(WallContactHit);
+}
+
+void AMarioCharacter::UpdateWallNormalFromContact()
+{
+	FVector N = WallContactHit.ImpactNormal;
+	N.Z = 0.f;
+	if (!N.Normalize())
 	{
-		bWallOverlapping = true;
-		CurrentWallNormal = WallHit.ImpactNormal.GetSafeNormal();
 		return;
 	}
 
-	ResetWallSlide();
+	// 히스테리시스: 같은 벽의 미세한 노멀 흔들림(분할 메시/스텝 경계)은 무시하고,
+	// 확실히 다른 면(코너)일 때만 교체
+	if (FVector::DotProduct(N, CurrentWallNormal.GetSafeNormal2D()) < WallNormalSwitchDot)
+	{
+		CurrentWallNormal = WallContactHit.ImpactNormal.GetSafeNormal();
+	}
 }
 
 void AMarioCharacter::FaceDirection2D(const FVector& Dir)
@@ -2532,9 +2655,236 @@ void AMarioCharacter::FaceAwayFromNormal(const FVector& WallNormal)
 	FaceDirection2D(WallNormal);
 }
 
+// ledge action
+bool AMarioCharacter::IsLedgeGrabCandidate() const
+{
+	const UCharacterMovementComponent* MoveComp = GetCharacterMovement();
+	if (!MoveComp || !MoveComp->IsFalling() || MoveComp->Velocity.Z > 0.f)
+	{
+		return false; // 하강 중에만
+	}
+
+	if (CaptureComp && CaptureComp->IsCapturing())
+	{
+		return false;
+	}
+
+	if (GetWorld()->GetTimeSeconds() < LedgeRegrabTime)
+	{
+		return false;
+	}
+
+	// 일반 낙하/점프/공중기/벽 슬라이드에서 허용, 다이브/엉덩방아/롤/이미 매달림은 제외
+	switch (GetMoveStateGroup())
+	{
+	case EMarioStateGroup::Free:
+	case EMarioStateGroup::Wall:
+		return true;
+	case EMarioStateGroup::Air:
+		return State.MoveState != EMarioMoveState::Dive;
+	default:
+		return false;
+	}
+}
+
+void AMarioCharacter::UpdateLedgeGrab()
+{
+	if (bInputLocked || !LedgeDetector || !IsLedgeGrabCandidate())
+	{
+		return;
+	}
+
+	const ULedgeEdgeSubsystem* Ledges = ULedgeEdgeSubsystem::Get(this);
+	if (!Ledges)
+	{
+		return;
+	}
+
+	// 손 위치/높이 창은 LedgeDetector 박스 기준
+	FLedgeGrabQuery Query;
+	Query.Hand = LedgeDetector->GetComponentLocation();
+	Query.Facing = GetActorForwardVector();
+	Query.Reach = LedgeGrabReach;
+	Query.Below = LedgeDetector->GetScaledBoxExtent().Z;
+	Query.Above = Query.Below;
+	Query.EndMargin = LedgeEdgeMargin;
+	Query.MinFacingDot = LedgeGrabMinFacingDot;
+
+	FLedgeGrabResult Edge;
+	if (!Ledges->FindGrabEdge(Query, Edge))
+	{
+		return;
+	}
+
+	// 몸(캡슐 중심)은 모서리 바깥쪽에 있어야 한다(윗면 위에서 잡기 방지)
+	if (FVector::DotProduct(GetActorLocation() - Edge.GetPoint(), Edge.Normal) <= 0.f)
+	{
+		return;
+	}
+
+	if (!ConfirmLedgeTop(Edge.GetPoint(), Edge.Normal))
+	{
+		return;
+	}
+
+	BeginLedgeHang(Edge);
+}
+
+bool AMarioCharacter::ConfirmLedgeTop(const FVector& EdgePoint, const FVector& EdgeNormal) const
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return false;
+	}
+
+	// 모서리 바로 안쪽 윗면을 위에서 아래로 1회 확인(캐시 근사/위에 놓인 장애물 걸러냄)
+	const FVector Probe = EdgePoint - EdgeNormal * LedgeConfirmInset;
+	const FVector Start = Probe + FVector::UpVector * LedgeConfirmHeight;
+	const FVector End = Probe - FVector::UpVector * LedgeConfirmTolerance;
+
+	FCollisionObjectQueryParams ObjParams;
+	ObjParams.AddObjectTypesToQuery(ECC_WorldStatic);
+	ObjParams.AddObjectTypesToQuery(ECC_WorldDynamic);
+
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(LedgeConfirmTrace), false, this);
+
+	FHitResult Hit;
+	if (!MarioSceneQuery::LineTraceSingleByObjectType(World, Hit, Start, End, ObjParams, Params) || Hit.bStartPenetrating)
+	{
+		return false;
+	}
+
+	return Hit.ImpactNormal.Z >= LedgeMinTopNormalZ
+		&& FMath::Abs(Hit.ImpactPoint.Z - EdgePoint.Z) <= LedgeConfirmTolerance;
+}
+
+void AMarioCharacter::BeginLedgeHang(const FLedgeGrabResult& Edge)
+{
+	State.LedgeOrigin = Edge.Origin;
+	State.LedgeTangent = Edge.Tangent;
+	State.LedgeNormal = Edge.Normal;
+	State.LedgeLength = Edge.Length;
+	State.LedgeParam = Edge.Param;
+	State.LedgeShimmyDir = 0;
+	State.LedgeMoveInput = FVector2D::ZeroVector;
+
+	// 위치 고정/이동 모드 전환은 Ledge 그룹 Enter 훅에서
+	ChangeMoveState(EMarioMoveState::LedgeHangStart);
+}
+
+FVector AMarioCharacter::GetLedgeHangLocation() const
+{
+	const FVector EdgePoint = State.LedgeOrigin + State.LedgeTangent * State.LedgeParam;
+	return EdgePoint + State.LedgeNormal * LedgeHangWallOffset - FVector::UpVector * LedgeHangDownOffset;
+}
+
+void AMarioCharacter::EnterLedgeGroup(EMarioMoveState PrevState)
+{
+	// 공중기/엉덩방아 사용 기록은 매달리면 초기화(착지와 동일 취급)
+	State.AirOrigin = EMarioAirAction::None;
+	State.bGroundPoundUsed = false;
+
+	if (UCharacterMovementComponent* MoveComp = GetCharacterMovement())
+	{
+		// 매달린 동안엔 중력/이동 입력 없이 위치를 직접 잡는다
+		MoveComp->StopMovementImmediately();
+		MoveComp->SetMovementMode(MOVE_Flying);
+		MoveComp->bOrientRotationToMovement = false;
+	}
+
+	SetActorLocation(GetLedgeHangLocation(), false, nullptr, ETeleportType::TeleportPhysics);
+	FaceWallFromNormal(State.LedgeNormal);
+}
+
+void AMarioCharacter::ExitLedgeGroup(EMarioMoveState NextState)
+{
+	State.LedgeShimmyDir = 0;
+	State.LedgeMoveInput = FVector2D::ZeroVector;
+	LedgeRegrabTime = GetWorld()->GetTimeSeconds() + LedgeRegrabDelay;
+
+	if (UCharacterMovementComponent* MoveComp = GetCharacterMovement())
+	{
+		MoveComp->bOrientRotationToMovement = bDefaultOrientRotationToMovement;
+
+		// 놓기/피격/캡쳐: 그대로 떨어진다(올라서기는 FinishLedgeClimb가 Walking으로 바꿈)
+		if (MoveComp->MovementMode == MOVE_Flying)
+		{
+			MoveComp->SetMovementMode(MOVE_Falling);
+		}
+	}
+}
+
+void AMarioCharacter::TickLedgeHang(float DeltaTime)
+{
+	const FVector2D Input = State.LedgeMoveInput;
+	State.LedgeMoveInput = FVector2D::ZeroVector;
+	State.LedgeShimmyDir = 0;
+
+	if (!Controller || Input.IsNearlyZero())
+	{
+		return;
+	}
+
+	// 카메라 기준 입력을 월드 방향으로 바꿔 모서리 방향 성분만 사용
+	const FRotator YawRot(0.f, Controller->GetControlRotation().Yaw, 0.f);
+	const FRotationMatrix YawMatrix(YawRot);
+	const FVector WorldInput = YawMatrix.GetUnitAxis(EAxis::X) * Input.Y + YawMatrix.GetUnitAxis(EAxis::Y) * Input.X;
+
+	const float Along = FVector::DotProduct(WorldInput, State.LedgeTangent);
+	if (FMath::Abs(Along) <= LedgeShimmyDeadZone)
+	{
+		return;
+	}
+
+	const float PrevParam = State.LedgeParam;
+	State.LedgeParam = FMath::Clamp(
+		PrevParam + FMath::Sign(Along) * LedgeShimmySpeed * DeltaTime,
+		LedgeEdgeMargin, State.LedgeLength - LedgeEdgeMargin);
+
+	if (FMath::IsNearlyEqual(State.LedgeParam, PrevParam))
+	{
+		return; // 모서리 끝
+	}
+
+	// 옆 장애물은 스윕으로 멈추고, 실제 도착 위치로 Param을 다시 맞춘다
+	SetActorLocation(GetLedgeHangLocation(), true);
+	State.LedgeParam = FVector::DotProduct(GetActorLocation() - State.LedgeOrigin, State.LedgeTangent);
+
+	// 마리오는 벽(-Normal)을 보고 있으므로 오른쪽 = Up x Forward
+	const FVector MarioRight = FVector::CrossProduct(FVector::UpVector, -State.LedgeNormal);
+	const float Moved = State.LedgeParam - PrevParam;
+	if (!FMath::IsNearlyZero(Moved))
+	{
+		State.LedgeShimmyDir = (Moved * FVector::DotProduct(State.LedgeTangent, MarioRight)) > 0.f ? 1 : -1;
+	}
+}
+
+void AMarioCharacter::FinishLedgeClimb()
+{
+	const FVector EdgePoint = State.LedgeOrigin + State.LedgeTangent * State.LedgeParam;
+	const UCapsuleComponent* Capsule = GetCapsuleComponent();
+	const FVector Top = EdgePoint
+		- State.LedgeNormal * (Capsule->GetScaledCapsuleRadius() + LedgeClimbInset)
+		+ FVector::UpVector * (Capsule->GetScaledCapsuleHalfHeight() + 2.f);
+
+	// Exit 훅이 Falling으로 돌린 뒤 윗면으로 이동
+	ChangeMoveState(EMarioMoveState::None);
+
+	// 윗면에 공간이 없으면(낮은 천장 등) 그냥 떨어진다
+	if (TeleportTo(Top, GetActorRotation()))
+	{
+		if (UCharacterMovementComponent* MoveComp = GetCharacterMovement())
+		{
+			MoveComp->SetMovementMode(MOVE_Walking);
+		}
+		JumpStage = 0;
+	}
+}
+
 void AMarioCharacter::ApplyMoveSpeed()
 {
-	if (bIsRolling)
+	if (IsRolling())
 		return;
 	UCharacterMovementComponent* MoveComp = GetCharacterMovement();
 	if (!MoveComp)
@@ -2587,20 +2937,3 @@ void AMarioCharacter::CaptureSyncTargetControlRotation(const FRotator& InRot)
 {
 	TargetControlRotation = InRot;
 }
-
-void AMarioCharacter::CaptureTickCamera(float DeltaTime, APlayerController* PC)
-{
-	if (!bCaptureControlRotOverride) return;
-	if (!PC) return;
-
-	const FRotator Current = PC->GetControlRotation();
-	const FRotator Smoothed = FMath::RInterpTo(
-		Current,
-		TargetControlRotation,
-		DeltaTime,
-		CameraRotationInterpSpeed
-	);
-
-	PC->SetControlRotation(Smoothed);
-	SetCaptureControlRotation(Smoothed); // GetViewRotation()이 이 값을 반환
-}
\ No newline at end of file
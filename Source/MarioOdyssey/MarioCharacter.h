@@ -7,6 +7,8 @@
 #include "InputAction.h"
 #include "InputMappingContext.h"
 #include "MarioState.h"
+#include "ActorTimeline.h"
+#include "MarioSlope.h"
 #include "MarioCharacter.generated.h"
 
 
@@ -16,6 +18,10 @@ class UBoxComponent;
 struct FInputActionValue;
 class UCaptureComponent;
 class APlayerController;
+struct FMarioBenchTimings;
+struct FLedgeGrabResult;
+class AMarioCapProjectile;
+enum class ECapRetireReason : uint8;
 
 UCLASS()
 class MARIOODYSSEY_API AMarioCharacter : public ACharacter
@@ -49,9 +55,29 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Mario|HP")
 	bool IsGameOverPublic() const { return bGameOver; }
 
+	UFUNCTION(BlueprintPure, Category="Mario|State")
+	EMarioMoveState GetMoveState() const { return State.MoveState; }
+
+	// AnimStateWord 해석(AnimBP 스레드 세이프 업데이트에서 사용)
+	UFUNCTION(BlueprintPure, Category="Mario|State", meta=(BlueprintThreadSafe))
+	static EMarioMoveState UnpackAnimMoveState(int32 Word);
+
+	UFUNCTION(BlueprintPure, Category="Mario|State", meta=(BlueprintThreadSafe))
+	static EMarioStateGroup UnpackAnimStateGroup(int32 Word);
+
+	UFUNCTION(BlueprintPure, Category="Mario|State", meta=(BlueprintThreadSafe))
+	static EMarioAirAction UnpackAnimAirOrigin(int32 Word);
+
+	UFUNCTION(BlueprintPure, Category="Mario|State", meta=(BlueprintThreadSafe))
+	static int32 UnpackAnimJumpStage(int32 Word);
+
+	UFUNCTION(BlueprintPure, Category="Mario|State", meta=(BlueprintThreadSafe))
+	static bool IsAnimFlagSet(int32 Word, EMarioAnimFlag Flag);
+
 	
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void Landed(const FHitResult& Hit) override;//점프 OnLanded 오버라이드
 
 	// HP 변경은 여기로만 통과(=GameInstance/HUD 동기화 보장)
@@ -69,23 +95,6 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Mario|Capture", meta=(AllowPrivateAccess="true"))
 	UCaptureComponent* CaptureComp = nullptr;
 	
-	//wall, ledge 디텍터 컴포넌트 오버랩 함수
-	UFUNCTION()
-	void OnWallDetectorBeginOverlap(UPrimitiveComponent* OverlappedComp, AActor* OtherActor,
-		UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
-
-	UFUNCTION()
-	void OnWallDetectorEndOverlap(UPrimitiveComponent* OverlappedComp, AActor* OtherActor,
-		UPrimitiveComponent* OtherComp, int32 OtherBodyIndex);
-
-	UFUNCTION()
-	void OnLedgeDetectorBeginOverlap(UPrimitiveComponent* OverlappedComp, AActor* OtherActor,
-		UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
-
-	UFUNCTION()
-	void OnLedgeDetectorEndOverlap(UPrimitiveComponent* OverlappedComp, AActor* OtherActor,
-		UPrimitiveComponent* OtherComp, int32 OtherBodyIndex);
-	
 	//카메라
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Camera")
 	USpringArmComponent* SpringArm;
@@ -100,10 +109,7 @@ protected:
 	
 	FVector SpringArmTargetOffset_Default = FVector::ZeroVector;
 	
-	//디텍터( wall, ledge 컴포넌트 포인터 )
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Detection", meta=(AllowPrivateAccess="true"))
-	UBoxComponent* WallDetector = nullptr; 
-
+	//디텍터( ledge 손 위치/높이 창. 충돌 없음, 모서리는 ULedgeEdgeSubsystem 격자에서 찾는다 )
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Detection", meta=(AllowPrivateAccess="true"))
 	UBoxComponent* LedgeDetector = nullptr;
 	
@@ -146,10 +152,11 @@ protected:
 	
 	//캐피액션
 	UPROPERTY(EditDefaultsOnly, Category="Mario|Cap")
-	TSubclassOf<class AMarioCapProjectile> CapProjectileClass;
+	TSubclassOf<AMarioCapProjectile> CapProjectileClass;
 	
+	// 마리오 전용 모자(BeginPlay에서 1회 스폰, 던질 때마다 Launch/Retire로 재사용)
 	UPROPERTY(VisibleInstanceOnly, Category="Mario|Cap")
-	TObjectPtr<AActor> ActiveCap = nullptr;
+	TObjectPtr<AMarioCapProjectile> CapActor = nullptr;
 	
 	UPROPERTY(EditDefaultsOnly, Category="Mario|Cap")
 	float CapThrowSpeed = 1800.f;
@@ -186,9 +193,6 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category = "Jump")
 	float JumpZ_Stage3 = 1230.f;
 	
-	void StartGroundPound();
-	void EndGroundPoundStun();
-	
 	//웅크리기
 	UPROPERTY(BlueprintReadOnly, Category="State|Crouch", meta=(AllowPrivateAccess="true"))
 	bool bCrouchHeld = false; // C키 홀드 상태(롱점프/백텀블링 분기용)
@@ -216,31 +220,30 @@ protected:
 
 	
 	UPROPERTY(BlueprintReadOnly, Category="State|Jump", meta=(AllowPrivateAccess="true"))
-	bool bIsLongJumping = false; // 롱점프 상태
+	bool bIsLongJumping = false; // 롱점프 상태(AnimBP 호환 미러)
 
 	UPROPERTY(BlueprintReadOnly, Category="State|Jump", meta=(AllowPrivateAccess="true"))
-	bool bIsBackflipping = false; // 백덤블링 상태
+	bool bIsBackflipping = false; // 백덤블링 상태(AnimBP 호환 미러)
 	
 	UPROPERTY(BlueprintReadOnly, Category="State|Crouch", meta=(AllowPrivateAccess="true"))
 	bool bAnimIsCrouched = false; // 웅크리기 상태
 	
 	//wall action
 	UPROPERTY(BlueprintReadOnly, Category="State|Wall", meta=(AllowPrivateAccess="true"))
-	EWallActionState WallActionState = EWallActionState::None;
+	EWallActionState WallActionState = EWallActionState::None; // AnimBP 호환 미러
 	
 	UPROPERTY(BlueprintReadOnly, Category="State|Wall", meta=(AllowPrivateAccess="true"))
 	FVector CurrentWallNormal = FVector::ZeroVector;
 
+	// 이동 스윕 벽 접촉 유지 중(WallContactGraceTime 히스테리시스 포함)
 	UPROPERTY(BlueprintReadOnly, Category="State|Wall", meta=(AllowPrivateAccess="true"))
 	bool bWallOverlapping = false;
 
-	FTimerHandle WallSlideStartToLoopTimer;
-
 	UPROPERTY(EditDefaultsOnly, Category="Mario|Wall")
 	float WallSlideStartDuration = 0.83f; // SlideStart -> SlideLoop 전이 시간
 
 	UPROPERTY(EditDefaultsOnly, Category="Mario|Wall")
-	float WallTraceDistance = 35.f; // Overlap Begin 순간 보조 스윕 거리
+	float WallTraceDistance = 35.f; // 슬라이드 중 접촉이 끊겼을 때 재확인 스윕 거리(캡슐 반경 바깥)
 
 	UPROPERTY(EditDefaultsOnly, Category="Mario|Wall")
 	float WallTraceRadius = 12.f; // 보조 스윕 반지름
@@ -257,10 +260,17 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category="Mario|Wall")
 	float WallKickStateDuration = 0.1f; // WallKick 상태 유지 시간(AnimBP에서 KickJump 재생용)
 
-	FTimerHandle WallKickStateTimer;
-	//EndOverlap 순간에 바로 Reset되지 않도록 유예(회전 고정/박스 얇음 때문에 바로 EndOverlap 나는 케이스 방지)
+	// 마지막 벽 충돌 후 이 시간까지는 접촉 유지로 본다(프레임 미세 분리로 슬라이드가 끊기지 않게)
+	UPROPERTY(EditDefaultsOnly, Category="Mario|Wall")
+	float WallContactGraceTime = 0.08f;
+
+	// 슬라이드 중 새 충돌 노멀과 현재 노멀의 수평 내적이 이 값 미만일 때만 노멀 교체(코너)
+	UPROPERTY(EditDefaultsOnly, Category="Mario|Wall")
+	float WallNormalSwitchDot = 0.94f;
+
+	// 슬라이드 중 벽 쪽으로 유지하는 속도(이동 스윕이 매 프레임 벽과 충돌해 접촉이 갱신되도록)
 	UPROPERTY(EditDefaultsOnly, Category="Mario|Wall")
-	float WallEndOverlapGraceTime = 0.08f;
+	float WallSlideStickSpeed = 30.f;
 
 	UPROPERTY(EditDefaultsOnly, Category="Mario|Wall")
 	float WallKickMinReenterDelay = 0.06f; // WallKick 직후 같은 벽 즉시 재포획 방지 (연속 킥 가능)
@@ -289,10 +299,6 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category="Mario|Wall")
 	float WallSlideDownSpeed = 220.f; // 슬라이드 하강 속도- 가속 없이 일정
 	
-	FTimerHandle WallKickInputLockTimer;
-
-	FTimerHandle WallEndOverlapGraceTimer;
-	
 	float WallKickStartTime = -1000.f; // WallKick 시작 시각
 	bool bWallKickInputLocked = false;
 	
@@ -301,14 +307,58 @@ protected:
 	
 	//ledge action
 	UPROPERTY(BlueprintReadOnly, Category="State|Ledge", meta=(AllowPrivateAccess="true"))
-	ELedgeState LedgeActionState = ELedgeState::None;
+	ELedgeState LedgeActionState = ELedgeState::None; // AnimBP 호환 미러
+
+	UPROPERTY(EditDefaultsOnly, Category="Mario|Ledge")
+	float LedgeGrabReach = 30.f; // 손(LedgeDetector) ~ 모서리 수평 거리 상한. 높이 창은 LedgeDetector 박스 Z
+
+	UPROPERTY(EditDefaultsOnly, Category="Mario|Ledge")
+	float LedgeGrabMinFacingDot = 0.5f; // 정면이 모서리 쪽을 이 이상 향해야 잡음
+
+	UPROPERTY(EditDefaultsOnly, Category="Mario|Ledge")
+	float LedgeEdgeMargin = 20.f; // 모서리 양 끝 잡기/이동 금지 구간
+
+	UPROPERTY(EditDefaultsOnly, Category="Mario|Ledge")
+	float LedgeConfirmHeight = 30.f; // 확인 트레이스 시작 높이(모서리 위)
+
+	UPROPERTY(EditDefaultsOnly, Category="Mario|Ledge")
+	float LedgeConfirmInset = 15.f; // 확인 트레이스를 모서리 안쪽으로 들이는 거리
+
+	UPROPERTY(EditDefaultsOnly, Category="Mario|Ledge")
+	float LedgeConfirmTolerance = 10.f; // 캐시 높이와 실제 윗면 높이 허용 오차
+
+	UPROPERTY(EditDefaultsOnly, Category="Mario|Ledge")
+	float LedgeHangWallOffset = 40.f; // 매달렸을 때 캡슐 중심 ~ 모서리 수평 거리
+
+	UPROPERTY(EditDefaultsOnly, Category="Mario|Ledge")
+	float LedgeHangDownOffset = 80.f; // 매달렸을 때 캡슐 중심이 모서리보다 아래인 거리
+
+	UPROPERTY(EditDefaultsOnly, Category="Mario|Ledge")
+	float LedgeHangStartDuration = 0.3f; // HangStart -> HangLoop 전이 시간
+
+	UPROPERTY(EditDefaultsOnly, Category="Mario|Ledge")
+	float LedgeShimmySpeed = 150.f; // 좌우 이동 속도
+
+	UPROPERTY(EditDefaultsOnly, Category="Mario|Ledge")
+	float LedgeShimmyDeadZone = 0.3f; // 모서리 방향 입력 성분이 이 이하면 정지
+
+	UPROPERTY(EditDefaultsOnly, Category="Mario|Ledge")
+	float LedgeClimbDuration = 0.45f; // ClimbEnd 애니 길이(끝나면 윗면으로 이동)
+
+	UPROPERTY(EditDefaultsOnly, Category="Mario|Ledge")
+	float LedgeClimbInset = 10.f; // 올라선 위치를 모서리 안쪽으로 들이는 거리(캡슐 반경 외)
+
+	UPROPERTY(EditDefaultsOnly, Category="Mario|Ledge")
+	float LedgeRegrabDelay = 0.3f; // 놓은 직후 재잡기 금지 시간
+
+	float LedgeRegrabTime = -1.f; // 이 시각 이후부터 다시 잡을 수 있음
 	
 	//구르기
 	UPROPERTY(BlueprintReadOnly, Category="State|Roll", meta=(AllowPrivateAccess="true"))
-	bool bIsRolling = false;
+	bool bIsRolling = false; // AnimBP 호환 미러
 
 	UPROPERTY(BlueprintReadOnly, Category="State|Roll", meta=(AllowPrivateAccess="true"))
-	ERollPhase RollPhase = ERollPhase::None;
+	ERollPhase RollPhase = ERollPhase::None; // AnimBP 호환 미러
 
 	UPROPERTY(BlueprintReadOnly, Category="State|Roll", meta=(AllowPrivateAccess="true"))
 	FVector RollDirection = FVector::ZeroVector;
@@ -348,15 +398,13 @@ protected:
 
 	float RollStartForceInputRemaining = 0.f; // 시작 강제 추진 타이머
 	
-	FTimerHandle RollPhaseTimer;
-	
 	float DefaultGroundFriction = 8.f; // 이동값 캐싱 
 	float DefaultBrakingDecelWalking = 2048.f;
 	float DefaultBrakingFrictionFactor = 2.f;
 
 	FVector2D CachedMoveInput = FVector2D::ZeroVector;// move 입력 저장
 	
-	//엉덩방아
+	//엉덩방아 (아래 bool들은 State에서 파생되는 AnimBP 호환 미러)
 	UPROPERTY(BlueprintReadOnly, Category = "State|GroundPound", meta=(AllowPrivateAccess="true"))
 	bool bIsGroundPoundPreparing = false; // 공중제비 중
 	UPROPERTY(BlueprintReadOnly, Category = "State|GroundPound", meta=(AllowPrivateAccess="true"))
@@ -386,12 +434,9 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category = "GroundPound")
 	float PoundJumpZVelocity = 1200.f; //반동점프 크기
 	
-	FTimerHandle GroundPoundPrepareTimer;
-	FTimerHandle GroundPoundStunTimer;
-	
 	// 다이브
 	UPROPERTY(BlueprintReadOnly, Category="State|Dive", meta=(AllowPrivateAccess="true"))
-	bool bIsDiving = false;
+	bool bIsDiving = false; // AnimBP 호환 미러
 
 	UPROPERTY(EditDefaultsOnly, Category="Mario|Dive")
 	float Dive_ForwardStrength = 1100.f;
@@ -437,6 +482,26 @@ protected:
 	float DownhillBoostAlpha = 0.f;         // 0~1
 
 	float DownhillHoldRemaining = 0.f;
+
+	FMarioSlopeCache DownhillSlopeCache;
+
+	// 얼음 타일 위 미끄러짐(UIceTileGridSubsystem 격자 조회, 바닥 위치는 CMC CurrentFloor 재사용)
+	UPROPERTY(EditDefaultsOnly, Category="Mario|Ice")
+	float IceGroundFriction = 0.5f;
+
+	UPROPERTY(EditDefaultsOnly, Category="Mario|Ice")
+	float IceBrakingDecelWalking = 256.f;
+
+	UPROPERTY(EditDefaultsOnly, Category="Mario|Ice")
+	float IceBrakingFrictionFactor = 0.25f;
+
+	UPROPERTY(BlueprintReadOnly, Category="State|Ice", meta=(AllowPrivateAccess="true"))
+	bool bOnIceFloor = false;
+
+	// 얼음 진입 직전 값(벗어날 때 복원). 얼음은 이 기본값 위에 덮어쓰는 보정이라 롤 진입 시에도 이 값을 기본값으로 저장
+	float PreIceGroundFriction = 8.f;
+	float PreIceBrakingDecelWalking = 2048.f;
+	float PreIceBrakingFrictionFactor = 2.f;
 	
 	//HP
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Mario|HP", meta=(AllowPrivateAccess="true"))
@@ -525,6 +590,7 @@ protected:
 	void OnCrouchReleased(const FInputActionValue& Value);
 	void UpdateDownhillBoost(float DeltaSeconds);
 	void ForceDisableDownhillBoost(float DeltaSeconds);
+	void UpdateIceFloor();
 	
 	void OnJumpPressed();//점프
 	void OnRunPressed();//달리기
@@ -532,51 +598,59 @@ protected:
 	void OnGroundPoundPressed();//엉덩방아
 	void BeginCrouchHold();//웅크리기
 	void EndCrouchHold();//웅크리기
-	void TryCrouchDerivedJump();//분기(롱/백텀블) 시도
+	bool TryCrouchDerivedJump();//분기(롱/백텀블) 시도, 발동하면 true
 	void DoLongJump();//롱점프
 	void DoBackflip();//백덤블링
 	void StartDiveFromCurrentContext();//다이브 시작
 	void EndDive();//다이브 끝
 	void ThrowCap();// 캐피 액션 모자 던지기
-	UFUNCTION()
-	void OnCapDestroyed(AActor* DestroyedActor);
+	AMarioCapProjectile* EnsureCapActor();
+	void OnCapRetired(ECapRetireReason Reason);
 	// 구르기
 	bool CanStartRoll() const;
 	FVector ComputeRollDirection() const;
 	void StartRoll();
-	void EnterRollLoop();
 	void BeginRollEnd();
 	void FinishRoll();    // 정상 종료(End 애니 포함)
 	void AbortRoll(bool bForceStandUp);     // 즉시 종료
-	void EndRollInternal(bool bForceStandUp);
 	
 	//wall action
 	bool IsWallActionCandidate() const;
-	bool TryGetWallHitFromDetector(const FHitResult& SweepResult, FHitResult& OutHit) const;
-	bool PassesWallFilters(const FHitResult& WallHit) const;
+	bool SweepForWall(const FVector& Dir, FHitResult& OutHit) const;
+	bool PassesWallFilters(const FHitResult& WallHit, const FVector& ApproachVelocity) const;
 
 	void StartWallSlide(const FHitResult& WallHit);
-	void EnterWallSlideLoop();
 	void ResetWallSlide();
 	
 	void ApplyWallSlideMovementSettings(bool bEnable);
 	void UpdateWallSlidePhysics(float DeltaTime);
 	
 	void ExecuteWallKick();
-	void EndWallKickState();
 	
 	void BeginWallKickInputLock();
 	void EndWallKickInputLock();
 	void CancelWallKickForSlideEntry();
 	
-	void TryEnterWallSlideFromCurrentOverlap();
-	
-	// EndOverlap 이후 유예시간 뒤 실제로 벽이 떨어졌는지 재검증
-	void ConfirmWallContactAfterEndOverlap();
+	// 벽 접촉: CharacterMovement 이동 스윕 충돌(MoveBlockedBy)을 기록해 두고 Tick에서 1회 판정
+	void UpdateWallContact();
+	void UpdateWallNormalFromContact();
+	bool HasRecentWallContact() const;
+
+	FHitResult WallContactHit;
+	FVector WallContactVelocity = FVector::ZeroVector; // 충돌 직전 속도(정면 접근 판정용)
+	float WallContactTime = -1.f;
 	
 	void FaceDirection2D(const FVector& Dir);
 	void FaceWallFromNormal(const FVector& WallNormal);
 	void FaceAwayFromNormal(const FVector& WallNormal);
+
+	// ledge: 낙하 중 격자 조회 + 확인 트레이스 1회로 잡기
+	bool IsLedgeGrabCandidate() const;
+	void UpdateLedgeGrab();
+	bool ConfirmLedgeTop(const FVector& EdgePoint, const FVector& EdgeNormal) const;
+	void BeginLedgeHang(const FLedgeGrabResult& Edge);
+	FVector GetLedgeHangLocation() const;
+	void FinishLedgeClimb();
 	//헬퍼
 	void ApplyMoveSpeed();
 	float GetBaseMoveSpeed() const; // 
@@ -590,17 +664,83 @@ public:
 	virtual float TakeDamage(float DamageAmount, struct FDamageEvent const& DamageEvent,
 							 class AController* EventInstigator, AActor* DamageCauser) override;
 	virtual void FellOutOfWorld(const class UDamageType& dmgType) override;
+	virtual void MoveBlockedBy(const FHitResult& Impact) override;
 	//캡쳐 카메라 세팅
 	virtual FRotator GetViewRotation() const override;
 	void SetCaptureControlRotationOverride(bool bEnable);
 	void SetCaptureControlRotation(const FRotator& InRot);
 	void CaptureFeedLookInput(const FInputActionValue& Value);
 	void CaptureSyncTargetControlRotation(const FRotator& InRot);
-	void CaptureTickCamera(float DeltaTime, APlayerController* PC);
+
+	// 카메라 매니저(AMarioPlayerCameraManager)가 고정 스텝으로 따라가는 목표 회전/리그
+	const FRotator& GetCameraTargetRotation() const { return TargetControlRotation; }
+	float GetCameraRotationInterpSpeed() const { return CameraRotationInterpSpeed; }
+	USpringArmComponent* GetCameraBoom() const { return SpringArm; }
+	UCameraComponent* GetFollowCamera() const { return FollowCamera; }
 	
+	// 벤치마크(UMarioBenchmarkSubsystem)가 설정하면 Tick 구간별 비용을 누적한다
+	void SetBenchTimings(FMarioBenchTimings* InTimings) { BenchTimings = InTimings; }
+
+	// 벤치마크/입력 리플레이용
+	const UInputMappingContext* GetPlayerMappingContext() const { return IMC_Player; }
+	const UInputAction* GetMoveAction() const { return IA_Move; }
+	const UInputAction* GetJumpAction() const { return IA_Jump; }
+	const UInputAction* GetCrouchAction() const { return IA_Crouch; }
+	const UInputAction* GetRunAction() const { return IA_Run; }
+	const UInputAction* GetThrowCapAction() const { return IA_ThrowCap; }
+	AMarioCapProjectile* GetCapActor() const { return CapActor; }
+
 private:
+	// 개발 빌드 모자 풀 벤치(mario.CapThrowStress)가 ThrowCap을 직접 부르기 위한 접근자(MarioCapProjectile.cpp)
+	friend struct FMarioCapBenchAccess;
+
 	FMarioState State;
 
+	// AnimBP가 읽는 단일 상태 워드(레이아웃은 MarioAnimWord 참고)
+	UPROPERTY(BlueprintReadOnly, Category="State", meta=(AllowPrivateAccess="true"))
+	int32 AnimStateWord = 0;
+
+	typedef TMarioStateDesc<AMarioCharacter> FMoveStateDesc;
+	typedef TMarioStateGroupDesc<AMarioCharacter> FMoveGroupDesc;
+
+	static const FMoveStateDesc& GetMoveStateDesc(EMarioMoveState InState);
+	static const FMoveGroupDesc& GetMoveGroupDesc(EMarioStateGroup InGroup);
+
+	// 상태 전이는 전부 여기를 거친다(Exit -> 그룹 Exit -> 그룹 Enter -> Enter)
+	void ChangeMoveState(EMarioMoveState NewState);
+	void ResetMoveState();
+	void TickMoveState(float DeltaSeconds);
+	void RefreshAnimState();
+
+	EMarioStateGroup GetMoveStateGroup() const { return GetMoveStateDesc(State.MoveState).Group; }
+	bool HasMoveStateFlag(EMarioStateFlags Flag) const { return EnumHasAnyFlags(GetMoveStateDesc(State.MoveState).Flags, Flag); }
+	bool IsRolling() const { return GetMoveStateGroup() == EMarioStateGroup::Roll; }
+	bool IsWallSliding() const { return State.MoveState == EMarioMoveState::WallSlideStart || State.MoveState == EMarioMoveState::WallSlideLoop; }
+	bool IsGroundPoundAirborne() const { return State.MoveState == EMarioMoveState::GroundPoundPrepare || State.MoveState == EMarioMoveState::GroundPound; }
+
+	// 상태 훅
+	void EnterRollGroup(EMarioMoveState PrevState);
+	void ExitRollGroup(EMarioMoveState NextState);
+	void TickRoll(float DeltaSeconds);
+	void EnterAirGroup(EMarioMoveState PrevState);
+	void ExitDive(EMarioMoveState NextState);
+	void EnterGroundPoundPrepare(EMarioMoveState PrevState);
+	void ExitGroundPoundPrepare(EMarioMoveState NextState);
+	void EnterGroundPound(EMarioMoveState PrevState);
+	void EnterGroundPoundStun(EMarioMoveState PrevState);
+	void ExitGroundPoundStun(EMarioMoveState NextState);
+	void EnterWallGroup(EMarioMoveState PrevState);
+	void ExitWallGroup(EMarioMoveState NextState);
+	void EnterWallSlideStart(EMarioMoveState PrevState);
+	void EnterWallSlideLoop(EMarioMoveState PrevState);
+	void ExitWallSlide(EMarioMoveState NextState);
+	void TickWallSlide(float DeltaSeconds);
+	void EnterLedgeGroup(EMarioMoveState PrevState);
+	void ExitLedgeGroup(EMarioMoveState NextState);
+	void TickLedgeHang(float DeltaSeconds);
+
+	FMarioBenchTimings* BenchTimings = nullptr;
+
 	bool IsMonsterActor(AActor* OtherActor, UPrimitiveComponent* OtherComp) const;
 	bool IsPostCaptureInvulnActive() const;
 	
@@ -611,13 +751,18 @@ private:
 	void FinishDeathSequence();
 	void ForceBlackFade(float FromAlpha, float ToAlpha, float DurationSeconds);
 
-	FTimerHandle DeathAnimLeadTimer;
-	FTimerHandle DeathFadeInTimer;
-	FTimerHandle DeathFadeOutTimer;
-
 	// ===== Level Travel Fade Unlock =====
-	FTimerHandle TravelFadeUnlockTimer;
 	void EndTravelFadeUnlock();
+
+	// 사망 연출/트래블 페이드 예약(월드 타이머 대신 마리오 Tick에서 진행)
+	enum class ETimelineTag : uint8
+	{
+		DeathAnimLead,
+		DeathFadeIn,
+		DeathFadeOut,
+		TravelFadeUnlock,
+	};
+	TActorTimeline<AMarioCharacter, ETimelineTag, 4> Timeline;
 	
 	//캡쳐 카메라 세팅
 	bool bCaptureControlRotOverride = false;
@@ -625,7 +770,6 @@ private:
 	
 	//마리오 피격 스턴
 	bool bInputLocked = false;
-	FTimerHandle HitStunTimer;
 	void ClearHitStun();
 
 	UPROPERTY(EditDefaultsOnly, Category="Mario|Damage", meta=(ClampMin="0.0"))
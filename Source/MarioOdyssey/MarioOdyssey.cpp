@@ -1,7 +1,40 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "MarioOdyssey.h"
+#include "MarioOdysseyStats.h"
 #include "Modules/ModuleManager.h"
 
+DEFINE_STAT(STAT_MarioOdyssey_MarioTick);
+DEFINE_STAT(STAT_MarioOdyssey_BossTick);
+DEFINE_STAT(STAT_MarioOdyssey_BossPhase1);
+DEFINE_STAT(STAT_MarioOdyssey_BossRetreat);
+DEFINE_STAT(STAT_MarioOdyssey_BossReturnToCenter);
+DEFINE_STAT(STAT_MarioOdyssey_BossPhase2);
+DEFINE_STAT(STAT_MarioOdyssey_BossPhase3Clap);
+DEFINE_STAT(STAT_MarioOdyssey_FistTick);
+DEFINE_STAT(STAT_MarioOdyssey_GoombaStackPresentation);
+DEFINE_STAT(STAT_MarioOdyssey_BgmPollZones);
+DEFINE_STAT(STAT_MarioOdyssey_IceShardOverlap);
+DEFINE_STAT(STAT_MarioOdyssey_CameraUpdate);
+DEFINE_STAT(STAT_MarioOdyssey_CaptureBegin);
+DEFINE_STAT(STAT_MarioOdyssey_CaptureRelease);
+DEFINE_STAT(STAT_MarioOdyssey_ArenaResetSlice);
+DEFINE_STAT(STAT_MarioOdyssey_ArenaHeightfieldSlice);
+
+DEFINE_STAT(STAT_MarioOdyssey_ActorSpawns);
+DEFINE_STAT(STAT_MarioOdyssey_ActorDestroys);
+DEFINE_STAT(STAT_MarioOdyssey_PoolAcquires);
+DEFINE_STAT(STAT_MarioOdyssey_IceTileInstanceAdds);
+DEFINE_STAT(STAT_MarioOdyssey_SceneQueries);
+DEFINE_STAT(STAT_MarioOdyssey_TimersSet);
+DEFINE_STAT(STAT_MarioOdyssey_TimelineSchedules);
+
+#if !UE_BUILD_SHIPPING
+FMarioTimerOpCounters GMarioTimerOps;
+#endif
+
+UE_TRACE_CHANNEL_DEFINE(MarioOdysseyChannel);
+
+DEFINE_LOG_CATEGORY(LogMarioBench);
+
 IMPLEMENT_PRIMARY_GAME_MODULE( FDefaultGameModuleImpl, MarioOdyssey, "MarioOdyssey" );
- 
\ No newline at end of file
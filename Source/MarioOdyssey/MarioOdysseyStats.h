@@ -0,0 +1,73 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+/**
+ * 게임플레이 핫패스 프로파일링.
+ * - 콘솔 `stat MarioOdyssey` : 사이클/카운터 표시
+ * - Unreal Insights : `-trace=cpu,MarioOdyssey` 로 실행하면 MarioOdyssey 채널 CPU 스코프가 기록된다
+ */
+DECLARE_STATS_GROUP(TEXT("MarioOdyssey"), STATGROUP_MarioOdyssey, STATCAT_Advanced);
+
+// 사이클
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Mario Tick"), STAT_MarioOdyssey_MarioTick, STATGROUP_MarioOdyssey, MARIOODYSSEY_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Boss Tick"), STAT_MarioOdyssey_BossTick, STATGROUP_MarioOdyssey, MARIOODYSSEY_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Boss UpdatePhase1"), STAT_MarioOdyssey_BossPhase1, STATGROUP_MarioOdyssey, MARIOODYSSEY_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Boss UpdateRetreat"), STAT_MarioOdyssey_BossRetreat, STATGROUP_MarioOdyssey, MARIOODYSSEY_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Boss ReturnToCenter"), STAT_MarioOdyssey_BossReturnToCenter, STATGROUP_MarioOdyssey, MARIOODYSSEY_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Boss UpdatePhase2"), STAT_MarioOdyssey_BossPhase2, STATGROUP_MarioOdyssey, MARIOODYSSEY_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Boss UpdatePhase3Clap"), STAT_MarioOdyssey_BossPhase3Clap, STATGROUP_MarioOdyssey, MARIOODYSSEY_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Fist Tick"), STAT_MarioOdyssey_FistTick, STATGROUP_MarioOdyssey, MARIOODYSSEY_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Goomba UpdateStackPresentation"), STAT_MarioOdyssey_GoombaStackPresentation, STATGROUP_MarioOdyssey, MARIOODYSSEY_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Bgm PollZones"), STAT_MarioOdyssey_BgmPollZones, STATGROUP_MarioOdyssey, MARIOODYSSEY_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("IceShard OnBeginOverlap"), STAT_MarioOdyssey_IceShardOverlap, STATGROUP_MarioOdyssey, MARIOODYSSEY_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Camera Update"), STAT_MarioOdyssey_CameraUpdate, STATGROUP_MarioOdyssey, MARIOODYSSEY_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Capture Begin"), STAT_MarioOdyssey_CaptureBegin, STATGROUP_MarioOdyssey, MARIOODYSSEY_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Capture Release"), STAT_MarioOdyssey_CaptureRelease, STATGROUP_MarioOdyssey, MARIOODYSSEY_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Arena Reset Slice"), STAT_MarioOdyssey_ArenaResetSlice, STATGROUP_MarioOdyssey, MARIOODYSSEY_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Arena Heightfield Slice"), STAT_MarioOdyssey_ArenaHeightfieldSlice, STATGROUP_MarioOdyssey, MARIOODYSSEY_API);
+
+// 프레임당 카운터(매 프레임 0으로 리셋)
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Actor Spawns"), STAT_MarioOdyssey_ActorSpawns, STATGROUP_MarioOdyssey, MARIOODYSSEY_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Actor Destroys"), STAT_MarioOdyssey_ActorDestroys, STATGROUP_MarioOdyssey, MARIOODYSSEY_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Pool Acquires"), STAT_MarioOdyssey_PoolAcquires, STATGROUP_MarioOdyssey, MARIOODYSSEY_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("IceTile Instance Adds"), STAT_MarioOdyssey_IceTileInstanceAdds, STATGROUP_MarioOdyssey, MARIOODYSSEY_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Scene Queries"), STAT_MarioOdyssey_SceneQueries, STATGROUP_MarioOdyssey, MARIOODYSSEY_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Timers Set"), STAT_MarioOdyssey_TimersSet, STATGROUP_MarioOdyssey, MARIOODYSSEY_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Timeline Schedules"), STAT_MarioOdyssey_TimelineSchedules, STATGROUP_MarioOdyssey, MARIOODYSSEY_API);
+
+UE_TRACE_CHANNEL_EXTERN(MarioOdysseyChannel, MARIOODYSSEY_API);
+
+// 개발용 벤치 커맨드/mario.Bench 공용 로그(Dev/MarioBenchCommand.h)
+MARIOODYSSEY_API DECLARE_LOG_CATEGORY_EXTERN(LogMarioBench, Log, All);
+
+// stat 사이클 + Insights CPU 스코프를 한 번에
+#define MARIO_SCOPE_CYCLE(StatId) \
+	SCOPE_CYCLE_COUNTER(StatId); \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(StatId, MarioOdysseyChannel)
+
+// 씬 쿼리/SetTimer 카운트는 MarioSceneQuery.h / MarioTimers.h 래퍼 안에서만 올린다(호출부 매크로 없음)
+
+// 누적 타이머 연산 수(stat 비활성 빌드에서도 벤치마크가 초당 연산 수를 계산하도록 별도 유지, 게임 스레드 전용).
+// 벤치마크 전용이라 Shipping에는 없다
+struct FMarioTimerOpCounters
+{
+	uint64 HeapSets = 0;          // FTimerManager::SetTimer
+	uint64 TimelineSchedules = 0; // TActorTimeline::Schedule
+	uint64 TimelineCancels = 0;   // TActorTimeline::Cancel
+};
+
+#if !UE_BUILD_SHIPPING
+extern MARIOODYSSEY_API FMarioTimerOpCounters GMarioTimerOps;
+
+#define MARIO_COUNT_TIMER_SET() do { INC_DWORD_STAT(STAT_MarioOdyssey_TimersSet); ++GMarioTimerOps.HeapSets; } while (0)
+#define MARIO_COUNT_TIMELINE_SCHEDULE() do { INC_DWORD_STAT(STAT_MarioOdyssey_TimelineSchedules); ++GMarioTimerOps.TimelineSchedules; } while (0)
+#define MARIO_COUNT_TIMELINE_CANCEL() ++GMarioTimerOps.TimelineCancels
+#else
+#define MARIO_COUNT_TIMER_SET() INC_DWORD_STAT(STAT_MarioOdyssey_TimersSet)
+#define MARIO_COUNT_TIMELINE_SCHEDULE() INC_DWORD_STAT(STAT_MarioOdyssey_TimelineSchedules)
+#define MARIO_COUNT_TIMELINE_CANCEL()
+#endif
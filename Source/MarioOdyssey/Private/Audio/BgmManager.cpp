@@ -1,6 +1,9 @@
 #include "Audio/BgmManager.h"
 
 #include "Audio/BgmZoneTrigger.h"
+#include "World/ActorRegistrySubsystem.h"
+#include "MarioOdyssey/MarioOdysseyStats.h"
+#include "MarioTimers.h"
 
 #include "Components/AudioComponent.h"
 #include "Sound/SoundBase.h"
@@ -8,6 +11,12 @@
 #include "TimerManager.h"
 #include "GameFramework/PlayerController.h"
 
+namespace
+{
+	// 0 볼륨 스템이 정지/가상화되어 다른 스템과 싱크가 어긋나지 않도록 유지하는 최소 볼륨
+	constexpr float StemSilentVolume = 0.001f;
+}
+
 ABgmManager::ABgmManager()
 {
 	PrimaryActorTick.bCanEverTick = false;
@@ -28,10 +37,26 @@ ABgmManager::ABgmManager()
 	AudioB->bIsUISound = true;
 }
 
+ABgmManager* ABgmManager::Get(const UObject* WorldContextObject)
+{
+	const UActorRegistrySubsystem* Registry = UActorRegistrySubsystem::Get(WorldContextObject);
+	if (!Registry) return nullptr;
+
+	TArray<ABgmManager*> Managers;
+	Registry->GetActorsOfClass(Managers);
+	return Managers.Num() > 0 ? Managers[0] : nullptr;
+}
+
 void ABgmManager::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// 보스 아레나/시작 연출이 월드 탐색 없이 찾도록 등록
+	UActorRegistrySubsystem::AutoRegister(this);
+
+	BuildVoicePool();
+	PrimeTrack(DefaultTrack);
+
 	CacheZonesOnce();
 	StartPollingIfEnabled();
 
@@ -50,6 +75,13 @@ void ABgmManager::BeginPlay()
 
 void ABgmManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	if (UActorRegistrySubsystem* Registry = UActorRegistrySubsystem::Get(this))
+	{
+		Registry->OnRegisteredActorChanged.Remove(ZoneRegistryHandle);
+	}
+	ZoneRegistryHandle.Reset();
+	UActorRegistrySubsystem::AutoUnregister(this);
+
 	StopPolling();
 	Super::EndPlay(EndPlayReason);
 }
@@ -65,8 +97,8 @@ void ABgmManager::RequestTrack(USoundBase* NewTrack, float FadeSeconds)
 
 // 수동 전환: 구역 스택을 비우고 이 트랙으로 고정
 	ActiveZones.Reset();
-	InsideZones.Reset();
-	PruneInvalidZones();
+	InsideZoneIds.Reset();
+	RequestPoll();
 
 	CrossFadeTo(NewTrack, FadeSeconds);
 }
@@ -83,15 +115,10 @@ void ABgmManager::SetSuppressed(bool bInSuppressed, float FadeSeconds)
 	if (bSuppressed)
 	{
 		// 즉시/페이드로 음을 끄고, 트랙 전환은 모두 막는다.
-		if (AudioA && AudioA->IsPlaying())
-		{
-			if (FadeSeconds > 0.f) AudioA->FadeOut(FadeSeconds, 0.0f);
-			else AudioA->Stop();
-		}
-		if (AudioB && AudioB->IsPlaying())
+		FadeOutAllVoices(FadeSeconds);
+		if (bStemsActive)
 		{
-			if (FadeSeconds > 0.f) AudioB->FadeOut(FadeSeconds, 0.0f);
-			else AudioB->Stop();
+			StopStems(FadeSeconds);
 		}
 		CurrentTrack = nullptr;
 		return;
@@ -103,10 +130,22 @@ void ABgmManager::SetSuppressed(bool bInSuppressed, float FadeSeconds)
 
 void ABgmManager::EnterZone(ABgmZoneTrigger* Zone)
 {
-	if (!IsValid(Zone)) return;
-	if (!Zone->ZoneTrack) return;
+	AddActiveZone(Zone);
+	UpdateDesiredTrack();
+}
 
-	PruneInvalidZones();
+void ABgmManager::ExitZone(ABgmZoneTrigger* Zone)
+{
+	if (RemoveActiveZone(Zone))
+	{
+		UpdateDesiredTrack();
+	}
+}
+
+bool ABgmManager::AddActiveZone(ABgmZoneTrigger* Zone)
+{
+	if (!IsValid(Zone)) return false;
+	if (!Zone->ZoneTrack) return false;
 
 	// 이미 들어와 있으면 EnterOrder만 갱신(=같은 우선순위일 때 최신 우선)
 	for (FZoneEntry& E : ActiveZones)
@@ -115,8 +154,7 @@ void ABgmManager::EnterZone(ABgmZoneTrigger* Zone)
 		{
 			E.EnterOrder = ++EnterOrderCounter;
 			E.Priority = Zone->Priority;
-			UpdateDesiredTrack();
-			return;
+			return true;
 		}
 	}
 
@@ -125,22 +163,17 @@ void ABgmManager::EnterZone(ABgmZoneTrigger* Zone)
 	NewEntry.Priority = Zone->Priority;
 	NewEntry.EnterOrder = ++EnterOrderCounter;
 	ActiveZones.Add(NewEntry);
-
-	UpdateDesiredTrack();
+	return true;
 }
 
-void ABgmManager::ExitZone(ABgmZoneTrigger* Zone)
+bool ABgmManager::RemoveActiveZone(ABgmZoneTrigger* Zone)
 {
-	if (!IsValid(Zone)) return;
-
-	PruneInvalidZones();
+	if (!IsValid(Zone)) return false;
 
-	ActiveZones.RemoveAll([Zone](const FZoneEntry& E)
+	return ActiveZones.RemoveAll([Zone](const FZoneEntry& E)
 	{
 		return E.Zone.Get() == Zone;
-	});
-
-	UpdateDesiredTrack();
+	}) > 0;
 }
 
 void ABgmManager::UpdateDesiredTrack()
@@ -150,8 +183,7 @@ void ABgmManager::UpdateDesiredTrack()
 		return;
 	}
 
-PruneInvalidZones();
-
+	// 무효 구역은 PickBestZone에서 건너뛰고, 스택 정리는 구역 해제 시점에만 한다.
 	int32 BestPri = 0;
 	float BestFade = DefaultFadeSeconds;
 	ABgmZoneTrigger* BestZone = PickBestZone(BestPri, BestFade);
@@ -198,20 +230,28 @@ ABgmZoneTrigger* ABgmManager::PickBestZone(int32& OutPriority, float& OutFadeSec
 
 void ABgmManager::CrossFadeTo(USoundBase* NewTrack, float FadeSeconds)
 {
+	if (bStemsActive)
+	{
+		// 스템 재생 중에는 구역 전환을 기억만 해두고 StopStems에서 적용
+		TrackAfterStems = NewTrack;
+		FadeAfterStems = FadeSeconds;
+		return;
+	}
+
 	if (!NewTrack)
 	{
-		// 트랙이 없으면 둘 다 정지
-		if (AudioA && AudioA->IsPlaying()) AudioA->FadeOut(FadeSeconds, 0.0f);
-		if (AudioB && AudioB->IsPlaying()) AudioB->FadeOut(FadeSeconds, 0.0f);
+		// 트랙이 없으면 전부 정지
+		FadeOutAllVoices(FadeSeconds);
+		ActiveVoice = INDEX_NONE;
 		CurrentTrack = nullptr;
 		return;
 	}
 
 	// 이미 같은 트랙이면 "재시작"하지 않는다
-	if (CurrentTrack == NewTrack)
+	if (CurrentTrack == NewTrack && Voices.IsValidIndex(ActiveVoice))
 	{
 		// 혹시 정지된 상태면 다시 재생(이 경우에만 처음부터 재생될 수 있음)
-		UAudioComponent* Active = bUsingA ? AudioA : AudioB;
+		UAudioComponent* Active = Voices[ActiveVoice];
 		if (Active && !Active->IsPlaying())
 		{
 			Active->SetSound(NewTrack);
@@ -220,39 +260,261 @@ void ABgmManager::CrossFadeTo(USoundBase* NewTrack, float FadeSeconds)
 		return;
 	}
 
-	UAudioComponent* From = bUsingA ? AudioA : AudioB;
-	UAudioComponent* To   = bUsingA ? AudioB : AudioA;
+	const int32 ToIndex = AcquireVoiceFor(NewTrack);
+	UAudioComponent* To = Voices.IsValidIndex(ToIndex) ? Voices[ToIndex].Get() : nullptr;
+	if (!To) return;
+
+	FVoiceState& ToState = VoiceStates[ToIndex];
+	if (ToState.Track == NewTrack && To->IsPlaying())
+	{
+		// 페이드아웃 중이던 같은 트랙: 재시작 없이 볼륨만 되돌림(AdjustVolume은 정지 예약도 해제)
+		To->AdjustVolume(FadeSeconds, 1.0f);
+	}
+	else
+	{
+		To->SetSound(NewTrack);
+
+		// To: 페이드 인
+		To->Play(0.f);
+		if (FadeSeconds > 0.f)
+		{
+			To->FadeIn(FadeSeconds, 1.0f, 0.0f);
+		}
+		else
+		{
+			To->SetVolumeMultiplier(1.0f);
+		}
+
+		ToState.Track = NewTrack;
+		ToState.StartTime = GetWorld() ? GetWorld()->GetAudioTimeSeconds() : 0.0;
+	}
+	ToState.bFadingOut = false;
+
+	// 나머지: 페이드 아웃(이미 페이드아웃 중인 보이스는 그대로 진행)
+	for (int32 i = 0; i < Voices.Num(); ++i)
+	{
+		if (i != ToIndex)
+		{
+			FadeOutVoice(i, FadeSeconds);
+		}
+	}
+
+	ActiveVoice = ToIndex;
+	CurrentTrack = NewTrack;
+}
+
+void ABgmManager::BuildVoicePool()
+{
+	Voices.Reset();
+	Voices.Add(AudioA);
+	Voices.Add(AudioB);
+
+	for (int32 i = Voices.Num(); i < VoiceCount; ++i)
+	{
+		Voices.Add(CreateVoice(*FString::Printf(TEXT("BgmVoice%d"), i)));
+	}
+
+	Voices.RemoveAll([](const TObjectPtr<UAudioComponent>& V)
+	{
+		return V == nullptr;
+	});
+
+	VoiceStates.Reset();
+	VoiceStates.SetNum(Voices.Num());
+	ActiveVoice = INDEX_NONE;
+}
+
+UAudioComponent* ABgmManager::CreateVoice(FName Name)
+{
+	UAudioComponent* Voice = NewObject<UAudioComponent>(this, Name);
+	if (!Voice) return nullptr;
+
+	Voice->SetupAttachment(Root);
+	Voice->bAutoActivate = false;
+	Voice->bAllowSpatialization = false;
+	Voice->bIsUISound = true;
+	Voice->RegisterComponent();
+	return Voice;
+}
+
+int32 ABgmManager::AcquireVoiceFor(USoundBase* Track)
+{
+	// 1) 같은 트랙을 아직 재생 중인 보이스(페이드아웃 중) -> 되살리기
+	for (int32 i = 0; i < Voices.Num(); ++i)
+	{
+		if (VoiceStates[i].Track == Track && Voices[i] && Voices[i]->IsPlaying())
+		{
+			return i;
+		}
+	}
+
+	// 2) 놀고 있는 보이스
+	for (int32 i = 0; i < Voices.Num(); ++i)
+	{
+		if (i != ActiveVoice && Voices[i] && !Voices[i]->IsPlaying())
+		{
+			return i;
+		}
+	}
+
+	// 3) 전부 사용 중이면 가장 오래된 페이드아웃 보이스를 뺏는다
+	int32 Oldest = INDEX_NONE;
+	for (int32 i = 0; i < Voices.Num(); ++i)
+	{
+		if (i == ActiveVoice) continue;
+		if (Oldest == INDEX_NONE || VoiceStates[i].StartTime < VoiceStates[Oldest].StartTime)
+		{
+			Oldest = i;
+		}
+	}
 
-	if (!To || !From) return;
+	if (Voices.IsValidIndex(Oldest) && Voices[Oldest])
+	{
+		Voices[Oldest]->Stop();
+		VoiceStates[Oldest] = FVoiceState();
+	}
+	return Oldest;
+}
 
-	To->SetSound(NewTrack);
+void ABgmManager::FadeOutVoice(int32 VoiceIndex, float FadeSeconds)
+{
+	UAudioComponent* Voice = Voices.IsValidIndex(VoiceIndex) ? Voices[VoiceIndex].Get() : nullptr;
+	if (!Voice || !Voice->IsPlaying()) return;
+	if (VoiceStates[VoiceIndex].bFadingOut) return;
 
-	// To: 페이드 인
-	To->Play(0.f);
 	if (FadeSeconds > 0.f)
 	{
-		To->FadeIn(FadeSeconds, 1.0f, 0.0f);
+		Voice->FadeOut(FadeSeconds, 0.0f);
 	}
 	else
 	{
-		To->SetVolumeMultiplier(1.0f);
+		Voice->Stop();
 	}
+	VoiceStates[VoiceIndex].bFadingOut = true;
+}
+
+void ABgmManager::FadeOutAllVoices(float FadeSeconds)
+{
+	for (int32 i = 0; i < Voices.Num(); ++i)
+	{
+		FadeOutVoice(i, FadeSeconds);
+	}
+}
+
+void ABgmManager::PlayStems(const TArray<USoundBase*>& Stems, const TArray<float>& InitialVolumes, float FadeSeconds)
+{
+	if (bSuppressed) return;
 
-	// From: 페이드 아웃
-	if (From->IsPlaying())
+	if (!bStemsActive)
 	{
+		// 스템이 끝나면 돌아갈 트랙 기억
+		TrackAfterStems = CurrentTrack;
+		FadeAfterStems = FadeSeconds;
+	}
+
+	// 일반 보이스는 내리고 스템으로 전환
+	FadeOutAllVoices(FadeSeconds);
+	ActiveVoice = INDEX_NONE;
+	CurrentTrack = nullptr;
+
+	for (int32 i = StemVoices.Num(); i < Stems.Num(); ++i)
+	{
+		StemVoices.Add(CreateVoice(*FString::Printf(TEXT("BgmStem%d"), i)));
+	}
+
+	// 전부 같은 프레임에 시작해야 레이어 싱크가 맞는다
+	for (int32 i = 0; i < StemVoices.Num(); ++i)
+	{
+		UAudioComponent* Voice = StemVoices[i];
+		if (!Voice) continue;
+
+		USoundBase* Stem = Stems.IsValidIndex(i) ? Stems[i] : nullptr;
+		if (!Stem)
+		{
+			Voice->Stop();
+			continue;
+		}
+
+		const float Volume = FMath::Max(StemSilentVolume, InitialVolumes.IsValidIndex(i) ? InitialVolumes[i] : 1.0f);
+
+		Voice->SetSound(Stem);
+		Voice->Play(0.f);
 		if (FadeSeconds > 0.f)
 		{
-			From->FadeOut(FadeSeconds, 0.0f);
+			Voice->FadeIn(FadeSeconds, Volume, 0.0f);
 		}
 		else
 		{
-			From->Stop();
+			Voice->SetVolumeMultiplier(Volume);
 		}
 	}
 
-	bUsingA = !bUsingA;
-	CurrentTrack = NewTrack;
+	bStemsActive = true;
+}
+
+void ABgmManager::SetStemVolume(int32 StemIndex, float Volume, float FadeSeconds)
+{
+	if (!bStemsActive) return;
+	if (!StemVoices.IsValidIndex(StemIndex)) return;
+
+	UAudioComponent* Voice = StemVoices[StemIndex];
+	if (!Voice || !Voice->IsPlaying()) return;
+
+	Voice->AdjustVolume(FadeSeconds, FMath::Max(StemSilentVolume, Volume));
+}
+
+void ABgmManager::StopStems(float FadeSeconds)
+{
+	if (!bStemsActive) return;
+
+	for (UAudioComponent* Voice : StemVoices)
+	{
+		if (!Voice || !Voice->IsPlaying()) continue;
+
+		if (FadeSeconds > 0.f) Voice->FadeOut(FadeSeconds, 0.0f);
+		else Voice->Stop();
+	}
+
+	bStemsActive = false;
+
+	if (!bSuppressed)
+	{
+		CrossFadeTo(TrackAfterStems.Get(), FadeAfterStems);
+	}
+	TrackAfterStems.Reset();
+}
+
+void ABgmManager::PrimeTrack(USoundBase* Track)
+{
+	if (!Track) return;
+	if (PrimedTracks.Contains(Track)) return;
+
+	// 스트림 캐시에 첫 청크를 미리 올려 구역 경계에서 Play 지연을 줄인다
+	UGameplayStatics::PrimeSound(Track);
+
+	// 기록은 최근 N개만(언로드된 트랙 약참조도 같이 정리)
+	PrimedTracks.RemoveAll([](const TWeakObjectPtr<USoundBase>& T) { return !T.IsValid(); });
+	while (PrimedTracks.Num() >= FMath::Max(1, MaxPrimedTracks))
+	{
+		PrimedTracks.RemoveAt(0, 1, EAllowShrinking::No);
+	}
+	PrimedTracks.Add(Track);
+}
+
+void ABgmManager::PrimeTracksNear(const FVector& Location)
+{
+	if (PreloadRadius <= 0.f) return;
+
+	PreloadCandidateIds.Reset();
+	ZoneGrid.QueryRadius(Location, PreloadRadius, PreloadCandidateIds);
+
+	for (const int32 Id : PreloadCandidateIds)
+	{
+		if (const ABgmZoneTrigger* Z = AllZones[Id].Get())
+		{
+			PrimeTrack(Z->ZoneTrack);
+		}
+	}
 }
 
 void ABgmManager::PruneInvalidZones()
@@ -261,39 +523,139 @@ void ABgmManager::PruneInvalidZones()
 	{
 		return !E.Zone.IsValid();
 	});
+}
+
+void ABgmManager::CacheZonesOnce()
+{
+	AllZones.Reset();
+	FreeZoneSlots.Reset();
+	InsideZoneIds.Reset();
+	ZoneGrid.Reset(ZoneGridCellSize);
+	RequestPoll();
+
+	UActorRegistrySubsystem* Registry = UActorRegistrySubsystem::Get(this);
+	if (!Registry) return;
+
+	TArray<ABgmZoneTrigger*> Zones;
+	Registry->GetActorsOfClass(Zones);
+
+	AllZones.Reserve(Zones.Num());
+	for (ABgmZoneTrigger* Z : Zones)
+	{
+		AddZoneToIndex(Z);
+	}
 
-	AllZones.RemoveAll([](const TWeakObjectPtr<ABgmZoneTrigger>& Z)
+	// BeginPlay 순서상 늦게 등록되는 구역/스트리밍 구역도 반영
+	if (!ZoneRegistryHandle.IsValid())
 	{
-		return !Z.IsValid();
+		ZoneRegistryHandle = Registry->OnRegisteredActorChanged.AddUObject(this, &ABgmManager::HandleRegisteredActorChanged);
+	}
+}
+
+void ABgmManager::HandleRegisteredActorChanged(AActor* Actor, bool bRegistered)
+{
+	ABgmZoneTrigger* Zone = Cast<ABgmZoneTrigger>(Actor);
+	if (!Zone) return;
+
+	if (bRegistered)
+	{
+		AddZoneToIndex(Zone);
+		return;
+	}
+
+	RemoveZoneFromIndex(Zone);
+	const int32 NumRemoved = ActiveZones.RemoveAll([Zone](const FZoneEntry& E)
+	{
+		return E.Zone.Get() == Zone;
 	});
+	PruneInvalidZones();
 
-	// TSet에는 FilterByPredicate가 없어서 Iterator로 정리
-	for (auto It = InsideZones.CreateIterator(); It; ++It)
+	// 재생 중인 구역이 사라졌으면 즉시 트랙 재선정(오버랩 전용 레벨은 다음 이벤트가 없을 수 있다)
+	if (NumRemoved > 0)
 	{
-		const TWeakObjectPtr<ABgmZoneTrigger>& Z = *It;
-		if (!Z.IsValid())
-		{
-			It.RemoveCurrent();
-		}
+		UpdateDesiredTrack();
 	}
 }
 
-void ABgmManager::CacheZonesOnce()
+void ABgmManager::AddZoneToIndex(ABgmZoneTrigger* Zone)
 {
-	AllZones.Reset();
+	if (!IsValid(Zone)) return;
+	if (AllZones.Contains(Zone)) return;
 
-	if (!GetWorld()) return;
+	const int32 Id = FreeZoneSlots.Num() > 0 ? FreeZoneSlots.Pop(EAllowShrinking::No) : AllZones.AddDefaulted();
+	AllZones[Id] = Zone;
+	ZoneGrid.Add(Id, Zone->GetZoneWorldBounds());
+
+	if (Zone->bUseOverlapEvents)
+	{
+		Zone->OnZoneOverlapChanged.AddUObject(this, &ABgmManager::HandleZoneOverlapChanged);
+	}
+	Zone->OnZoneBoundsChanged.AddUObject(this, &ABgmManager::HandleZoneBoundsChanged);
+
+	// 구역 구성이 바뀌었으니 이동 여부와 무관하게 다음 폴링에서 재판정
+	RequestPoll();
+}
 
-	TArray<AActor*> Actors;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), ABgmZoneTrigger::StaticClass(), Actors);
+void ABgmManager::RemoveZoneFromIndex(ABgmZoneTrigger* Zone)
+{
+	const int32 Id = AllZones.IndexOfByKey(Zone);
+	if (Id == INDEX_NONE) return;
 
-	for (AActor* A : Actors)
+	ZoneGrid.Remove(Id);
+	if (IsValid(Zone))
 	{
-		if (ABgmZoneTrigger* Z = Cast<ABgmZoneTrigger>(A))
+		Zone->OnZoneBoundsChanged.RemoveAll(this);
+	}
+	AllZones[Id].Reset();
+	FreeZoneSlots.Add(Id);
+	InsideZoneIds.RemoveSwap(Id, EAllowShrinking::No);
+	RequestPoll();
+
+	if (IsValid(Zone))
+	{
+		Zone->OnZoneOverlapChanged.RemoveAll(this);
+	}
+}
+
+void ABgmManager::HandleZoneBoundsChanged(ABgmZoneTrigger* Zone)
+{
+	const int32 Id = AllZones.IndexOfByKey(Zone);
+	if (Id == INDEX_NONE) return;
+
+	// 새 AABB로 셀 재기록(Add가 기존 기록을 먼저 지운다)
+	ZoneGrid.Add(Id, Zone->GetZoneWorldBounds());
+	RequestPoll();
+}
+
+void ABgmManager::HandleZoneOverlapChanged(ABgmZoneTrigger* Zone, bool bEntered)
+{
+	const int32 Id = AllZones.IndexOfByKey(Zone);
+	if (Id == INDEX_NONE) return;
+
+	if (bEntered)
+	{
+		// 오버랩 진입은 폴링 주기를 기다리지 않고 즉시 반영
+		if (!InsideZoneIds.Contains(Id))
+		{
+			InsideZoneIds.Add(Id);
+			EnterZone(Zone);
+		}
+		return;
+	}
+
+	if (!bUseLocationPolling)
+	{
+		// 폴링이 꺼진 레벨은 오버랩만으로 동작
+		InsideZoneIds.RemoveSwap(Id, EAllowShrinking::No);
+		if (Zone->bRevertOnExit)
 		{
-			AllZones.Add(Z);
+			ExitZone(Zone);
 		}
+		return;
 	}
+
+	// 폴링 모드에서는 이탈 판정을 히스테리시스가 적용된 폴링에 맡긴다(경계 떨림 방지)
+	RequestPoll();
 }
 
 void ABgmManager::StartPollingIfEnabled()
@@ -302,63 +664,150 @@ void ABgmManager::StartPollingIfEnabled()
 	if (!GetWorld()) return;
 
 	GetWorld()->GetTimerManager().ClearTimer(PollTimer);
-	GetWorld()->GetTimerManager().SetTimer(PollTimer, this, &ABgmManager::PollZonesByLocation, PollIntervalSeconds, true);
+	MarioTimers::Set(GetWorld()->GetTimerManager(), PollTimer, this, &ABgmManager::PollZonesByLocation, PollIntervalSeconds, true);
 }
 
 void ABgmManager::StopPolling()
 {
+	ResumePolling(); // 리스너 바인딩 해제
 	if (!GetWorld()) return;
 	GetWorld()->GetTimerManager().ClearTimer(PollTimer);
 }
 
-FVector ABgmManager::GetListenerLocation() const
+void ABgmManager::RequestPoll()
+{
+	bForceNextPoll = true;
+	ResumePolling();
+}
+
+void ABgmManager::PausePollingUntilMoved()
+{
+	UWorld* World = GetWorld();
+	AActor* Listener = GetListenerActor();
+	USceneComponent* Root = Listener ? Listener->GetRootComponent() : nullptr;
+	if (!World || !Root || PausedListener.IsValid()) return;
+
+	// 리스너 루트가 움직이거나(TransformUpdated) 사라지면 재개. 그 전까지 타이머 비용 없음
+	PausedListener = Listener;
+	Root->TransformUpdated.AddUObject(this, &ABgmManager::HandleListenerMoved);
+	Listener->OnEndPlay.AddDynamic(this, &ABgmManager::HandleListenerEndPlay);
+	World->GetTimerManager().PauseTimer(PollTimer);
+}
+
+void ABgmManager::ResumePolling()
+{
+	AActor* Listener = PausedListener.Get();
+	if (!Listener) return;
+	PausedListener.Reset();
+
+	if (USceneComponent* Root = Listener->GetRootComponent())
+	{
+		Root->TransformUpdated.RemoveAll(this);
+	}
+	Listener->OnEndPlay.RemoveDynamic(this, &ABgmManager::HandleListenerEndPlay);
+
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().UnPauseTimer(PollTimer);
+	}
+}
+
+void ABgmManager::HandleListenerMoved(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	ResumePolling();
+}
+
+void ABgmManager::HandleListenerEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason)
+{
+	// 리스너가 바뀌면(리스폰 등) 새 리스너 기준으로 다시 판정
+	RequestPoll();
+}
+
+AActor* ABgmManager::GetListenerActor() const
 {
-	if (!GetWorld()) return FVector::ZeroVector;
+	if (!GetWorld()) return nullptr;
 
 	APlayerController* PC = UGameplayStatics::GetPlayerController(GetWorld(), 0);
-	if (!PC) return FVector::ZeroVector;
+	if (!PC) return nullptr;
 
 	// 캡쳐 정책상 ViewTarget은 Mario로 유지되므로, 위치는 ViewTarget이 가장 안정적
 	if (AActor* VT = PC->GetViewTarget())
 	{
-		return VT->GetActorLocation();
-	}
-	if (APawn* P = PC->GetPawn())
-	{
-		return P->GetActorLocation();
+		return VT;
 	}
-	return FVector::ZeroVector;
+	return PC->GetPawn();
 }
 
-void ABgmManager::PollZonesByLocation()
+FVector ABgmManager::GetListenerLocation() const
 {
-	PruneInvalidZones();
+	const AActor* Listener = GetListenerActor();
+	return Listener ? Listener->GetActorLocation() : FVector::ZeroVector;
+}
 
+void ABgmManager::PollZonesByLocation()
+{
+	MARIO_SCOPE_CYCLE(STAT_MarioOdyssey_BgmPollZones);
 	const FVector L = GetListenerLocation();
 
-	// 새로 들어온/나간 구역 계산
-	for (const TWeakObjectPtr<ABgmZoneTrigger>& WeakZ : AllZones)
+	// 0) 충분히 움직이지 않았으면 재판정 생략. 정지 중이면 리스너가 움직일 때까지 타이머도 멈춘다
+	if (bPollOnlyWhenMoved && !bForceNextPoll
+		&& FVector::DistSquared(L, LastPollLocation) < FMath::Square(PollMinMoveDistance))
 	{
-		ABgmZoneTrigger* Z = WeakZ.Get();
-		if (!IsValid(Z)) continue;
+		PausePollingUntilMoved();
+		return;
+	}
+	LastPollLocation = L;
+	bForceNextPoll = false;
 
-		const bool bInside = Z->IsLocationInside(L);
+	// 인접 구역 트랙 미리 준비
+	PrimeTracksNear(L);
 
-		const bool bWasInside = InsideZones.Contains(WeakZ);
+	// 1) 격자에서 리스너 셀의 후보만 뽑아 정확 판정
+	PollCandidateIds.Reset();
+	ZoneGrid.Query(L, PollCandidateIds);
 
-		if (bInside && !bWasInside)
+	PollNowInsideIds.Reset();
+	for (const int32 Id : PollCandidateIds)
+	{
+		ABgmZoneTrigger* Z = AllZones[Id].Get();
+		if (IsValid(Z) && Z->IsLocationInside(L))
 		{
-			InsideZones.Add(WeakZ);
-			EnterZone(Z);
+			PollNowInsideIds.Add(Id);
 		}
-		else if (!bInside && bWasInside)
+	}
+
+	bool bChanged = false;
+
+	// 2) 나간 구역(내부 구역 수는 보통 1~3개라 선형 검사로 충분)
+	//    이미 들어와 있는 구역은 ExitHysteresis만큼 넓힌 박스로 판정
+	for (int32 i = InsideZoneIds.Num() - 1; i >= 0; --i)
+	{
+		const int32 Id = InsideZoneIds[i];
+		ABgmZoneTrigger* Z = AllZones.IsValidIndex(Id) ? AllZones[Id].Get() : nullptr;
+
+		if (IsValid(Z) && Z->IsLocationInside(L, Z->ExitHysteresis)) continue;
+
+		InsideZoneIds.RemoveAtSwap(i, 1, EAllowShrinking::No);
+
+		// 이탈 시 복귀를 원치 않는 구역이면 Exit 처리 안 함
+		if (IsValid(Z) && Z->bRevertOnExit)
 		{
-			InsideZones.Remove(WeakZ);
-			// 이탈 시 복귀를 원치 않는 구역이면 Exit 처리 안 함
-			if (Z->bRevertOnExit)
-			{
-				ExitZone(Z);
-			}
+			bChanged |= RemoveActiveZone(Z);
 		}
 	}
+
+	// 3) 새로 들어온 구역
+	for (const int32 Id : PollNowInsideIds)
+	{
+		if (InsideZoneIds.Contains(Id)) continue;
+
+		InsideZoneIds.Add(Id);
+		bChanged |= AddActiveZone(AllZones[Id].Get());
+	}
+
+	// 이탈+진입이 한 번에 일어나도 CrossFadeTo는 최종 트랙으로 한 번만
+	if (bChanged)
+	{
+		UpdateDesiredTrack();
+	}
 }
@@ -0,0 +1,236 @@
+#include "Audio/BgmZoneGrid.h"
+
+FBgmZoneGrid::FBgmZoneGrid(float InCellSize)
+{
+	Reset(InCellSize);
+}
+
+void FBgmZoneGrid::Reset(float InCellSize)
+{
+	CellSize = FMath::Max(1.f, InCellSize);
+	Cells.Reset();
+	BoundsById.Reset();
+	OversizedIds.Reset();
+}
+
+FIntPoint FBgmZoneGrid::ToCell(const FVector& Location) const
+{
+	return FIntPoint(
+		FMath::FloorToInt(Location.X / CellSize),
+		FMath::FloorToInt(Location.Y / CellSize));
+}
+
+void FBgmZoneGrid::GetCellRange(const FBox& Bounds, FIntPoint& OutMin, FIntPoint& OutMax) const
+{
+	OutMin = ToCell(Bounds.Min);
+	OutMax = ToCell(Bounds.Max);
+}
+
+void FBgmZoneGrid::Add(int32 Id, const FBox& WorldBounds)
+{
+	if (!WorldBounds.IsValid) return;
+
+	Remove(Id);
+	BoundsById.Add(Id, WorldBounds);
+
+	FIntPoint Min, Max;
+	GetCellRange(WorldBounds, Min, Max);
+
+	const int64 CellCount = int64(Max.X - Min.X + 1) * int64(Max.Y - Min.Y + 1);
+	if (CellCount > MaxCellsPerZone)
+	{
+		OversizedIds.Add(Id);
+		return;
+	}
+
+	for (int32 X = Min.X; X <= Max.X; ++X)
+	{
+		for (int32 Y = Min.Y; Y <= Max.Y; ++Y)
+		{
+			Cells.FindOrAdd(FIntPoint(X, Y)).Add(Id);
+		}
+	}
+}
+
+void FBgmZoneGrid::Remove(int32 Id)
+{
+	FBox Bounds;
+	if (!BoundsById.RemoveAndCopyValue(Id, Bounds)) return;
+
+	if (OversizedIds.RemoveSwap(Id, EAllowShrinking::No) > 0) return;
+
+	FIntPoint Min, Max;
+	GetCellRange(Bounds, Min, Max);
+
+	for (int32 X = Min.X; X <= Max.X; ++X)
+	{
+		for (int32 Y = Min.Y; Y <= Max.Y; ++Y)
+		{
+			const FIntPoint Key(X, Y);
+			if (TArray<int32>* Bucket = Cells.Find(Key))
+			{
+				Bucket->RemoveSwap(Id, EAllowShrinking::No);
+				if (Bucket->Num() == 0)
+				{
+					Cells.Remove(Key);
+				}
+			}
+		}
+	}
+}
+
+void FBgmZoneGrid::Query(const FVector& Location, TArray<int32>& OutIds) const
+{
+	if (const TArray<int32>* Bucket = Cells.Find(ToCell(Location)))
+	{
+		for (const int32 Id : *Bucket)
+		{
+			if (BoundsById.FindChecked(Id).IsInsideOrOn(Location))
+			{
+				OutIds.Add(Id);
+			}
+		}
+	}
+
+	for (const int32 Id : OversizedIds)
+	{
+		if (BoundsById.FindChecked(Id).IsInsideOrOn(Location))
+		{
+			OutIds.Add(Id);
+		}
+	}
+}
+
+void FBgmZoneGrid::QueryRadius(const FVector& Location, float Radius, TArray<int32>& OutIds) const
+{
+	const float RadiusSq = FMath::Square(FMath::Max(0.f, Radius));
+
+	FIntPoint Min, Max;
+	GetCellRange(FBox(Location - FVector(Radius), Location + FVector(Radius)), Min, Max);
+
+	for (int32 X = Min.X; X <= Max.X; ++X)
+	{
+		for (int32 Y = Min.Y; Y <= Max.Y; ++Y)
+		{
+			const TArray<int32>* Bucket = Cells.Find(FIntPoint(X, Y));
+			if (!Bucket) continue;
+
+			for (const int32 Id : *Bucket)
+			{
+				if (BoundsById.FindChecked(Id).ComputeSquaredDistanceToPoint(Location) <= RadiusSq)
+				{
+					OutIds.AddUnique(Id);
+				}
+			}
+		}
+	}
+
+	for (const int32 Id : OversizedIds)
+	{
+		if (BoundsById.FindChecked(Id).ComputeSquaredDistanceToPoint(Location) <= RadiusSq)
+		{
+			OutIds.AddUnique(Id);
+		}
+	}
+}
+
+#if !UE_BUILD_SHIPPING
+#include "Dev/MarioBenchCommand.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+
+namespace BgmZoneGridBench
+{
+	// ABgmZoneTrigger 박스(회전/스케일)와 같은 판정. 실제 액터를 스폰하면 레지스트리를 통해
+	// 레벨의 BgmManager 격자/BGM에 섞이므로 벤치는 트랜스폼+반 크기만 들고 따로 측정한다
+	struct FBenchZone
+	{
+		FTransform Transform;
+		FVector Extent = FVector::ZeroVector;
+
+		// ABgmZoneTrigger::IsLocationInside(Margin 0)와 같은 계산
+		bool IsLocationInside(const FVector& WorldLocation) const
+		{
+			const FVector Local = Transform.InverseTransformPosition(WorldLocation);
+			return FMath::Abs(Local.X) <= Extent.X
+				&& FMath::Abs(Local.Y) <= Extent.Y
+				&& FMath::Abs(Local.Z) <= Extent.Z;
+		}
+
+		FBox GetWorldBounds() const
+		{
+			return FBox(-Extent, Extent).TransformBy(Transform);
+		}
+	};
+
+	// 기존 경로(모든 구역 IsLocationInside) vs 현재 경로(격자 후보 + IsLocationInside) 비교.
+	// 월드/BgmManager와 무관한 임시 격자만 쓰므로 레벨 BGM 상태는 바뀌지 않는다.
+	// 사용: bgm.BenchZonePoll [QueriesPerCase]
+	static void Run(const TArray<FString>& Args, UWorld* World)
+	{
+		const int32 NumQueries = MarioBench::IntArg(Args, 0, 10000);
+		const float WorldHalfExtent = 100000.f;
+		const int32 ZoneCounts[] = { 10, 100, 1000 };
+
+		for (const int32 NumZones : ZoneCounts)
+		{
+			FRandomStream Rng(1234);
+
+			TArray<FBenchZone> Zones;
+			Zones.Reserve(NumZones);
+			FBgmZoneGrid Grid(4000.f);
+			for (int32 i = 0; i < NumZones; ++i)
+			{
+				FBenchZone& Z = Zones.AddDefaulted_GetRef();
+				Z.Transform = FTransform(
+					FRotator(0.f, Rng.FRandRange(0.f, 360.f), 0.f),
+					FVector(Rng.FRandRange(-WorldHalfExtent, WorldHalfExtent), Rng.FRandRange(-WorldHalfExtent, WorldHalfExtent), 0.f));
+				Z.Extent = FVector(Rng.FRandRange(500.f, 5000.f), Rng.FRandRange(500.f, 5000.f), 2000.f);
+				Grid.Add(i, Z.GetWorldBounds());
+			}
+
+			TArray<FVector> Points;
+			Points.Reserve(NumQueries);
+			for (int32 i = 0; i < NumQueries; ++i)
+			{
+				Points.Add(FVector(Rng.FRandRange(-WorldHalfExtent, WorldHalfExtent), Rng.FRandRange(-WorldHalfExtent, WorldHalfExtent), 0.f));
+			}
+
+			// 기존: 매 폴링마다 모든 구역 정확 판정
+			int32 LinearHits = 0;
+			const double LinearStart = FPlatformTime::Seconds();
+			for (const FVector& P : Points)
+			{
+				for (const FBenchZone& Z : Zones)
+				{
+					LinearHits += Z.IsLocationInside(P) ? 1 : 0;
+				}
+			}
+			const double LinearMs = (FPlatformTime::Seconds() - LinearStart) * 1000.0;
+
+			// 현재: 리스너 셀 후보만 정확 판정(ABgmManager::PollZonesByLocation과 동일)
+			int32 GridHits = 0;
+			TArray<int32> Out;
+			const double GridStart = FPlatformTime::Seconds();
+			for (const FVector& P : Points)
+			{
+				Out.Reset();
+				Grid.Query(P, Out);
+				for (const int32 Id : Out)
+				{
+					GridHits += Zones[Id].IsLocationInside(P) ? 1 : 0;
+				}
+			}
+			const double GridMs = (FPlatformTime::Seconds() - GridStart) * 1000.0;
+
+			UE_LOG(LogMarioBench, Display, TEXT("[MarioBench] BenchZonePoll zones=%4d queries=%d | all-zones IsLocationInside %.3f ms (hits %d) | grid + IsLocationInside %.3f ms (hits %d)"),
+				Zones.Num(), NumQueries, LinearMs, LinearHits, GridMs, GridHits);
+		}
+	}
+
+	static FMarioBenchCommand BenchCommand(
+		TEXT("bgm.BenchZonePoll"),
+		TEXT("BGM 구역 조회 벤치마크(10/100/1000 구역, 전체 IsLocationInside vs 격자 후보). 인자: 구역 수별 조회 횟수"),
+		&Run);
+}
+#endif
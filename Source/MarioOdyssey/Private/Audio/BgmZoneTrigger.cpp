@@ -1,6 +1,9 @@
 #include "Audio/BgmZoneTrigger.h"
 
 #include "Components/BoxComponent.h"
+#include "World/ActorRegistrySubsystem.h"
+#include "Capture/PlayerTargetSubsystem.h"
+#include "MarioOdyssey/MarioCharacter.h"
 
 ABgmZoneTrigger::ABgmZoneTrigger()
 {
@@ -23,6 +26,39 @@ ABgmZoneTrigger::ABgmZoneTrigger()
 void ABgmZoneTrigger::BeginPlay()
 {
 	Super::BeginPlay();
+
+	if (bUseOverlapEvents && Trigger)
+	{
+		Trigger->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+		Trigger->SetCollisionResponseToAllChannels(ECR_Ignore);
+		Trigger->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
+		Trigger->SetGenerateOverlapEvents(true);
+		Trigger->OnComponentBeginOverlap.AddDynamic(this, &ABgmZoneTrigger::OnTriggerBeginOverlap);
+		Trigger->OnComponentEndOverlap.AddDynamic(this, &ABgmZoneTrigger::OnTriggerEndOverlap);
+	}
+
+	// 움직이는 구역은 매니저 격자의 AABB가 낡지 않도록 변경 시 알린다
+	if (Trigger && Trigger->Mobility == EComponentMobility::Movable)
+	{
+		Trigger->TransformUpdated.AddUObject(this, &ABgmZoneTrigger::HandleTriggerTransformUpdated);
+	}
+
+	// BgmManager가 GetAllActorsOfClass 없이 구역을 찾도록 레지스트리에 등록
+	UActorRegistrySubsystem::AutoRegister(this);
+}
+
+void ABgmZoneTrigger::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UActorRegistrySubsystem::AutoUnregister(this);
+
+	OnZoneOverlapChanged.Clear();
+	OnZoneBoundsChanged.Clear();
+	if (Trigger)
+	{
+		Trigger->TransformUpdated.RemoveAll(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 FVector ABgmZoneTrigger::GetUnscaledExtent() const
@@ -31,7 +67,7 @@ FVector ABgmZoneTrigger::GetUnscaledExtent() const
 	return Trigger->GetUnscaledBoxExtent();
 }
 
-bool ABgmZoneTrigger::IsLocationInside(const FVector& WorldLocation) const
+bool ABgmZoneTrigger::IsLocationInside(const FVector& WorldLocation, float Margin) const
 {
 	if (!Trigger) return false;
 
@@ -39,9 +75,55 @@ bool ABgmZoneTrigger::IsLocationInside(const FVector& WorldLocation) const
 	const FTransform T = Trigger->GetComponentTransform();
 	const FVector Local = T.InverseTransformPosition(WorldLocation);
 
-	const FVector Ext = GetUnscaledExtent();
+	FVector Ext = GetUnscaledExtent();
+	if (Margin != 0.f)
+	{
+		// Margin은 월드 거리이므로 로컬(비스케일) 공간으로 환산
+		const FVector Scale = T.GetScale3D().GetAbs().ComponentMax(FVector(KINDA_SMALL_NUMBER));
+		Ext += FVector(Margin) / Scale;
+	}
 
 	return FMath::Abs(Local.X) <= Ext.X
 		&& FMath::Abs(Local.Y) <= Ext.Y
 		&& FMath::Abs(Local.Z) <= Ext.Z;
 }
+
+FBox ABgmZoneTrigger::GetZoneWorldBounds() const
+{
+	if (!Trigger) return FBox(ForceInit);
+
+	// 충돌이 꺼진 데이터 전용 박스라도 트랜스폼 기준으로 직접 계산
+	return Trigger->CalcBounds(Trigger->GetComponentTransform()).GetBox();
+}
+
+void ABgmZoneTrigger::HandleTriggerTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	OnZoneBoundsChanged.Broadcast(this);
+}
+
+bool ABgmZoneTrigger::IsPlayerActor(const AActor* Actor, const UPrimitiveComponent* Comp) const
+{
+	if (!Actor) return false;
+
+	// 마리오의 감지용 보조 컴포넌트(벽/레지 디텍터 등)로 인한 중복 알림 방지: 루트 충돌체만
+	if (Comp && Comp != Actor->GetRootComponent()) return false;
+
+	const UPlayerTargetSubsystem* Targets = UPlayerTargetSubsystem::Get(this);
+	if (!Targets) return false;
+
+	return Actor == Targets->GetMario() || Actor == Targets->GetControlledPawn();
+}
+
+void ABgmZoneTrigger::OnTriggerBeginOverlap(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp,
+	int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+{
+	if (!IsPlayerActor(OtherActor, OtherComp)) return;
+	OnZoneOverlapChanged.Broadcast(this, true);
+}
+
+void ABgmZoneTrigger::OnTriggerEndOverlap(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp,
+	int32 OtherBodyIndex)
+{
+	if (!IsPlayerActor(OtherActor, OtherComp)) return;
+	OnZoneOverlapChanged.Broadcast(this, false);
+}
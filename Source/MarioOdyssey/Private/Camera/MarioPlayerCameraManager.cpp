@@ -0,0 +1,255 @@
+#include "Camera/MarioPlayerCameraManager.h"
+
+#include "MarioOdyssey/MarioCharacter.h"
+#include "MarioOdyssey/MarioOdysseyStats.h"
+#include "MarioSceneQuery.h"
+
+#include "Camera/CameraComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/SpringArmComponent.h"
+
+namespace
+{
+	// 다른 코드가 컨트롤 회전을 직접 바꿨는지 판정(리스폰/컷신/피치 클램프)
+	constexpr float RotationResyncToleranceDeg = 0.01f;
+}
+
+void AMarioPlayerCameraManager::PinViewTarget(AActor* Target)
+{
+	PinnedViewTarget = Target;
+	if (Target && PCOwner && GetViewTarget() != Target)
+	{
+		PCOwner->SetViewTarget(Target);
+	}
+}
+
+void AMarioPlayerCameraManager::UnpinViewTarget()
+{
+	PinnedViewTarget.Reset();
+}
+
+void AMarioPlayerCameraManager::UpdateCamera(float DeltaTime)
+{
+	MARIO_SCOPE_CYCLE(STAT_MarioOdyssey_CameraUpdate);
+
+	// 고정 대상에서 벗어났을 때만 다시 지정(블렌드 중인 대상도 인정)
+	if (AActor* Pinned = PinnedViewTarget.Get())
+	{
+		if (PCOwner && GetViewTarget() != Pinned && PendingViewTarget.Target != Pinned)
+		{
+			PCOwner->SetViewTarget(Pinned);
+		}
+	}
+
+	if (AMarioCharacter* Mario = ResolveMario())
+	{
+		StepControlRotation(Mario, DeltaTime);
+	}
+
+	Super::UpdateCamera(DeltaTime);
+}
+
+AMarioCharacter* AMarioPlayerCameraManager::ResolveMario() const
+{
+	if (!PCOwner)
+	{
+		return nullptr;
+	}
+
+	// 평소엔 조종 중인 마리오, 캡쳐 중엔 뷰 타깃으로 유지되는 마리오
+	if (AMarioCharacter* Mario = Cast<AMarioCharacter>(PCOwner->GetPawn()))
+	{
+		return Mario;
+	}
+	return Cast<AMarioCharacter>(PinnedViewTarget.Get());
+}
+
+void AMarioPlayerCameraManager::StepControlRotation(AMarioCharacter* Mario, float DeltaTime)
+{
+	const FRotator Applied = PCOwner->GetControlRotation();
+	if (!bHasRotationState || !Applied.Equals(LastOutputRotation, RotationResyncToleranceDeg))
+	{
+		PrevStepRotation = Applied;
+		StepRotation = Applied;
+		StepAccumulator = 0.f;
+		bHasRotationState = true;
+	}
+
+	const float StepSeconds = 1.f / FMath::Max(SmoothingRateHz, 15.f);
+	const FRotator Target = Mario->GetCameraTargetRotation();
+	const float InterpSpeed = Mario->GetCameraRotationInterpSpeed();
+
+	StepAccumulator += DeltaTime;
+
+	int32 Steps = 0;
+	while (StepAccumulator >= StepSeconds && Steps < MaxSmoothingStepsPerFrame)
+	{
+		PrevStepRotation = StepRotation;
+		StepRotation = FMath::RInterpTo(StepRotation, Target, StepSeconds, InterpSpeed);
+
+		// 암 길이 복귀도 같은 고정 스텝으로
+		ArmFraction = FMath::Min(ArmTargetFraction, ArmFraction + ArmRecoverRate * StepSeconds);
+
+		StepAccumulator -= StepSeconds;
+		++Steps;
+	}
+	StepAccumulator = FMath::Min(StepAccumulator, StepSeconds);
+
+	// 마지막 두 스텝 사이를 남은 시간 비율로 보간(표시 프레임과 스텝 경계 불일치 흡수)
+	const FRotator Output = FMath::Lerp(PrevStepRotation, StepRotation, StepAccumulator / StepSeconds);
+
+	LastOutputRotation = Output;
+	PCOwner->SetControlRotation(Output);
+	Mario->SetCaptureControlRotation(Output); // 캡쳐 중 GetViewRotation()이 이 값을 반환
+}
+
+void AMarioPlayerCameraManager::UpdateViewTarget(FTViewTarget& OutVT, float DeltaTime)
+{
+	Super::UpdateViewTarget(OutVT, DeltaTime);
+
+	AMarioCharacter* Mario = Cast<AMarioCharacter>(OutVT.Target);
+	USpringArmComponent* Arm = Mario ? Mario->GetCameraBoom() : nullptr;
+	const UCameraComponent* Camera = Mario ? Mario->GetFollowCamera() : nullptr;
+	if (!Arm || !Camera || !Camera->IsActive())
+	{
+		return;
+	}
+
+	AdoptSpringArm(Arm);
+
+	// 스프링암과 같은 식으로 리그를 이번 프레임 회전으로 다시 계산(암 컴포넌트 틱보다 늦게 확정된 회전 반영)
+	const FVector Origin = Arm->GetComponentLocation() + Arm->TargetOffset;
+	FRotator Rotation = Arm->GetTargetRotation();
+	FVector LaggedOrigin = Origin;
+	ApplySpringArmLag(Arm, DeltaTime, LaggedOrigin, Rotation);
+
+	const FVector Desired = LaggedOrigin - Rotation.Vector() * Arm->TargetArmLength
+		+ FRotationMatrix(Rotation).TransformVector(Arm->SocketOffset);
+
+	if (ShouldProbe(Origin, Rotation) && ConsumeProbeBudget())
+	{
+		ProbeArm(Mario, Arm, Origin, Desired);
+		LastProbeRotation = Rotation;
+	}
+
+	// 막힐 때는 즉시 당기고, 풀릴 때는 StepControlRotation에서 천천히 복귀
+	ArmFraction = FMath::Min(ArmFraction, ArmTargetFraction);
+
+	OutVT.POV.Location = Origin + (Desired - Origin) * ArmFraction;
+	OutVT.POV.Rotation = (Rotation.Quaternion() * Camera->GetRelativeRotation().Quaternion()).Rotator();
+}
+
+void AMarioPlayerCameraManager::AdoptSpringArm(USpringArmComponent* Arm)
+{
+	if (ManagedArm.Get() == Arm)
+	{
+		return;
+	}
+
+	// 충돌 프로브는 여기서 예산 안에서만 한다
+	Arm->bDoCollisionTest = false;
+
+	ManagedArm = Arm;
+	ArmTargetFraction = 1.f;
+	ArmFraction = 1.f;
+	LastProbeTime = -1.f;
+	bHasArmLagState = false;
+}
+
+void AMarioPlayerCameraManager::ApplySpringArmLag(const USpringArmComponent* Arm, float DeltaTime, FVector& InOutOrigin, FRotator& InOutRotation)
+{
+	// POV를 여기서 다시 계산하므로 스프링암 자체 지연 결과는 쓰이지 않는다 -> 같은 설정으로 여기서 재현
+	if (!bHasArmLagState)
+	{
+		LaggedArmOrigin = InOutOrigin;
+		LaggedArmRotation = InOutRotation;
+		bHasArmLagState = true;
+		return;
+	}
+
+	if (Arm->bEnableCameraRotationLag)
+	{
+		LaggedArmRotation = FRotator(FMath::QInterpTo(LaggedArmRotation.Quaternion(), InOutRotation.Quaternion(), DeltaTime, Arm->CameraRotationLagSpeed));
+		InOutRotation = LaggedArmRotation;
+	}
+	else
+	{
+		LaggedArmRotation = InOutRotation;
+	}
+
+	if (Arm->bEnableCameraLag)
+	{
+		const FVector Target = InOutOrigin;
+		LaggedArmOrigin = FMath::VInterpTo(LaggedArmOrigin, Target, DeltaTime, Arm->CameraLagSpeed);
+
+		if (Arm->CameraLagMaxDistance > 0.f)
+		{
+			const FVector FromTarget = LaggedArmOrigin - Target;
+			if (FromTarget.SizeSquared() > FMath::Square(Arm->CameraLagMaxDistance))
+			{
+				LaggedArmOrigin = Target + FromTarget.GetClampedToMaxSize(Arm->CameraLagMaxDistance);
+			}
+		}
+		InOutOrigin = LaggedArmOrigin;
+	}
+	else
+	{
+		LaggedArmOrigin = InOutOrigin;
+	}
+}
+
+bool AMarioPlayerCameraManager::ShouldProbe(const FVector& Origin, const FRotator& Rotation) const
+{
+	if (LastProbeTime < 0.f)
+	{
+		return true;
+	}
+
+	const float Now = GetWorld()->GetTimeSeconds();
+	if (Now - LastProbeTime >= 1.f / FMath::Max(CollisionProbeRateHz, 1.f))
+	{
+		return true;
+	}
+
+	if (FVector::DistSquared(Origin, LastProbeOrigin) > FMath::Square(ProbeForceDistance))
+	{
+		return true;
+	}
+
+	const FQuat Delta = Rotation.Quaternion() * LastProbeRotation.Quaternion().Inverse();
+	return FMath::RadiansToDegrees(Delta.GetAngle()) > ProbeForceAngleDeg;
+}
+
+bool AMarioPlayerCameraManager::ConsumeProbeBudget()
+{
+	if (ProbeBudgetFrame != GFrameCounter)
+	{
+		ProbeBudgetFrame = GFrameCounter;
+		ProbesThisFrame = 0;
+	}
+
+	if (ProbesThisFrame >= MaxCollisionProbesPerFrame)
+	{
+		return false;
+	}
+
+	++ProbesThisFrame;
+	return true;
+}
+
+void AMarioPlayerCameraManager::ProbeArm(const AMarioCharacter* Mario, const USpringArmComponent* Arm, const FVector& Origin, const FVector& Desired)
+{
+	UWorld* World = GetWorld();
+
+	LastProbeTime = World->GetTimeSeconds();
+	LastProbeOrigin = Origin;
+
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(MarioCameraProbe), false, Mario);
+
+	FHitResult Hit;
+	MarioSceneQuery::SweepSingleByChannel(World, Hit, Origin, Desired, FQuat::Identity, Arm->ProbeChannel,
+		FCollisionShape::MakeSphere(Arm->ProbeSize), Params);
+
+	ArmTargetFraction = Hit.bBlockingHit ? Hit.Time : 1.f;
+}
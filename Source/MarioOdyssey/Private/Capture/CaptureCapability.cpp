@@ -0,0 +1,43 @@
+#include "Capture/CaptureCapability.h"
+
+#include "Capture/CapturableInterface.h"
+#include "Engine/World.h"
+#include "UObject/ObjectKey.h"
+
+namespace
+{
+	TMap<TObjectKey<UClass>, ECaptureCapability>& GetCapabilityCache()
+	{
+		static TMap<TObjectKey<UClass>, ECaptureCapability> Cache;
+
+		// PIE 세션/핫 리로드 사이에 지난 클래스 키가 남지 않도록 월드 정리마다 비운다
+		static const FDelegateHandle CleanupHandle = FWorldDelegates::OnWorldCleanup.AddLambda(
+			[](UWorld*, bool, bool) { Cache.Reset(); });
+
+		return Cache;
+	}
+
+	ECaptureCapability ComputeCapability(const UClass* Class)
+	{
+		ECaptureCapability Caps = ECaptureCapability::None;
+		if (Class->ImplementsInterface(UCapturableInterface::StaticClass()))
+		{
+			Caps |= ECaptureCapability::Capturable;
+		}
+		return Caps;
+	}
+}
+
+ECaptureCapability CaptureCapability::Get(const UClass* Class)
+{
+	if (!Class) return ECaptureCapability::None;
+	check(IsInGameThread());
+
+	TMap<TObjectKey<UClass>, ECaptureCapability>& Cache = GetCapabilityCache();
+	const TObjectKey<UClass> Key(Class);
+	if (const ECaptureCapability* Found = Cache.Find(Key))
+	{
+		return *Found;
+	}
+	return Cache.Add(Key, ComputeCapability(Class));
+}
@@ -1,51 +1,44 @@
 #include "Capture/CaptureComponent.h"
 
 #include "Capture/CapturableInterface.h"
+#include "Capture/CaptureCapability.h"
+#include "Capture/PlayerTargetSubsystem.h"
+#include "Camera/MarioPlayerCameraManager.h"
 
 
 #include "Components/CapsuleComponent.h"
+#include "Components/SkeletalMeshComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/PlayerController.h"
 #include "Kismet/GameplayStatics.h"
 #include "NavigationSystem.h"
 #include "MarioOdyssey/MarioCharacter.h"
+#include "MarioOdyssey/MarioOdysseyStats.h"
+#include "MarioSceneQuery.h"
 
-UCaptureComponent::UCaptureComponent()
+namespace
 {
-	PrimaryComponentTick.bCanEverTick = true; // 캡쳐 중 ViewTarget 유지용(최적화는 나중)
+	// 출구 링 후보 방향(몬스터 정면 기준 Yaw, 우선순위 순)
+	constexpr float ExitSlotYawDeg[] = { 0.f, 45.f, -45.f, 90.f, -90.f, 135.f, -135.f, 180.f };
 }
 
-void UCaptureComponent::BeginPlay()
+UCaptureComponent::UCaptureComponent()
 {
-	Super::BeginPlay();
+	// 캡쳐 중 ViewTarget 유지/카메라 보간은 AMarioPlayerCameraManager가 담당.
+	// 틱은 캡쳐 중 출구 링 갱신에만 쓴다
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
 
-	OriginalMario = Cast<AMarioCharacter>(GetOwner());
-	CachePlayerControllerIfNeeded();
+	static_assert(UE_ARRAY_COUNT(ExitSlotYawDeg) == NumExitSlots, "Exit slot table size mismatch");
+	ResetExitRing();
 }
 
-void UCaptureComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void UCaptureComponent::BeginPlay()
 {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-
-	if (!bIsCapturing) return;
+	Super::BeginPlay();
 
+	OriginalMario = Cast<AMarioCharacter>(GetOwner());
 	CachePlayerControllerIfNeeded();
-	if (CachedPC.IsValid() && OriginalMario.IsValid())
-	{
-		// ViewTarget은 항상 마리오 유지
-		if (CachedPC->GetViewTarget() != OriginalMario.Get())
-		{
-			CachedPC->SetViewTarget(OriginalMario.Get());
-		}
-		// Possess로 인해 자동 카메라 타겟 관리가 다시 켜질 수 있으니 방어
-		CachedPC->bAutoManageActiveCameraTarget = false;
-	}
-	
-	if (OriginalMario.IsValid() && CachedPC.IsValid())
-	{
-		OriginalMario->CaptureTickCamera(DeltaTime, CachedPC.Get());
-	}
-	
 }
 
 void UCaptureComponent::CachePlayerControllerIfNeeded()
@@ -60,6 +53,8 @@ void UCaptureComponent::CachePlayerControllerIfNeeded()
 
 bool UCaptureComponent::TryCapture(AActor* TargetActor, const FCaptureContext& Context)
 {
+	MARIO_SCOPE_CYCLE(STAT_MarioOdyssey_CaptureBegin);
+
 	if (bIsCapturing) return false;
 	if (!OriginalMario.IsValid()) OriginalMario = Cast<AMarioCharacter>(GetOwner());
 	if (!OriginalMario.IsValid()) return false;
@@ -68,7 +63,7 @@ bool UCaptureComponent::TryCapture(AActor* TargetActor, const FCaptureContext& C
 	if (!CachedPC.IsValid()) return false;
 
 	if (!TargetActor) return false;
-	if (!TargetActor->GetClass()->ImplementsInterface(UCapturableInterface::StaticClass())) return false;
+	if (!CaptureCapability::IsCapturableClass(TargetActor->GetClass())) return false;
 
 	const bool bCan = ICapturableInterface::Execute_CanBeCaptured(TargetActor, Context);
 	if (!bCan) return false;
@@ -83,6 +78,7 @@ bool UCaptureComponent::TryCapture(AActor* TargetActor, const FCaptureContext& C
 	// 상태 저장
 	CapturedActor = TargetActor;
 	CapturedPawn = NewPawn;
+	CapturedPawnPrevController = NewPawn->GetController();
 
 	// 데미지 라우팅: "맞는 건 몬스터, HP는 마리오"
 	NewPawn->OnTakeAnyDamage.AddDynamic(this, &UCaptureComponent::HandleCapturedPawnAnyDamage);
@@ -92,8 +88,8 @@ bool UCaptureComponent::TryCapture(AActor* TargetActor, const FCaptureContext& C
 	
 	OriginalMario->OnCaptureBegin();//상태 정리
 	
-	// 마리오 숨김/비활성 + Attach
-	ApplyMarioCaptureHide(true);
+	// 마리오 휴면 + Attach
+	SetMarioDormant(true);
 	AttachMarioToCapturedPawn();
 	
 	//카메라
@@ -107,12 +103,28 @@ bool UCaptureComponent::TryCapture(AActor* TargetActor, const FCaptureContext& C
 	CachedPC->Possess(NewPawn);
 	CachedPC->SetViewTarget(OriginalMario.Get());
 
+	// 캡쳐 동안 뷰 타깃은 마리오로 고정(벗어났을 때만 카메라 매니저가 되돌림)
+	if (AMarioPlayerCameraManager* CameraManager = Cast<AMarioPlayerCameraManager>(CachedPC->PlayerCameraManager))
+	{
+		CameraManager->PinViewTarget(OriginalMario.Get());
+	}
+
+	if (UPlayerTargetSubsystem* Targets = UPlayerTargetSubsystem::Get(this))
+	{
+		Targets->SetCapturedPawn(NewPawn);
+	}
+
 	bIsCapturing = true;
+
+	ResetExitRing();
+	SetComponentTickEnabled(true);
 	return true;
 }
 
 bool UCaptureComponent::ReleaseCapture(ECaptureReleaseReason Reason)
 {
+	MARIO_SCOPE_CYCLE(STAT_MarioOdyssey_CaptureRelease);
+
 	if (!bIsCapturing) return false;
 	if (!OriginalMario.IsValid()) return false;
 	CachePlayerControllerIfNeeded();
@@ -134,12 +146,21 @@ bool UCaptureComponent::ReleaseCapture(ECaptureReleaseReason Reason)
 	// 마리오 Detach 후 복귀
 	DetachMario();
 	OriginalMario->SetActorLocation(ExitLoc, false, nullptr, ETeleportType::TeleportPhysics);
-	ApplyMarioCaptureHide(false);
+	SetMarioDormant(false);
 
 	// 컨트롤 복귀 + ViewTarget 유지(마리오)
+	if (AMarioPlayerCameraManager* CameraManager = Cast<AMarioPlayerCameraManager>(CachedPC->PlayerCameraManager))
+	{
+		CameraManager->UnpinViewTarget();
+	}
 	CachedPC->Possess(OriginalMario.Get());
 	CachedPC->SetViewTarget(OriginalMario.Get());
 	CachedPC->bAutoManageActiveCameraTarget = bPrevAutoManageCameraTarget;
+
+	if (UPlayerTargetSubsystem* Targets = UPlayerTargetSubsystem::Get(this))
+	{
+		Targets->SetCapturedPawn(nullptr);
+	}
 	
 	OriginalMario->OnCaptureEnd();//마리오 상태 정리
 	
@@ -148,13 +169,21 @@ bool UCaptureComponent::ReleaseCapture(ECaptureReleaseReason Reason)
 		OriginalMario->SetCaptureControlRotationOverride(false);
 	}
 	
-	// 굼바(캡쳐 대상)도 AI 컨트롤러 재생성/재포제스
+	// 굼바(캡쳐 대상)는 캡쳐 전 AI 컨트롤러로 복귀(없어졌을 때만 새로 스폰)
 	if (CPawn && CPawn->GetController() == nullptr)
 	{
-		CPawn->SpawnDefaultController();
+		AController* PrevController = CapturedPawnPrevController.Get();
+		if (PrevController && !PrevController->IsActorBeingDestroyed() && PrevController->GetPawn() == nullptr)
+		{
+			PrevController->Possess(CPawn);
+		}
+		else
+		{
+			CPawn->SpawnDefaultController();
+		}
 	}
 	// 몬스터 측 해제 콜백(3초 스턴/탐지 복귀 등)
-	if (CActor && CActor->GetClass()->ImplementsInterface(UCapturableInterface::StaticClass()))
+	if (CActor && CaptureCapability::IsCapturableClass(CActor->GetClass()))
 	{
 		FCaptureReleaseContext Rctx;
 		Rctx.Reason = Reason;
@@ -166,8 +195,11 @@ bool UCaptureComponent::ReleaseCapture(ECaptureReleaseReason Reason)
 
 	CapturedActor.Reset();
 	CapturedPawn.Reset();
+	CapturedPawnPrevController.Reset();
 	bIsCapturing = false;
 
+	SetComponentTickEnabled(false);
+
 	return true;
 }
 
@@ -176,23 +208,47 @@ void UCaptureComponent::ForceReleaseForGameOver()
 	ReleaseCapture(ECaptureReleaseReason::GameOver);
 }
 
-void UCaptureComponent::ApplyMarioCaptureHide(bool bHide)
+void UCaptureComponent::SetMarioDormant(bool bDormant)
 {
 	if (!OriginalMario.IsValid()) return;
+	if (bMarioDormant == bDormant) return;
+	bMarioDormant = bDormant;
 
-	// 정책: Hidden + NoCollision + MovementOff, Tick은 유지
-	OriginalMario->SetActorHiddenInGame(bHide);
-	OriginalMario->SetActorEnableCollision(!bHide);
+	// 정책: 컴포넌트는 등록된 채로 숨김 + 틱 정지, 충돌은 캡슐 1개만 끈다
+	// (SetActorEnableCollision은 메시 물리 바디까지 전부 필터 갱신/오버랩 재계산을 돌려 캡쳐 순간 히치)
+	// 스프링암/카메라는 뷰 타깃이라 계속 동작해야 하므로 건드리지 않는다.
+	AMarioCharacter* Mario = OriginalMario.Get();
+	Mario->SetActorHiddenInGame(bDormant);
+	Mario->SetActorTickEnabled(!bDormant);
 
-	if (UCharacterMovementComponent* Move = OriginalMario->GetCharacterMovement())
+	if (UCapsuleComponent* Capsule = Mario->GetCapsuleComponent())
 	{
-		if (bHide)
+		if (bDormant)
+		{
+			MarioCapsuleCollision = Capsule->GetCollisionEnabled();
+			Capsule->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		}
+		else
+		{
+			Capsule->SetCollisionEnabled(MarioCapsuleCollision);
+		}
+	}
+
+	if (USkeletalMeshComponent* MeshComp = Mario->GetMesh())
+	{
+		MeshComp->SetComponentTickEnabled(!bDormant);
+	}
+
+	if (UCharacterMovementComponent* Move = Mario->GetCharacterMovement())
+	{
+		if (bDormant)
 		{
 			Move->StopMovementImmediately();
-			Move->SetMovementMode(MOVE_None);
+			Move->SetComponentTickEnabled(false);
 		}
 		else
 		{
+			Move->SetComponentTickEnabled(true);
 			Move->SetMovementMode(MOVE_Walking);
 		}
 	}
@@ -213,44 +269,116 @@ void UCaptureComponent::DetachMario()
 	OriginalMario->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
 }
 
-bool UCaptureComponent::ComputeExitLocation(FVector& OutExitLocation) const
+void UCaptureComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
-	if (!CapturedPawn.IsValid()) return false;
-
-	const FVector Origin = CapturedPawn->GetActorLocation();
-	const FVector Fwd = CapturedPawn->GetActorForwardVector();
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-	const FVector Desired = Origin + Fwd * ExitForwardOffset + FVector(0, 0, ExitUpOffset);
+	if (bIsCapturing)
+	{
+		RefreshExitRing(DeltaTime);
+	}
+}
 
-	// 1) 우선 공간이 비어있으면 사용
-	if (OriginalMario.IsValid())
+void UCaptureComponent::ResetExitRing()
+{
+	for (float& Time : ExitSlotValidatedTime)
 	{
-		const UCapsuleComponent* Cap = OriginalMario->GetCapsuleComponent();
-		if (Cap)
-		{
-			const float R = Cap->GetScaledCapsuleRadius();
-			const float HH = Cap->GetScaledCapsuleHalfHeight();
-			const FCollisionShape Shape = FCollisionShape::MakeCapsule(R, HH);
+		Time = -1.f;
+	}
+	ExitProbeCursor = 0;
+	BestExitSlot = INDEX_NONE;
+	ExitProbeAccumulator = 0.f;
+}
 
-			const bool bBlocked = GetWorld()->OverlapBlockingTestByChannel(
-				Desired, FQuat::Identity, ECC_Pawn, Shape
-			);
+void UCaptureComponent::RefreshExitRing(float DeltaTime)
+{
+	if (!CapturedPawn.IsValid()) return;
+
+	const float Interval = 1.f / FMath::Max(ExitProbeRateHz, 1.f);
+	ExitProbeAccumulator += DeltaTime;
+
+	int32 Probes = 0;
+	while (ExitProbeAccumulator >= Interval && Probes < MaxExitProbesPerFrame)
+	{
+		ExitProbeAccumulator -= Interval;
+		++Probes;
 
-			if (!bBlocked)
+		const int32 Slot = ExitProbeCursor;
+		if (IsExitClear(GetExitSlotLocation(Slot)))
+		{
+			ExitSlotValidatedTime[Slot] = GetWorld()->GetTimeSeconds();
+			if (BestExitSlot == INDEX_NONE || Slot <= BestExitSlot)
 			{
-				OutExitLocation = Desired;
-				return true;
+				BestExitSlot = Slot;
+			}
+			// 빈 후보를 찾으면 정면부터 다시(정면이 비어 있으면 정면만 계속 갱신)
+			ExitProbeCursor = 0;
+		}
+		else
+		{
+			ExitSlotValidatedTime[Slot] = -1.f;
+			if (BestExitSlot == Slot)
+			{
+				BestExitSlot = INDEX_NONE;
 			}
+			ExitProbeCursor = (Slot + 1) % NumExitSlots;
 		}
 	}
+	ExitProbeAccumulator = FMath::Min(ExitProbeAccumulator, Interval);
+}
+
+FVector UCaptureComponent::GetExitSlotLocation(int32 Slot) const
+{
+	const FVector Origin = CapturedPawn->GetActorLocation();
+	const float Yaw = CapturedPawn->GetActorRotation().Yaw + ExitSlotYawDeg[Slot];
+	const FVector Dir = FRotator(0.f, Yaw, 0.f).Vector();
+	return Origin + Dir * ExitForwardOffset + FVector(0, 0, ExitUpOffset);
+}
+
+bool UCaptureComponent::IsExitClear(const FVector& Location) const
+{
+	const UCapsuleComponent* Cap = OriginalMario.IsValid() ? OriginalMario->GetCapsuleComponent() : nullptr;
+	if (!Cap) return false;
+
+	const FCollisionShape Shape = FCollisionShape::MakeCapsule(Cap->GetScaledCapsuleRadius(), Cap->GetScaledCapsuleHalfHeight());
+
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(CaptureExitProbe), false, OriginalMario.Get());
+	Params.AddIgnoredActor(CapturedPawn.Get());
+
+	return !MarioSceneQuery::OverlapBlockingTestByChannel(GetWorld(), Location, FQuat::Identity, ECC_Pawn, Shape, Params);
+}
 
-	// 2) 막히면 NavMesh로 보정(가까운 포인트)
+bool UCaptureComponent::ComputeExitLocation(FVector& OutExitLocation) const
+{
+	if (!CapturedPawn.IsValid()) return false;
+
+	// 1) 캡쳐 중 링에서 확인해 둔 출구(최근 것이면 쿼리 없음, 오래됐으면 1회 재확인)
+	if (BestExitSlot != INDEX_NONE)
+	{
+		const FVector Cached = GetExitSlotLocation(BestExitSlot);
+		const float Age = GetWorld()->GetTimeSeconds() - ExitSlotValidatedTime[BestExitSlot];
+		if (Age <= ExitCacheMaxAge || IsExitClear(Cached))
+		{
+			OutExitLocation = Cached;
+			return true;
+		}
+	}
+
+	// 2) 링이 아직 비었으면(캡쳐 직후 해제) 정면 1회 확인
+	const FVector Desired = GetExitSlotLocation(0);
+	if (BestExitSlot != 0 && IsExitClear(Desired))
+	{
+		OutExitLocation = Desired;
+		return true;
+	}
+
+	// 3) 막히면 NavMesh로 보정(가까운 포인트)
 	if (UWorld* World = GetWorld())
 	{
 		if (UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(World))
 		{
 			FNavLocation Projected;
-			if (NavSys->ProjectPointToNavigation(Desired, Projected, FVector(ExitNavProjectRadius)))
+			if (MarioSceneQuery::ProjectPointToNavigation(NavSys, Desired, Projected, FVector(ExitNavProjectRadius)))
 			{
 				OutExitLocation = Projected.Location;
 				return true;
@@ -258,8 +386,8 @@ bool UCaptureComponent::ComputeExitLocation(FVector& OutExitLocation) const
 		}
 	}
 
-	// 3) 최후 fallback
-	OutExitLocation = Origin + FVector(0, 0, 200.f);
+	// 4) 최후 fallback
+	OutExitLocation = CapturedPawn->GetActorLocation() + FVector(0, 0, 200.f);
 	return true;
 }
 
@@ -272,8 +400,77 @@ void UCaptureComponent::HandleCapturedPawnAnyDamage(AActor* DamagedActor, float
 	if (!OriginalMario.IsValid()) return;
 
 	// 몬스터 피격 리액션(넉백/스턴/애니)
-	if (CapturedActor.IsValid() && CapturedActor->GetClass()->ImplementsInterface(UCapturableInterface::StaticClass()))
+	if (CapturedActor.IsValid() && CaptureCapability::IsCapturableClass(CapturedActor->GetClass()))
 	{
 		ICapturableInterface::Execute_OnCapturedPawnDamaged(CapturedActor.Get(), Damage, InstigatedBy, DamageCauser);
 	}
 }
+
+#if !UE_BUILD_SHIPPING
+#include "Character/Monster/GoombaCharacter.h"
+#include "Dev/MarioBenchTimings.h"
+#include "Engine/World.h"
+#include "Dev/MarioBenchCommand.h"
+
+namespace CaptureBench
+{
+	// 캡쳐/해제 연타 비용: 마리오 앞에 굼바 1마리를 두고 TryCapture/ReleaseCapture를 N번 반복
+	static FMarioBenchCommand MarioCaptureSpamCommand(
+		TEXT("mario.CaptureSpam"),
+		TEXT("캡쳐/해제 반복 비용 측정. 인자: [반복 수=200]"),
+		[](const TArray<FString>& Args, UWorld* World)
+		{
+			AMarioCharacter* M = MarioBench::FindMario(World);
+			UCaptureComponent* CapComp = M ? M->GetCaptureComp() : nullptr;
+			if (!CapComp || CapComp->IsCapturing()) return;
+
+			const int32 Cycles = MarioBench::IntArg(Args, 0, 200);
+
+			FActorSpawnParameters Params;
+			Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+			const FVector Loc = M->GetActorLocation() + M->GetActorForwardVector() * 300.f;
+			AGoombaCharacter* Target = World->SpawnActor<AGoombaCharacter>(AGoombaCharacter::StaticClass(), Loc, M->GetActorRotation(), Params);
+			if (!Target) return;
+			if (!Target->GetController())
+			{
+				Target->SpawnDefaultController();
+			}
+
+			int32 ActorSpawns = 0;
+			const FDelegateHandle SpawnHandle = World->AddOnActorSpawnedHandler(
+				FOnActorSpawned::FDelegate::CreateLambda([&ActorSpawns](AActor*) { ++ActorSpawns; }));
+
+			FCaptureContext Ctx;
+			Ctx.SourceActor = M;
+			Ctx.InstigatorController = M->GetController();
+
+			TArray<double> CaptureMs;
+			TArray<double> ReleaseMs;
+			CaptureMs.Reserve(Cycles);
+			ReleaseMs.Reserve(Cycles);
+
+			for (int32 i = 0; i < Cycles; ++i)
+			{
+				Ctx.HitLocation = Target->GetActorLocation();
+
+				const uint64 CaptureStart = FPlatformTime::Cycles64();
+				const bool bCaptured = CapComp->TryCapture(Target, Ctx);
+				CaptureMs.Add(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - CaptureStart));
+				if (!bCaptured) break;
+
+				const uint64 ReleaseStart = FPlatformTime::Cycles64();
+				CapComp->ReleaseCapture(ECaptureReleaseReason::Manual);
+				ReleaseMs.Add(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - ReleaseStart));
+			}
+
+			World->RemoveOnActorSpawnedHandler(SpawnHandle);
+			Target->Destroy();
+
+			const FMarioBenchSampleStats Capture = FMarioBenchSampleStats::Compute(CaptureMs);
+			const FMarioBenchSampleStats Release = FMarioBenchSampleStats::Compute(ReleaseMs);
+			UE_LOG(LogMarioBench, Display,
+				TEXT("[MarioBench] CaptureSpam x%d: capture avg %.3f / p95 %.3f / max %.3f ms, release avg %.3f / p95 %.3f / max %.3f ms, actor spawns %d"),
+				ReleaseMs.Num(), Capture.Avg, Capture.P95, Capture.Max, Release.Avg, Release.P95, Release.Max, ActorSpawns);
+		});
+}
+#endif
@@ -0,0 +1,87 @@
+#include "Capture/PlayerTargetSubsystem.h"
+
+#include "MarioOdyssey/MarioCharacter.h"
+
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+
+UPlayerTargetSubsystem* UPlayerTargetSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!WorldContextObject) return nullptr;
+
+	const UWorld* World = WorldContextObject->GetWorld();
+	return World ? World->GetSubsystem<UPlayerTargetSubsystem>() : nullptr;
+}
+
+void UPlayerTargetSubsystem::RegisterMario(AMarioCharacter* InMario)
+{
+	if (!InMario) return;
+
+	Mario = InMario;
+	CapturedPawn.Reset();
+	FallbackMissFrame = MAX_uint64;
+}
+
+void UPlayerTargetSubsystem::UnregisterMario(AMarioCharacter* InMario)
+{
+	if (Mario.Get() != InMario) return;
+
+	Mario.Reset();
+	CapturedPawn.Reset();
+}
+
+void UPlayerTargetSubsystem::SetCapturedPawn(APawn* InCapturedPawn)
+{
+	CapturedPawn = InCapturedPawn;
+}
+
+AMarioCharacter* UPlayerTargetSubsystem::GetMario() const
+{
+	if (AMarioCharacter* Cached = Mario.Get())
+	{
+		return Cached;
+	}
+
+	return ResolveMarioFallback();
+}
+
+APawn* UPlayerTargetSubsystem::GetControlledPawn() const
+{
+	// 캡쳐 Pawn이 파괴되었으면(예: 킬러 폭발) 자동으로 마리오로 복귀
+	if (APawn* Captured = CapturedPawn.Get())
+	{
+		return Captured;
+	}
+
+	return GetMario();
+}
+
+AMarioCharacter* UPlayerTargetSubsystem::ResolveMarioFallback() const
+{
+	UWorld* World = GetWorld();
+	if (!World) return nullptr;
+
+	// 마리오가 없을 때 호출자마다 매번 다시 찾지 않도록 실패는 프레임 단위로 캐시
+	if (FallbackMissFrame == GFrameCounter) return nullptr;
+
+	++FallbackResolveCount;
+
+	// 마리오 BeginPlay 이전 조회 등: 캡쳐 중에도 ViewTarget은 마리오이므로 ViewTarget -> Pawn 순으로 찾는다.
+	if (APlayerController* PC = World->GetFirstPlayerController())
+	{
+		if (AMarioCharacter* FromView = Cast<AMarioCharacter>(PC->GetViewTarget()))
+		{
+			Mario = FromView;
+			return FromView;
+		}
+
+		if (AMarioCharacter* FromPawn = Cast<AMarioCharacter>(PC->GetPawn()))
+		{
+			Mario = FromPawn;
+			return FromPawn;
+		}
+	}
+
+	FallbackMissFrame = GFrameCounter;
+	return nullptr;
+}
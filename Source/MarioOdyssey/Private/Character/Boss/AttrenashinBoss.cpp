@@ -1,15 +1,19 @@
 #include "Character/Boss/AttrenashinBoss.h"
 #include "Character/Boss/AttrenashinFist.h"
 #include "Character/Boss/IceShardActor.h"
+#include "Character/Boss/IceShardPoolSubsystem.h"
 #include "MarioOdyssey/MarioCharacter.h"
+#include "Capture/PlayerTargetSubsystem.h"
+#include "World/DeterministicSimSubsystem.h"
+#include "World/BossArenaController.h"
+#include "MarioOdyssey/MarioOdysseyStats.h"
+#include "MarioTimers.h"
 
 #include "Components/SphereComponent.h"
 #include "Components/PrimitiveComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "GameFramework/CharacterMovementComponent.h"
-#include "EngineUtils.h"
-#include "GameFramework/PlayerController.h"
 
 AAttrenashinBoss::AAttrenashinBoss()
 {
@@ -42,6 +46,19 @@ void AAttrenashinBoss::BeginPlay()
 {
 	Super::BeginPlay();
 
+	UDeterministicSimSubsystem::InitRandomStream(this, RandomStream);
+
+	// Retreat 충돌 전환 대상은 고정이라 여기서 1회만 수집(Retreat마다 GetComponents 안 함)
+	TInlineComponentArray<UPrimitiveComponent*> PrimComps(this);
+	RetreatCollisionSlots.Reset(PrimComps.Num());
+	for (UPrimitiveComponent* Prim : PrimComps)
+	{
+		if (Prim)
+		{
+			RetreatCollisionSlots.AddDefaulted_GetRef().Component = Prim;
+		}
+	}
+
 	if (HeadHitSphere)
 	{
 		HeadHitSphere->OnComponentBeginOverlap.AddDynamic(this, &AAttrenashinBoss::OnHeadBeginOverlap);
@@ -78,7 +95,9 @@ void AAttrenashinBoss::BeginPlay()
 		}
 	}
 
-	GetWorldTimerManager().SetTimerForNextTick([this]()
+	RegisterPhaseTicks();
+
+	MarioTimers::SetForNextTick(GetWorldTimerManager(), [this]()
 	{
 		StartIceRainByBothFists(); // 첫 연출(양손 동시)
 	});
@@ -86,35 +105,199 @@ void AAttrenashinBoss::BeginPlay()
 	SlamAttemptTimer = SlamAttemptInterval;
 }
 
+void AAttrenashinBoss::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	for (FAttrenashinPhaseTickFunction& PhaseTick : PhaseTicks)
+	{
+		PhaseTick.UnRegisterTickFunction();
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void AAttrenashinBoss::Tick(float DeltaSeconds)
 {
+	MARIO_SCOPE_CYCLE(STAT_MarioOdyssey_BossTick);
 	Super::Tick(DeltaSeconds);
 
-	// Phase1에서 캡쳐 해제(실패) 후 중앙 복귀가 진행 중이면
-	// 다른 Phase1 로직(후퇴/내려치기 등)보다 우선 처리한다.
+	// 페이즈별 로직은 PhaseTicks가 담당. 액터 Tick은 후퇴 이후/페이즈 로직 이전 시선 처리만
+	// (Phase1 중앙 복귀 중에는 시선 처리도 하지 않던 기존 동작 유지)
 	if (Phase == EAttrenashinPhase::Phase1 && bPhase1ReturnToCenterActive)
 	{
-		UpdatePhase1CaptureFailReturnToCenter(DeltaSeconds);
 		return;
 	}
 
-	if (bRetreating)
+	if (ShouldFacePlayerDuringPunch())
 	{
-		UpdateRetreat(DeltaSeconds);
+		FacePlayerYawOnly(DeltaSeconds);
 	}
+}
 
-	if (ShouldFacePlayerDuringPunch())
+void FAttrenashinPhaseTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (IsValid(Boss) && TickType != LEVELTICK_ViewportsOnly)
 	{
-		FacePlayerYawOnly(DeltaSeconds);
+		Boss->ExecutePhaseTick(Slot, DeltaTime);
 	}
+}
 
-	if (bPhase2FlowActive)
+FString FAttrenashinPhaseTickFunction::DiagnosticMessage()
+{
+	return FString::Printf(TEXT("%s[AttrenashinPhaseTick %s]"), Boss ? *Boss->GetFullName() : TEXT("None"), LexToString(Slot));
+}
+
+const TCHAR* LexToString(EAttrenashinTickSlot Slot)
+{
+	switch (Slot)
+	{
+	case EAttrenashinTickSlot::ReturnToCenter: return TEXT("ReturnToCenter");
+	case EAttrenashinTickSlot::Retreat:        return TEXT("Retreat");
+	case EAttrenashinTickSlot::Phase1:         return TEXT("Phase1");
+	case EAttrenashinTickSlot::Phase2Flow:     return TEXT("Phase2Flow");
+	default:                                   return TEXT("Invalid");
+	}
+}
+
+void AAttrenashinBoss::RegisterPhaseTicks()
+{
+	ULevel* Level = GetLevel();
+	if (!Level) return;
+
+	for (int32 Index = 0; Index < (int32)EAttrenashinTickSlot::Num; ++Index)
+	{
+		FAttrenashinPhaseTickFunction& PhaseTick = PhaseTicks[Index];
+		PhaseTick.Boss = this;
+		PhaseTick.Slot = (EAttrenashinTickSlot)Index;
+		PhaseTick.bCanEverTick = true;
+		PhaseTick.bStartWithTickEnabled = false;
+		PhaseTick.TickGroup = PrimaryActorTick.TickGroup;
+		PhaseTick.SetTickFunctionEnable(false);
+		PhaseTick.RegisterTickFunction(Level);
+	}
+
+	// 실행 순서는 기존 단일 Tick과 동일: 주먹 -> 후퇴 -> 시선(액터 Tick) -> 페이즈 로직
+	FAttrenashinPhaseTickFunction& RetreatTick = PhaseTicks[(int32)EAttrenashinTickSlot::Retreat];
+	if (LeftFist.IsValid())
+	{
+		RetreatTick.AddPrerequisite(LeftFist.Get(), LeftFist->PrimaryActorTick);
+	}
+	if (RightFist.IsValid())
+	{
+		RetreatTick.AddPrerequisite(RightFist.Get(), RightFist->PrimaryActorTick);
+	}
+	PrimaryActorTick.AddPrerequisite(this, RetreatTick);
+
+	for (const EAttrenashinTickSlot Slot : { EAttrenashinTickSlot::ReturnToCenter, EAttrenashinTickSlot::Phase1, EAttrenashinTickSlot::Phase2Flow })
+	{
+		PhaseTicks[(int32)Slot].AddPrerequisite(this, PrimaryActorTick);
+	}
+
+	RefreshPhaseTicks();
+}
+
+void AAttrenashinBoss::RefreshPhaseTicks()
+{
+	const bool bReturnToCenter = (Phase == EAttrenashinPhase::Phase1) && bPhase1ReturnToCenterActive;
+
+	auto Apply = [this](EAttrenashinTickSlot Slot, bool bEnable, float Interval)
 	{
+		FAttrenashinPhaseTickFunction& PhaseTick = PhaseTicks[(int32)Slot];
+		if (PhaseTick.TickInterval != Interval)
+		{
+			PhaseTick.UpdateTickIntervalAndCoolDown(Interval);
+		}
+		if (PhaseTick.IsTickFunctionEnabled() != bEnable)
+		{
+			PhaseTick.SetTickFunctionEnable(bEnable);
+		}
+	};
+
+	Apply(EAttrenashinTickSlot::ReturnToCenter, bReturnToCenter, 0.f);
+	Apply(EAttrenashinTickSlot::Retreat, bRetreating && !bReturnToCenter, 0.f);
+	Apply(EAttrenashinTickSlot::Phase1, Phase == EAttrenashinPhase::Phase1 && !bPhase2FlowActive && !bReturnToCenter, 0.f);
+	Apply(EAttrenashinTickSlot::Phase2Flow, bPhase2FlowActive && !bReturnToCenter, GetPhase2TickInterval());
+}
+
+float AAttrenashinBoss::GetPhase2TickInterval() const
+{
+	const float Idle = FMath::Max(0.f, PhaseIdleTickInterval);
+	if (Idle <= 0.f) return 0.f;
+
+	// 시간만 재는 상태는 남은 시간을 넘기지 않도록 간격을 줄여 전환 시점이 늦어지지 않게 한다
+	float Remaining = Idle;
+	switch (Phase2State)
+	{
+	case EPhase2FlowState::Rest:
+		Remaining = (bPhase3FlowMode ? Phase3RestAfterCenterSeconds : Phase2RestAfterCenterSeconds) - Phase2StateElapsed;
+		break;
+
+	case EPhase2FlowState::Spin:
+		Remaining = Phase2FistSpinSeconds - Phase2StateElapsed;
+		break;
+
+	case EPhase2FlowState::ShardRain:
+		break;
+
+	default:
+		return 0.f;
+	}
+
+	return FMath::Clamp(Remaining, 0.f, Idle);
+}
+
+void AAttrenashinBoss::ExecutePhaseTick(EAttrenashinTickSlot Slot, float DeltaSeconds)
+{
+#if !UE_BUILD_SHIPPING
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+#endif
+
+	switch (Slot)
+	{
+	case EAttrenashinTickSlot::ReturnToCenter:
+		UpdatePhase1CaptureFailReturnToCenter(DeltaSeconds);
+		break;
+
+	case EAttrenashinTickSlot::Retreat:
+		UpdateRetreat(DeltaSeconds);
+		break;
+
+	case EAttrenashinTickSlot::Phase1:
+		UpdatePhase1(DeltaSeconds);
+		break;
+
+	case EAttrenashinTickSlot::Phase2Flow:
 		UpdatePhase2(DeltaSeconds);
-		return;
+		break;
+
+	default:
+		break;
 	}
 
-	if (Phase != EAttrenashinPhase::Phase1) return;
+	// 상태 전환이 없어도 Rest/Spin의 남은 시간에 맞춰 간격을 갱신
+	RefreshPhaseTicks();
+
+#if !UE_BUILD_SHIPPING
+	FPhaseTickCost& Cost = PhaseTickCosts[(int32)Slot];
+	Cost.Cycles += FPlatformTime::Cycles64() - StartCycles;
+	++Cost.Calls;
+#endif
+}
+
+#if !UE_BUILD_SHIPPING
+void AAttrenashinBoss::ResetPhaseTickCosts()
+{
+	for (FPhaseTickCost& Cost : PhaseTickCosts)
+	{
+		Cost = FPhaseTickCost();
+	}
+}
+#endif
+
+void AAttrenashinBoss::UpdatePhase1(float DeltaSeconds)
+{
+	MARIO_SCOPE_CYCLE(STAT_MarioOdyssey_BossPhase1);
+
+	if (Phase != EAttrenashinPhase::Phase1 || bPhase2FlowActive) return;
 
 	AAttrenashinFist* CapturedNow = nullptr;
 	if (LeftFist.IsValid() && LeftFist->IsCapturedDriving())
@@ -160,51 +343,17 @@ void AAttrenashinBoss::Tick(float DeltaSeconds)
 
 AActor* AAttrenashinBoss::GetPlayerTarget() const
 {
-	UWorld* World = GetWorld();
-	if (!World)
-	{
-		return nullptr;
-	}
-
 	// 캡쳐 시스템 특성상 PlayerController가 몬스터(주먹)를 Possess할 수 있음.
-	// 이 경우에도 트래킹 대상은 항상 마리오여야 하므로 ViewTarget(카메라 타겟) -> Pawn -> 월드 탐색 순으로 찾는다.
-	if (APlayerController* PC = UGameplayStatics::GetPlayerController(World, 0))
-	{
-		if (AActor* VT = PC->GetViewTarget())
-		{
-			if (VT->IsA(AMarioCharacter::StaticClass()))
-			{
-				return VT;
-			}
-		}
-
-		if (APawn* Pawn = PC->GetPawn())
-		{
-			if (Pawn->IsA(AMarioCharacter::StaticClass()))
-			{
-				return Pawn;
-			}
-		}
-	}
-
-	if (ACharacter* C = UGameplayStatics::GetPlayerCharacter(World, 0))
-	{
-		if (C->IsA(AMarioCharacter::StaticClass()))
-		{
-			return C;
-		}
-	}
-
-	for (TActorIterator<AMarioCharacter> It(World); It; ++It)
-	{
-		AMarioCharacter* M = *It;
-		if (IsValid(M))
-		{
-			return M;
-		}
-	}
+	// 이 경우에도 트래킹 대상은 항상 마리오여야 하므로 레지스트리의 원본 마리오를 사용한다.
+	const UPlayerTargetSubsystem* Targets = UPlayerTargetSubsystem::Get(this);
+	return Targets ? Targets->GetMario() : nullptr;
+}
 
-	return nullptr;
+bool AAttrenashinBoss::SampleArenaGroundZ(const FVector& WorldXY, float& OutZ) const
+{
+	// 보스는 아레나가 Owner로 스폰한다(ABossArenaController::SpawnBossNow)
+	const ABossArenaController* Arena = Cast<ABossArenaController>(GetOwner());
+	return Arena && Arena->SampleArenaGroundZ(WorldXY, OutZ);
 }
 
 bool AAttrenashinBoss::IsPhase2FistSpinWindow() const
@@ -332,22 +481,26 @@ void AAttrenashinBoss::SpawnIceShardsAt(const FVector& Center)
 	if (!GetWorld()) return;
 	if (!IceShardClass) return;
 
+	UIceShardPoolSubsystem* Pool = GetWorld()->GetSubsystem<UIceShardPoolSubsystem>();
+
 	FActorSpawnParameters SP;
 	SP.Owner = this;
 	SP.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
 
 	for (int32 i = 0; i < IceShardCount; ++i)
 	{
-		const float Angle = FMath::FRandRange(0.f, 2.f * PI);
-		const float Radius = FMath::Sqrt(FMath::FRand()) * IceRainWorldRadius;
+		const float Angle = RandomStream.FRandRange(0.f, 2.f * PI);
+		const float Radius = FMath::Sqrt(RandomStream.FRand()) * IceRainWorldRadius;
 
 		const float X = FMath::Cos(Angle) * Radius;
 		const float Y = FMath::Sin(Angle) * Radius;
-		const float ZJitter = FMath::FRandRange(-IceShardSpawnHeightJitter, IceShardSpawnHeightJitter);
+		const float ZJitter = RandomStream.FRandRange(-IceShardSpawnHeightJitter, IceShardSpawnHeightJitter);
 
 		const FVector SpawnLoc(Center.X + X, Center.Y + Y, Center.Z + IceShardSpawnHeight + ZJitter);
 
-		AIceShardActor* Shard = GetWorld()->SpawnActor<AIceShardActor>(IceShardClass, SpawnLoc, FRotator::ZeroRotator, SP);
+		AIceShardActor* Shard = Pool
+			? Pool->AcquireShard(IceShardClass, SpawnLoc, FRotator::ZeroRotator, this)
+			: GetWorld()->SpawnActor<AIceShardActor>(IceShardClass, SpawnLoc, FRotator::ZeroRotator, SP);
 		if (Shard)
 		{
 			Shard->InitShard(this, IceShardDamage, IceTileClass, IceTileSpawnZOffset);
@@ -355,6 +508,17 @@ void AAttrenashinBoss::SpawnIceShardsAt(const FVector& Center)
 	}
 }
 
+void AAttrenashinBoss::PrewarmIceShardPool(int32 ShardCount, int32 TileCount)
+{
+	UWorld* World = GetWorld();
+	if (!World) return;
+
+	if (UIceShardPoolSubsystem* Pool = World->GetSubsystem<UIceShardPoolSubsystem>())
+	{
+		Pool->Prewarm(IceShardClass, FMath::Max(0, ShardCount), IceTileClass, FMath::Max(0, TileCount));
+	}
+}
+
 void AAttrenashinBoss::NotifyFistCaptured(AAttrenashinFist* CapturedFist)
 {
 	if (!CapturedFist) return;
@@ -399,8 +563,7 @@ void AAttrenashinBoss::NotifyFistReleased(AAttrenashinFist* ReleasedFist)
 		(!RightFist.IsValid() || !RightFist->IsCapturedDriving()))
 	{
 		bIsInFear = false;
-		bRetreating = false;
-		SetWorldDynamicIgnoredForRetreat(false);
+		SetRetreating(false);
 		
 		// 3초 뒤 보스/손이 맵 중앙으로 동일 속도(Phase2 복귀 속도)로 복귀.
 		if (Phase == EAttrenashinPhase::Phase1 && !bPhase2FlowActive && (bWasInFear || bWasRetreating || bWasBarrageActive))
@@ -408,7 +571,7 @@ void AAttrenashinBoss::NotifyFistReleased(AAttrenashinFist* ReleasedFist)
 			if (UWorld* World = GetWorld())
 			{
 				World->GetTimerManager().ClearTimer(Phase1CaptureFailReturnTimerHandle);
-				World->GetTimerManager().SetTimer(
+				MarioTimers::Set(World->GetTimerManager(),
 					Phase1CaptureFailReturnTimerHandle,
 					this,
 					&AAttrenashinBoss::BeginPhase1CaptureFailReturnToCenter,
@@ -471,7 +634,7 @@ void AAttrenashinBoss::StartCaptureBarrage(AAttrenashinFist* CapturedFist)
 
 	// 정확히 1초 주기 발사
 	const float Period = FMath::Max(0.1f, CaptureBarrageIntervalSeconds);
-	GetWorldTimerManager().SetTimer(
+	MarioTimers::Set(GetWorldTimerManager(),
 		CaptureBarrageTimerHandle,
 		this,
 		&AAttrenashinBoss::HandleCaptureBarrageTick,
@@ -526,7 +689,8 @@ void AAttrenashinBoss::HandleCaptureBarrageTick()
 	}
 	
 	const FVector StartBase = GetAnchorLocationBySide(Throwing->GetFistSide());
-	const FVector TargetLoc = GetPlayerTarget() ? GetPlayerTarget()->GetActorLocation() : Captured->GetActorLocation();
+	const AActor* PlayerTarget = GetPlayerTarget();
+	const FVector TargetLoc = PlayerTarget ? PlayerTarget->GetActorLocation() : Captured->GetActorLocation();
 
 	FVector Dir = (TargetLoc - StartBase).GetSafeNormal();
 	if (Dir.IsNearlyZero())
@@ -536,11 +700,19 @@ void AAttrenashinBoss::HandleCaptureBarrageTick()
 	const FVector Start = StartBase + Dir * CaptureBarrageSpawnForwardOffset;
 	const FVector Velocity = Dir * CaptureBarrageShardSpeed;
 
-	FActorSpawnParameters SP;
-	SP.Owner = this;
-	SP.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	AIceShardActor* Shard = nullptr;
+	if (UIceShardPoolSubsystem* Pool = GetWorld()->GetSubsystem<UIceShardPoolSubsystem>())
+	{
+		Shard = Pool->AcquireShard(IceShardClass, Start, Velocity.Rotation(), this);
+	}
+	else
+	{
+		FActorSpawnParameters SP;
+		SP.Owner = this;
+		SP.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
 
-	AIceShardActor* Shard = GetWorld()->SpawnActor<AIceShardActor>(IceShardClass, Start, Velocity.Rotation(), SP);
+		Shard = GetWorld()->SpawnActor<AIceShardActor>(IceShardClass, Start, Velocity.Rotation(), SP);
+	}
 	if (!Shard)
 	{
 		return;
@@ -556,8 +728,7 @@ void AAttrenashinBoss::StartRetreatMotion()
 	AActor* Target = GetPlayerTarget();
 	if (!Target)
 	{
-		bRetreating = false;
-		SetWorldDynamicIgnoredForRetreat(false);
+		SetRetreating(false);
 		return;
 	}
 
@@ -622,12 +793,12 @@ void AAttrenashinBoss::StartRetreatMotion()
 	RetreatTarget = FVector(Target2D.X, Target2D.Y, RetreatStart.Z);
 
 	RetreatT = 0.f;
-	bRetreating = !RetreatStart.Equals(RetreatTarget, 1.f);
-	SetWorldDynamicIgnoredForRetreat(bRetreating);
+	SetRetreating(!RetreatStart.Equals(RetreatTarget, 1.f));
 }
 
 void AAttrenashinBoss::UpdateRetreat(float DeltaSeconds)
 {
+	MARIO_SCOPE_CYCLE(STAT_MarioOdyssey_BossRetreat);
 	if (!bRetreating) return;
 
 	const FVector OldLoc = GetActorLocation();
@@ -649,11 +820,16 @@ void AAttrenashinBoss::UpdateRetreat(float DeltaSeconds)
 
 	if (NewLoc.Equals(RetreatTarget, 1.f))
 	{
-		bRetreating = false;
-		SetWorldDynamicIgnoredForRetreat(false);
+		SetRetreating(false);
 	}
 }
 
+void AAttrenashinBoss::SetRetreating(bool bNewRetreating)
+{
+	bRetreating = bNewRetreating;
+	SetWorldDynamicIgnoredForRetreat(bRetreating);
+	RefreshPhaseTicks();
+}
 
 void AAttrenashinBoss::SetWorldDynamicIgnoredForRetreat(bool bIgnore)
 {
@@ -664,22 +840,18 @@ void AAttrenashinBoss::SetWorldDynamicIgnoredForRetreat(bool bIgnore)
 			return;
 		}
 
-		CachedWorldDynamicResponses.Empty();
-		CachedWorldStaticResponses.Empty();
-
-		TArray<UPrimitiveComponent*> PrimComps;
-		GetComponents<UPrimitiveComponent>(PrimComps);
-
-		for (UPrimitiveComponent* Prim : PrimComps)
+		for (FRetreatCollisionSlot& Slot : RetreatCollisionSlots)
 		{
+			UPrimitiveComponent* Prim = Slot.Component.Get();
 			if (!Prim) continue;
 
-			// 현재 응답값 캐시 후, Retreat 중에만 WorldDynamic/WorldStatic 무시
-			CachedWorldDynamicResponses.Add(Prim, Prim->GetCollisionResponseToChannel(ECC_WorldDynamic));
-			CachedWorldStaticResponses.Add(Prim, Prim->GetCollisionResponseToChannel(ECC_WorldStatic));
+			// 현재 설정 저장 후, Retreat 중에만 WorldDynamic/WorldStatic 무시(컴포넌트당 응답 교체 1회)
+			Slot.Saved = FCollisionResponseSnapshot::Capture(Prim);
 
-			Prim->SetCollisionResponseToChannel(ECC_WorldDynamic, ECR_Ignore);
-			Prim->SetCollisionResponseToChannel(ECC_WorldStatic, ECR_Ignore);
+			FCollisionResponseSnapshot Retreat = Slot.Saved;
+			Retreat.SetResponse(ECC_WorldDynamic, ECR_Ignore)
+				.SetResponse(ECC_WorldStatic, ECR_Ignore)
+				.ApplyTo(Prim);
 		}
 
 		bWorldDynamicIgnoredForRetreat = true;
@@ -691,22 +863,11 @@ void AAttrenashinBoss::SetWorldDynamicIgnoredForRetreat(bool bIgnore)
 		return;
 	}
 
-	for (const TPair<TObjectPtr<UPrimitiveComponent>, TEnumAsByte<ECollisionResponse>>& It : CachedWorldDynamicResponses)
-	{
-		UPrimitiveComponent* Prim = It.Key.Get();
-		if (!Prim) continue;
-		Prim->SetCollisionResponseToChannel(ECC_WorldDynamic, static_cast<ECollisionResponse>(It.Value));
-	}
-
-	for (const TPair<TObjectPtr<UPrimitiveComponent>, TEnumAsByte<ECollisionResponse>>& It : CachedWorldStaticResponses)
+	for (const FRetreatCollisionSlot& Slot : RetreatCollisionSlots)
 	{
-		UPrimitiveComponent* Prim = It.Key.Get();
-		if (!Prim) continue;
-		Prim->SetCollisionResponseToChannel(ECC_WorldStatic, static_cast<ECollisionResponse>(It.Value));
+		Slot.Saved.ApplyTo(Slot.Component.Get());
 	}
 
-	CachedWorldDynamicResponses.Empty();
-	CachedWorldStaticResponses.Empty();
 	bWorldDynamicIgnoredForRetreat = false;
 }
 
@@ -855,8 +1016,7 @@ void AAttrenashinBoss::BeginAdvancedPhaseFromHeadHit(EAttrenashinPhase TargetPha
 	bPhase2FlowActive = true;
 	bPhase3FlowMode = bUsePhase3Rules;
 	bIsInFear = false;
-	bRetreating = false;
-	SetWorldDynamicIgnoredForRetreat(false);
+	SetRetreating(false);
 	StopCaptureBarrage();
 
 	Phase2RetreatBossLocation = GetActorLocation();
@@ -1008,6 +1168,8 @@ void AAttrenashinBoss::EnterPhase2State(EPhase2FlowState NewState)
 	default:
 		break;
 	}
+
+	RefreshPhaseTicks();
 }
 
 void AAttrenashinBoss::StartPhase2Dash()
@@ -1015,15 +1177,23 @@ void AAttrenashinBoss::StartPhase2Dash()
 	AAttrenashinFist* L = LeftFist.Get();
 	AAttrenashinFist* R = RightFist.Get();
 
-	Phase2DashStartL = L ? L->GetActorLocation() : FVector::ZeroVector;
-	Phase2DashStartR = R ? R->GetActorLocation() : FVector::ZeroVector;
-
 	const FVector OppositeBossLoc = BuildPhase2OppositeBossLocation();
 	const FVector LOffset = FistAnchorL ? (FistAnchorL->GetComponentLocation() - GetActorLocation()) : FVector::ZeroVector;
 	const FVector ROffset = FistAnchorR ? (FistAnchorR->GetComponentLocation() - GetActorLocation()) : FVector::ZeroVector;
 
-	Phase2DashTargetL = OppositeBossLoc + LOffset;
-	Phase2DashTargetR = OppositeBossLoc + ROffset;
+	// 속도 지정 시 주먹별 거리/속도가 구간 시간(등속 직선), 아니면 두 주먹 모두 Phase2FistDashSeconds
+	const float DashSpeed = FMath::Max(0.f, Phase2FistDashSpeed);
+	auto MakeDash = [this, DashSpeed](const AAttrenashinFist* F, const FVector& Target)
+	{
+		const FVector Start = F ? F->GetActorLocation() : FVector::ZeroVector;
+		const float Duration = (DashSpeed > KINDA_SMALL_NUMBER)
+			? FVector::Dist(Start, Target) / DashSpeed
+			: FMath::Max(0.01f, Phase2FistDashSeconds);
+		return FAttrenashinTrajectory::Make(Start, Target, Duration);
+	};
+
+	Phase2DashL = MakeDash(L, OppositeBossLoc + LOffset);
+	Phase2DashR = MakeDash(R, OppositeBossLoc + ROffset);
 }
 
 void AAttrenashinBoss::CachePhase3ClapTargets()
@@ -1080,6 +1250,7 @@ void AAttrenashinBoss::CachePhase3ClapTargets()
 
 void AAttrenashinBoss::UpdatePhase3Clap(float DeltaSeconds)
 {
+	MARIO_SCOPE_CYCLE(STAT_MarioOdyssey_BossPhase3Clap);
 	AAttrenashinFist* L = LeftFist.Get();
 	AAttrenashinFist* R = RightFist.Get();
 	if (!L && !R)
@@ -1249,6 +1420,7 @@ void AAttrenashinBoss::UpdatePhase3Clap(float DeltaSeconds)
 
 void AAttrenashinBoss::UpdatePhase2(float DeltaSeconds)
 {
+	MARIO_SCOPE_CYCLE(STAT_MarioOdyssey_BossPhase2);
 	Phase2StateElapsed += FMath::Max(0.f, DeltaSeconds);
 
 	AAttrenashinFist* L = LeftFist.Get();
@@ -1310,59 +1482,29 @@ void AAttrenashinBoss::UpdatePhase2(float DeltaSeconds)
 
 	case EPhase2FlowState::Dash:
 	{
-		const float DashSpeed = FMath::Max(0.f, Phase2FistDashSpeed);
-
-		if (DashSpeed > KINDA_SMALL_NUMBER)
+		// 시작 시 정한 직선 구간을 경과 시간으로 평가하고, 도착 시점에만 스윕
+		// 속도 모드에서는 캡쳐된 주먹이 도착할 수 없으므로 해제될 때까지 대기(기존 동작)
+		const bool bSpeedMode = Phase2FistDashSpeed > KINDA_SMALL_NUMBER;
+		auto DashFist = [this, bSpeedMode](AAttrenashinFist* F, const FAttrenashinTrajectory& Dash)
 		{
-			auto DashFistBySpeed = [DashSpeed, DeltaSeconds](AAttrenashinFist* F, const FVector& Target)
-			{
-				if (!F) return true;
-				if (F->IsCapturedDriving()) return false;
-
-				const FVector Cur = F->GetActorLocation();
-				const FVector NewLoc = FMath::VInterpConstantTo(Cur, Target, DeltaSeconds, DashSpeed);
-				F->SetActorLocation(NewLoc, false, nullptr, ETeleportType::TeleportPhysics);
+			if (!F) return true;
+			if (F->IsCapturedDriving()) return !bSpeedMode;
 
-				const bool bArrived = NewLoc.Equals(Target, 2.f);
-				if (bArrived)
-				{
-					F->SetActorLocation(Target, true, nullptr, ETeleportType::TeleportPhysics);
-				}
-				return bArrived;
-			};
+			const bool bArrived = Dash.IsFinished(Phase2StateElapsed);
+			F->SetActorLocation(Dash.Evaluate(Phase2StateElapsed), bArrived, nullptr, ETeleportType::TeleportPhysics);
+			return bArrived;
+		};
 
-			const bool bLArrived = DashFistBySpeed(L, Phase2DashTargetL);
-			const bool bRArrived = DashFistBySpeed(R, Phase2DashTargetR);
+		const bool bLArrived = DashFist(L, Phase2DashL);
+		const bool bRArrived = DashFist(R, Phase2DashR);
 
-			if (bLArrived && bRArrived)
-			{
-				EnterPhase2State(EPhase2FlowState::ReturnToCenter);
-			}
-		}
-		else
+		if (bLArrived && bRArrived)
 		{
-			const float T = FMath::Clamp(Phase2StateElapsed / FMath::Max(0.01f, Phase2FistDashSeconds), 0.f, 1.f);
-
-			auto DashFistByTime = [T](AAttrenashinFist* F, const FVector& Start, const FVector& Target)
-			{
-				if (!F) return;
-				if (F->IsCapturedDriving()) return;
-				const FVector P2 = FMath::Lerp(Start, Target, T);
-				F->SetActorLocation(P2, true, nullptr, ETeleportType::TeleportPhysics);
-			};
-
-			DashFistByTime(L, Phase2DashStartL, Phase2DashTargetL);
-			DashFistByTime(R, Phase2DashStartR, Phase2DashTargetR);
-
-			if (T >= 1.f - KINDA_SMALL_NUMBER)
-			{
-				EnterPhase2State(EPhase2FlowState::ReturnToCenter);
-			}
+			EnterPhase2State(EPhase2FlowState::ReturnToCenter);
 		}
 		break;
 	}
 
-
 	case EPhase2FlowState::Clap:
 	{
 		UpdatePhase3Clap(DeltaSeconds);
@@ -1455,8 +1597,7 @@ void AAttrenashinBoss::UpdatePhase2(float DeltaSeconds)
 		{
 			StopCaptureBarrage();
 			bIsInFear = false;
-			bRetreating = false;
-			SetWorldDynamicIgnoredForRetreat(false);
+			SetRetreating(false);
 		}
 
 		Phase2AlternatingSlamTimer -= DeltaSeconds;
@@ -1507,6 +1648,8 @@ void AAttrenashinBoss::EnterPhase(EAttrenashinPhase NewPhase)
 			RightFist->SetPhase3ClapAnimActive(false);
 		}
 	}
+
+	RefreshPhaseTicks();
 }
 
 void AAttrenashinBoss::EndPhase1CaptureWindow(bool bSuccess)
@@ -1532,6 +1675,8 @@ void AAttrenashinBoss::CancelPhase1CaptureFailReturnToCenter()
 	Phase1ReturnToCenterElapsed = 0.f;
 	Phase1ReturnToCenterStart = FVector::ZeroVector;
 	Phase1ReturnToCenterTarget = FVector::ZeroVector;
+
+	RefreshPhaseTicks();
 }
 
 void AAttrenashinBoss::BeginPhase1CaptureFailReturnToCenter()
@@ -1550,10 +1695,14 @@ void AAttrenashinBoss::BeginPhase1CaptureFailReturnToCenter()
 
 	// 손들은 앵커로 복귀하도록 걸어두고, 보스 이동은 Phase2 복귀 속도와 동일하게 처리.
 	ForceFistsReturnToAnchor(FMath::Max(0.01f, Phase2ReturnToCenterSeconds));
+
+	RefreshPhaseTicks();
 }
 
 void AAttrenashinBoss::UpdatePhase1CaptureFailReturnToCenter(float DeltaSeconds)
 {
+	MARIO_SCOPE_CYCLE(STAT_MarioOdyssey_BossReturnToCenter);
+
 	// 안전장치: Phase1 외엔 실행하지 않음
 	if (Phase != EAttrenashinPhase::Phase1)
 	{
@@ -1578,3 +1727,36 @@ void AAttrenashinBoss::UpdatePhase1CaptureFailReturnToCenter(float DeltaSeconds)
 		Phase1ReturnToCenterElapsed = 0.f;
 	}
 }
+
+#if !UE_BUILD_SHIPPING
+#include "EngineUtils.h"
+#include "Dev/MarioBenchCommand.h"
+
+namespace AttrenashinBossDebug
+{
+	// 보스 페이즈별 틱 비용: 지난 호출(또는 BeginPlay) 이후 누적을 출력하고 리셋
+	static FMarioBenchCommand MarioBossTickCostsCommand(
+		TEXT("mario.BossTickCosts"),
+		TEXT("보스 페이즈 틱 함수별 누적 CPU 비용 출력 후 리셋"),
+		[](const TArray<FString>& Args, UWorld* World)
+		{
+			for (TActorIterator<AAttrenashinBoss> It(World); It; ++It)
+			{
+				AAttrenashinBoss* Boss = *It;
+				UE_LOG(LogMarioBench, Display, TEXT("[MarioBench] BossTickCosts %s (phase %d)"), *Boss->GetName(), (int32)Boss->GetPhase());
+
+				for (int32 Index = 0; Index < (int32)EAttrenashinTickSlot::Num; ++Index)
+				{
+					const EAttrenashinTickSlot Slot = (EAttrenashinTickSlot)Index;
+					const AAttrenashinBoss::FPhaseTickCost& Cost = Boss->GetPhaseTickCost(Slot);
+					const double TotalMs = FPlatformTime::ToMilliseconds64(Cost.Cycles);
+					UE_LOG(LogMarioBench, Display, TEXT("  %-14s %s interval %.3fs: %d calls, %.3f ms total, %.2f us/call"),
+						LexToString(Slot), Boss->IsPhaseTickEnabled(Slot) ? TEXT("on ") : TEXT("off"), Boss->GetPhaseTickInterval(Slot),
+						Cost.Calls, TotalMs, Cost.Calls > 0 ? TotalMs * 1000.0 / Cost.Calls : 0.0);
+				}
+
+				Boss->ResetPhaseTickCosts();
+			}
+		});
+}
+#endif
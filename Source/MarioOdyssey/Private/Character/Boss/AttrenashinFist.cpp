@@ -1,6 +1,5 @@
 #include "Character/Boss/AttrenashinFist.h"
 #include "Character/Boss/AttrenashinBoss.h"
-#include "Character/Boss/IceTileActor.h"
 
 #include "Components/CapsuleComponent.h"
 #include "Components/SkeletalMeshComponent.h"
@@ -11,10 +10,14 @@
 #include "InputCoreTypes.h"
 #include "InputActionValue.h"
 #include "Capture/CaptureComponent.h"
+#include "Capture/PlayerTargetSubsystem.h"
+#include "World/ActorRegistrySubsystem.h"
+#include "World/IceTileGridSubsystem.h"
 #include "MarioOdyssey/MarioCharacter.h"
+#include "MarioOdyssey/MarioOdysseyStats.h"
+#include "MarioSceneQuery.h"
 
 #include "Engine/EngineTypes.h"
-#include "Engine/OverlapResult.h"
 #include "Kismet/GameplayStatics.h"
 #include "HAL/IConsoleManager.h"
 #include "Logging/LogMacros.h"
@@ -65,6 +68,20 @@ AAttrenashinFist::AAttrenashinFist()
 	SetDamageOverlapEnabled(false);
 }
 
+void AAttrenashinFist::BeginPlay()
+{
+	Super::BeginPlay();
+
+	UActorRegistrySubsystem::AutoRegister(this);
+}
+
+void AAttrenashinFist::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UActorRegistrySubsystem::AutoUnregister(this);
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void AAttrenashinFist::SetDamageOverlapEnabled(bool bEnable)
 {
 	if (!ContactSphere) return;
@@ -182,7 +199,8 @@ void AAttrenashinFist::ForceReleaseCaptureByBoss()
 	AMarioCharacter* Mario = Cast<AMarioCharacter>(PC->GetViewTarget());
 	if (!Mario)
 	{
-		Mario = Cast<AMarioCharacter>(UGameplayStatics::GetPlayerCharacter(GetWorld(), 0));
+		const UPlayerTargetSubsystem* Targets = UPlayerTargetSubsystem::Get(this);
+		Mario = Targets ? Targets->GetMario() : nullptr;
 	}
 	if (!Mario) return;
 
@@ -268,6 +286,7 @@ void AAttrenashinFist::StartSlamSequence(AActor* TargetActor)
 
 	SlamSeq = EAttrenashinSlamSeq::MoveAbove;
 	SlamSeqT = 0.f;
+	BeginHoverMotion(MoveAboveSeconds);
 
 	bPendingStun = false;
 	SetDamageOverlapEnabled(false);
@@ -299,8 +318,9 @@ void AAttrenashinFist::StartIceRainSlam()
 	IceRainT = 0.f;
 	bIceRainImpactFired = false;
 
-	IceRainStartLoc = GetActorLocation();
-	IceRainApexLoc = IceRainStartLoc + FVector(0.f, 0.f, IceRainRiseZ);
+	const FVector StartLoc = GetActorLocation();
+	IceRainRise = FAttrenashinTrajectory::Make(StartLoc, StartLoc + FVector(0.f, 0.f, IceRainRiseZ), IceRainRiseSeconds,
+		FAttrenashinTrajectory::EEase::EaseOut, 2.0f);
 	BuildIceRainImpactPoint();
 
 	EnterState(EFistState::IceRainSlam);
@@ -308,6 +328,7 @@ void AAttrenashinFist::StartIceRainSlam()
 
 void AAttrenashinFist::Tick(float DeltaSeconds)
 {
+	MARIO_SCOPE_CYCLE(STAT_MarioOdyssey_FistTick);
 	Super::Tick(DeltaSeconds);
 
 	// 데미지 오버랩은 스턴용 SlamDown 구간에만 ON
@@ -388,29 +409,48 @@ FVector AAttrenashinFist::GetDesiredHoverLocation() const
 	return HeadBase + FVector(0, 0, HoverExtraZ);
 }
 
-void AAttrenashinFist::MoveTowardAdaptive(const FVector& Target, float Dt, float TimeRemaining, float MaxSpeed, bool bSweep)
+void AAttrenashinFist::BeginHoverMotion(float DurationSeconds)
+{
+	Motion = FAttrenashinTrajectory::Make(GetActorLocation(), GetDesiredHoverLocation(), DurationSeconds);
+}
+
+void AAttrenashinFist::MoveAlongMotion(const FVector& Desired, float Dt, float MaxSpeed)
 {
+	// 추적 목표가 순간이동해도 주먹은 MaxSpeed 이내로만 따라간다
 	const FVector Cur = GetActorLocation();
-	FVector Delta = Target - Cur;
-	const float Dist = Delta.Size();
+	const FVector NewLoc = Cur + (Desired - Cur).GetClampedToMaxSize(FMath::Max(0.f, MaxSpeed) * Dt);
+	SetActorLocation(NewLoc, false, nullptr, ETeleportType::None);
+}
 
-	if (Dist <= 0.5f)
+void AAttrenashinFist::MoveTowardImpact(const FVector& Desired, const FVector& Impact)
+{
+	// 공중 구간은 곡선 위치로 바로, 착지 직전만 스윕해서 실제 바닥/장애물에 멈춘다
+	const bool bNearImpact = (Desired.Z - Impact.Z) <= ImpactSweepHeight;
+	SetActorLocation(Desired, bNearImpact, nullptr, ETeleportType::None);
+}
+
+float AAttrenashinFist::ResolveGroundZ(const FVector& WorldXY) const
+{
+	float GroundZ = 0.f;
+	if (Boss.IsValid() && Boss->SampleArenaGroundZ(WorldXY, GroundZ))
 	{
-		SetActorLocation(Target, bSweep, nullptr, ETeleportType::None);
-		return;
+		return GroundZ;
 	}
 
-	Delta /= Dist;
+	// 아레나 높이 격자 밖/아직 채우는 중(또는 바닥 없는 셀): 기존 수직 트레이스
+	const FVector TraceStart = WorldXY + FVector(0, 0, 8000.f);
+	const FVector TraceEnd = WorldXY + FVector(0, 0, -8000.f);
 
-	const float SafeRemain = FMath::Max(0.001f, TimeRemaining);
-	const float RequiredSpeed = Dist / SafeRemain;
-	const float Speed = FMath::Min(MaxSpeed, RequiredSpeed);
+	FHitResult Hit;
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(AttrenashinFistGroundTrace), false, this);
 
-	const float Step = Speed * Dt;
-	const float ClampedStep = FMath::Min(Step, Dist);
+	bool bHit = false;
+	if (UWorld* World = GetWorld())
+	{
+		bHit = MarioSceneQuery::LineTraceSingleByChannel(World, Hit, TraceStart, TraceEnd, ECC_Visibility, Params);
+	}
 
-	const FVector NewLoc = Cur + Delta * ClampedStep;
-	SetActorLocation(NewLoc, bSweep, nullptr, ETeleportType::None);
+	return bHit ? Hit.ImpactPoint.Z : TraceEnd.Z;
 }
 
 void AAttrenashinFist::TickSlamSequence(float Dt)
@@ -434,23 +474,20 @@ void AAttrenashinFist::TickSlamSequence(float Dt)
 	{
 	case EAttrenashinSlamSeq::MoveAbove:
 	{
-		const float Remain = FMath::Max(0.f, MoveAboveSeconds - SlamSeqT);
-		const FVector DesiredNow = GetDesiredHoverLocation();
-		MoveTowardAdaptive(DesiredNow, Dt, Remain, MoveAboveMaxSpeed, true);
+		MoveAlongMotion(Motion.EvaluateTracking(SlamSeqT, GetDesiredHoverLocation()), Dt, MoveAboveMaxSpeed);
 
 		if (SlamSeqT >= MoveAboveSeconds)
 		{
 			SlamSeq = EAttrenashinSlamSeq::FollowAbove;
 			SlamSeqT = 0.f;
+			BeginHoverMotion(FollowAboveSeconds);
 		}
 		break;
 	}
 
 	case EAttrenashinSlamSeq::FollowAbove:
 	{
-		const float Remain = FMath::Max(0.f, FollowAboveSeconds - SlamSeqT);
-		const FVector Desired = GetDesiredHoverLocation();
-		MoveTowardAdaptive(Desired, Dt, Remain, FollowAboveMaxSpeed, true);
+		MoveAlongMotion(Motion.EvaluateTracking(SlamSeqT, GetDesiredHoverLocation()), Dt, FollowAboveMaxSpeed);
 
 		if (SlamSeqT >= FollowAboveSeconds)
 		{
@@ -503,32 +540,19 @@ void AAttrenashinFist::TickSlamSequence(float Dt)
 void AAttrenashinFist::BeginSlamDown()
 {
 	const FVector XY = SeqFrozenImpactXY;
-
-	const FVector TraceStart = XY + FVector(0, 0, 8000.f);
-	const FVector TraceEnd = XY + FVector(0, 0, -8000.f);
-
-	FHitResult Hit;
-	FCollisionQueryParams Params(SCENE_QUERY_STAT(AttrenashinFistSlamDownTrace), false, this);
-
-	bool bHit = false;
-	if (UWorld* World = GetWorld())
-	{
-		bHit = World->LineTraceSingleByChannel(Hit, TraceStart, TraceEnd, ECC_Visibility, Params);
-	}
-
-	const FVector ImpactPoint = bHit ? Hit.ImpactPoint : TraceEnd;
+	const float GroundZ = ResolveGroundZ(XY);
 
 	const float HalfH = GetCapsuleComponent() ? GetCapsuleComponent()->GetScaledCapsuleHalfHeight() : 0.f;
-	SeqSlamDownTargetLoc = FVector(XY.X, XY.Y, ImpactPoint.Z + HalfH);
+	SeqSlamDownTargetLoc = FVector(XY.X, XY.Y, GroundZ + HalfH);
+	Motion = FAttrenashinTrajectory::Make(SeqFrozenHoverLoc, SeqSlamDownTargetLoc, SlamDownSeconds);
 
 	// 스턴용 시퀀스에서만 타일 스턴 판정
-	bPendingStun = (!bIgnoreIceStun) && IsOnIceTileAt(FVector(XY.X, XY.Y, ImpactPoint.Z));
+	bPendingStun = (!bIgnoreIceStun) && IsOnIceTileAt(FVector(XY.X, XY.Y, GroundZ));
 }
 
 void AAttrenashinFist::TickSlamDown(float Dt)
 {
-	const float Remain = FMath::Max(0.f, SlamDownSeconds - SlamSeqT);
-	MoveTowardAdaptive(SeqSlamDownTargetLoc, Dt, Remain, 500000.f, true);
+	MoveTowardImpact(Motion.Evaluate(SlamSeqT), SeqSlamDownTargetLoc);
 
 	if (SlamSeqT >= SlamDownSeconds)
 	{
@@ -539,45 +563,33 @@ void AAttrenashinFist::TickSlamDown(float Dt)
 
 void AAttrenashinFist::BuildIceRainImpactPoint()
 {
-	const FVector XY = IceRainStartLoc;
-	const FVector TraceStart = FVector(XY.X, XY.Y, XY.Z + 8000.f);
-	const FVector TraceEnd   = FVector(XY.X, XY.Y, XY.Z - 8000.f);
-
-	FHitResult Hit;
-	FCollisionQueryParams Params(SCENE_QUERY_STAT(AttrenashinIceRainTrace), false, this);
-
-	const bool bHit = GetWorld() &&
-		GetWorld()->LineTraceSingleByChannel(Hit, TraceStart, TraceEnd, ECC_Visibility, Params);
-
-	const FVector Impact = bHit ? Hit.ImpactPoint : TraceEnd;
+	const FVector XY = IceRainRise.Start;
 	const float HalfH = GetCapsuleComponent() ? GetCapsuleComponent()->GetScaledCapsuleHalfHeight() : 0.f;
-	IceRainImpactLoc = FVector(XY.X, XY.Y, Impact.Z + HalfH);
+	const FVector ImpactLoc(XY.X, XY.Y, ResolveGroundZ(XY) + HalfH);
+
+	IceRainDrop = FAttrenashinTrajectory::Make(IceRainRise.End, ImpactLoc, IceRainDropSeconds,
+		FAttrenashinTrajectory::EEase::EaseIn, 3.0f);
 }
 
 void AAttrenashinFist::TickIceRainSlam(float Dt)
 {
 	IceRainT += Dt;
 
-	const float Total = IceRainRiseSeconds + IceRainDropSeconds;
+	const float Total = IceRainRise.Duration + IceRainDrop.Duration;
 
-	if (IceRainT <= IceRainRiseSeconds)
+	if (IceRainT <= IceRainRise.Duration)
 	{
 		// 1.33초 상승
-		const float Alpha = FMath::Clamp(IceRainT / IceRainRiseSeconds, 0.f, 1.f);
-		const float Eased = FMath::InterpEaseOut(0.f, 1.f, Alpha, 2.0f);
-		const FVector P = FMath::Lerp(IceRainStartLoc, IceRainApexLoc, Eased);
-		SetActorLocation(P, true, nullptr, ETeleportType::None);
+		SetActorLocation(IceRainRise.Evaluate(IceRainT), false, nullptr, ETeleportType::None);
 	}
 	else
 	{
 		// 0.17초 급하강
-		const float DropAlpha = FMath::Clamp((IceRainT - IceRainRiseSeconds) / IceRainDropSeconds, 0.f, 1.f);
-		const float Eased = FMath::InterpEaseIn(0.f, 1.f, DropAlpha, 3.0f);
-		const FVector P = FMath::Lerp(IceRainApexLoc, IceRainImpactLoc, Eased);
-		SetActorLocation(P, true, nullptr, ETeleportType::None);
+		const float DropT = IceRainT - IceRainRise.Duration;
+		MoveTowardImpact(IceRainDrop.Evaluate(DropT), IceRainDrop.End);
 
 		// 착지 시점 1회 호출
-		if (!bIceRainImpactFired && DropAlpha >= 1.f - KINDA_SMALL_NUMBER)
+		if (!bIceRainImpactFired && IceRainDrop.IsFinished(DropT))
 		{
 			bIceRainImpactFired = true;
 			if (Boss.IsValid())
@@ -596,29 +608,9 @@ void AAttrenashinFist::TickIceRainSlam(float Dt)
 
 bool AAttrenashinFist::IsOnIceTileAt(const FVector& WorldXY) const
 {
-	if (!GetWorld()) return false;
-
-	TArray<FOverlapResult> Hits;
-
-	FCollisionObjectQueryParams Obj;
-	Obj.AddObjectTypesToQuery(ECC_WorldStatic);
-	Obj.AddObjectTypesToQuery(ECC_WorldDynamic);
-
-	FCollisionShape Shape = FCollisionShape::MakeSphere(120.f);
-	FCollisionQueryParams Params(SCENE_QUERY_STAT(AttrenashinIceCheck), false, this);
-
-	const bool bAny = GetWorld()->OverlapMultiByObjectType(Hits, WorldXY, FQuat::Identity, Obj, Shape, Params);
-	if (!bAny) return false;
-
-	for (const FOverlapResult& R : Hits)
-	{
-		AActor* A = R.GetActor();
-		if (!A) continue;
-
-		if (A->IsA(AIceTileActor::StaticClass())) return true;
-		if (A->ActorHasTag(TEXT("IceTile"))) return true;
-	}
-	return false;
+	// 타일 스폰/회수 시 갱신되는 점유 격자 조회(기존 120 반경 오버랩과 같은 범위)
+	const UIceTileGridSubsystem* Grid = UIceTileGridSubsystem::Get(this);
+	return Grid && Grid->IsIceAt(WorldXY, 120.f);
 }
 
 void AAttrenashinFist::StartReturnToAnchor(float DurationSeconds)
@@ -634,6 +626,8 @@ void AAttrenashinFist::StartReturnToAnchor(float DurationSeconds)
 
 	ReturnDuration = FMath::Max(0.01f, DurationSeconds);
 	ReturnT = 0.f;
+	ReturnStartRot = GetActorRotation();
+	Motion = FAttrenashinTrajectory::Make(GetActorLocation(), Anchor->GetComponentLocation(), ReturnDuration);
 
 	EnterState(EFistState::ReturnToAnchor);
 }
@@ -649,7 +643,6 @@ void AAttrenashinFist::TickReturnToAnchor(float Dt)
 
 	ReturnT += Dt;
 
-	const float Remain = FMath::Max(0.f, ReturnDuration - ReturnT);
 	const FVector Home = Anchor->GetComponentLocation();
 	const FRotator HomeRot = Anchor->GetComponentRotation();
 
@@ -667,7 +660,8 @@ void AAttrenashinFist::TickReturnToAnchor(float Dt)
 			ReturnDuration);
 	}
 
-	MoveTowardAdaptive(Home, Dt, Remain, ReturnMaxSpeed, true);
+	// 앵커는 보스와 함께 움직이므로 시작 오프셋을 줄여가며 추적
+	MoveAlongMotion(Motion.EvaluateTracking(ReturnT, Home), Dt, ReturnMaxSpeed);
 
 	if (AttrBossDbgEnabled_Fist() && bBossClap)
 	{
@@ -676,8 +670,7 @@ void AAttrenashinFist::TickReturnToAnchor(float Dt)
 	}
 
 	// 복귀 중 축(회전)도 원복
-	const float Alpha = FMath::Clamp(ReturnDuration > 0.f ? (ReturnT / ReturnDuration) : 1.f, 0.f, 1.f);
-	const FRotator NewRot = FMath::Lerp(GetActorRotation(), HomeRot, Alpha);
+	const FRotator NewRot = FMath::Lerp(ReturnStartRot, HomeRot, Motion.GetAlpha(ReturnT));
 	SetActorRotation(NewRot, ETeleportType::None);
 
 	if (ReturnT >= ReturnDuration)
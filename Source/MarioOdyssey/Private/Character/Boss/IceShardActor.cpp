@@ -3,13 +3,47 @@
 #include "Character/Boss/AttrenashinBoss.h"
 #include "Character/Boss/AttrenashinFist.h"
 #include "Character/Boss/IceTileActor.h"
+#include "Character/Boss/IceShardPoolSubsystem.h"
+#include "World/ActorRegistrySubsystem.h"
+#include "World/IceTileBatchComponent.h"
+#include "World/IceTileGridSubsystem.h"
 #include "MarioOdyssey/MarioCharacter.h"
+#include "MarioOdyssey/MarioOdysseyStats.h"
+#include "MarioTimers.h"
+#include "CollisionResponseSnapshot.h"
 
 #include "Components/SphereComponent.h"
 #include "Components/StaticMeshComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "GameFramework/ProjectileMovementComponent.h"
 #include "Kismet/GameplayStatics.h"
+#include "TimerManager.h"
+
+namespace
+{
+	// 일반 얼음비: 월드 충돌 Block, Mario만 Overlap 데미지
+	const FCollisionResponseSnapshot& GetRainShardCollision()
+	{
+		static const FCollisionResponseSnapshot Snapshot = FCollisionResponseSnapshot::FromProfile(TEXT("Boss_IceShard_Rain"))
+			.SetEnabled(ECollisionEnabled::QueryAndPhysics)
+			.SetAllResponses(ECR_Ignore)
+			.SetResponse(ECC_WorldStatic, ECR_Block)
+			.SetResponse(ECC_Pawn, ECR_Overlap);
+		return Snapshot;
+	}
+
+	// 캡쳐 카운터 샤드: 월드 충돌 Block, Mario/주먹에는 Overlap(피격 이벤트용)
+	const FCollisionResponseSnapshot& GetCounterShardCollision()
+	{
+		static const FCollisionResponseSnapshot Snapshot = FCollisionResponseSnapshot::FromProfile(TEXT("Boss_IceShard_Counter"))
+			.SetEnabled(ECollisionEnabled::QueryAndPhysics)
+			.SetAllResponses(ECR_Ignore)
+			.SetResponse(ECC_WorldStatic, ECR_Block)
+			.SetResponse(ECC_Pawn, ECR_Overlap)
+			.SetResponse(ECC_GameTraceChannel1, ECR_Overlap); // Monster(주먹)
+		return Snapshot;
+	}
+}
 
 AIceShardActor::AIceShardActor()
 {
@@ -48,6 +82,20 @@ AIceShardActor::AIceShardActor()
 	InitialLifeSpan = LifeSeconds;
 }
 
+void AIceShardActor::BeginPlay()
+{
+	Super::BeginPlay();
+
+	UActorRegistrySubsystem::AutoRegister(this);
+}
+
+void AIceShardActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UActorRegistrySubsystem::AutoUnregister(this);
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void AIceShardActor::InitShard(AActor* InOwnerBoss, float InDamage, TSubclassOf<AIceTileActor> InIceTileClass, float InIceTileZOffset)
 {
 	OwnerBoss = InOwnerBoss;
@@ -60,16 +108,8 @@ void AIceShardActor::InitShard(AActor* InOwnerBoss, float InDamage, TSubclassOf<
 	bSpawnTileOnStop = true;
 	BarrageCapturedFist.Reset();
 
-	// 일반 얼음비: 월드 충돌 Block, Mario만 Overlap 데미지
-	if (Sphere)
-	{
-		Sphere->SetCollisionProfileName(TEXT("Boss_IceShard_Rain"));
-		Sphere->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
-		Sphere->SetCollisionResponseToAllChannels(ECR_Ignore);
-		Sphere->SetCollisionResponseToChannel(ECC_WorldStatic, ECR_Block);
-		Sphere->SetCollisionResponseToChannel(ECC_WorldDynamic, ECR_Ignore);
-		Sphere->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
-	}
+	// 풀에서 재사용되는 샤드는 대부분 이미 같은 설정이라 바뀐 게 없으면 물리 필터 갱신 없음
+	GetRainShardCollision().ApplyTo(Sphere);
 
 	if (ProjectileMove)
 	{
@@ -90,25 +130,13 @@ void AIceShardActor::InitBarrageShard(AActor* InOwnerBoss, AAttrenashinFist* InC
 	bSpawnTileOnStop = false;
 	BarrageCapturedFist = InCapturedFist;
 
-	// 캡쳐 카운터 샤드:
-	// - 월드 충돌 Block
-	// - Mario/주먹에는 Overlap(피격 이벤트용)
-	if (Sphere)
+	// 캡쳐 카운터 샤드(주먹 캡슐 오브젝트 타입에도 Overlap), 스택 복사본이라 할당 없음
+	FCollisionResponseSnapshot Collision = GetCounterShardCollision();
+	if (InCapturedFist && InCapturedFist->GetCapsuleComponent())
 	{
-		Sphere->SetCollisionProfileName(TEXT("Boss_IceShard_Counter"));
-		Sphere->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
-		Sphere->SetCollisionResponseToAllChannels(ECR_Ignore);
-		Sphere->SetCollisionResponseToChannel(ECC_WorldStatic, ECR_Block);
-		Sphere->SetCollisionResponseToChannel(ECC_WorldDynamic, ECR_Ignore);
-		Sphere->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
-		Sphere->SetCollisionResponseToChannel(ECC_GameTraceChannel1, ECR_Overlap); // Monster(주먹)
-
-		if (InCapturedFist && InCapturedFist->GetCapsuleComponent())
-		{
-			const ECollisionChannel FistObjType = InCapturedFist->GetCapsuleComponent()->GetCollisionObjectType();
-			Sphere->SetCollisionResponseToChannel(FistObjType, ECR_Overlap);
-		}
+		Collision.SetResponse(InCapturedFist->GetCapsuleComponent()->GetCollisionObjectType(), ECR_Overlap);
 	}
+	Collision.ApplyTo(Sphere);
 
 	if (ProjectileMove)
 	{
@@ -121,6 +149,7 @@ void AIceShardActor::OnBeginOverlap(UPrimitiveComponent* OverlappedComp, AActor*
                                     UPrimitiveComponent* OtherComp, int32 OtherBodyIndex,
                                     bool bFromSweep, const FHitResult& SweepResult)
 {
+	MARIO_SCOPE_CYCLE(STAT_MarioOdyssey_IceShardOverlap);
 	if (!OtherActor || OtherActor == this) return;
 
 	// 캡쳐 카운터 샤드: 캡쳐된 주먹 적중 체크 우선
@@ -135,7 +164,7 @@ void AIceShardActor::OnBeginOverlap(UPrimitiveComponent* OverlappedComp, AActor*
 					const FVector V = ProjectileMove ? ProjectileMove->Velocity : GetVelocity();
 					Boss->NotifyBarrageShardHitCapturedFist(HitFist, V);
 				}
-				Destroy();
+				RetireShard();
 				return;
 			}
 			// 던지는 손(반대손) 등 다른 주먹은 무시
@@ -145,7 +174,7 @@ void AIceShardActor::OnBeginOverlap(UPrimitiveComponent* OverlappedComp, AActor*
 		// 플레이어는 맞아도 데미지 없음
 		if (Cast<AMarioCharacter>(OtherActor))
 		{
-			Destroy();
+			RetireShard();
 			return;
 		}
 
@@ -189,7 +218,7 @@ void AIceShardActor::OnProjectileStop(const FHitResult& ImpactResult)
 			}
 		}
 
-		Destroy();
+		RetireShard();
 		return;
 	}
 
@@ -202,10 +231,103 @@ void AIceShardActor::OnProjectileStop(const FHitResult& ImpactResult)
 				FVector SpawnLoc = ImpactResult.ImpactPoint;
 				SpawnLoc.Z += IceTileZOffset;
 
-				FActorSpawnParameters SP;
-				SP.Owner = OwnerBoss.Get();
+				// 아레나 인스턴스 묶음이 있으면 액터 없이 인스턴스로 추가
+				const UIceTileGridSubsystem* Grid = UIceTileGridSubsystem::Get(this);
+				if (UIceTileBatchComponent* Batch = Grid ? Grid->GetTileBatch() : nullptr)
+				{
+					Batch->AddTile(IceTileClass, SpawnLoc, FRotator::ZeroRotator);
+				}
+				else if (UIceShardPoolSubsystem* Pool = World->GetSubsystem<UIceShardPoolSubsystem>())
+				{
+					Pool->AcquireTile(IceTileClass, SpawnLoc, FRotator::ZeroRotator, OwnerBoss.Get());
+				}
+				else
+				{
+					FActorSpawnParameters SP;
+					SP.Owner = OwnerBoss.Get();
 
-				World->SpawnActor<AIceTileActor>(IceTileClass, SpawnLoc, FRotator::ZeroRotator, SP);
+					World->SpawnActor<AIceTileActor>(IceTileClass, SpawnLoc, FRotator::ZeroRotator, SP);
+				}
+			}
+		}
+	}
+
+	RetireShard();
+}
+
+void AIceShardActor::MarkPooled()
+{
+	bPooled = true;
+
+	// 풀 소속 샤드는 수명 만료 시 Destroy 대신 풀로 반환한다(ActivateFromPool에서 타이머로 처리).
+	SetLifeSpan(0.f);
+}
+
+void AIceShardActor::ActivateFromPool(const FVector& Location, const FRotator& Rotation, AActor* InOwner)
+{
+	SetOwner(InOwner);
+
+	bDamagedMario = false;
+	bStopped = false;
+
+	// ProjectileMove가 Sphere를 직접 이동시키므로 루트 기준 상대 트랜스폼도 원복
+	if (Sphere)
+	{
+		Sphere->SetRelativeLocationAndRotation(FVector::ZeroVector, FRotator::ZeroRotator, false, nullptr, ETeleportType::ResetPhysics);
+	}
+	SetActorLocationAndRotation(Location, Rotation, false, nullptr, ETeleportType::ResetPhysics);
+
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+
+	if (ProjectileMove)
+	{
+		// 정지(StopSimulating) 시 UpdatedComponent가 해제되므로 다시 연결
+		ProjectileMove->SetUpdatedComponent(Sphere);
+		ProjectileMove->ProjectileGravityScale = GravityScale;
+		ProjectileMove->Velocity = FVector(0.f, 0.f, -InitialDownSpeed);
+		ProjectileMove->Activate(true);
+	}
+
+	if (LifeSeconds > 0.f)
+	{
+		MarioTimers::Set(GetWorldTimerManager(), PooledLifeTimerHandle, this, &AIceShardActor::RetireShard, LifeSeconds, false);
+	}
+}
+
+void AIceShardActor::DeactivateToPool()
+{
+	GetWorldTimerManager().ClearTimer(PooledLifeTimerHandle);
+
+	if (ProjectileMove)
+	{
+		ProjectileMove->StopMovementImmediately();
+		ProjectileMove->Deactivate();
+	}
+
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+	SetOwner(nullptr);
+
+	OwnerBoss.Reset();
+	BarrageCapturedFist.Reset();
+	IceTileClass = nullptr;
+
+	// 비활성 중 늦게 도착한 오버랩/정지 콜백 무시
+	bDamagedMario = true;
+	bStopped = true;
+}
+
+void AIceShardActor::RetireShard()
+{
+	if (bPooled)
+	{
+		if (UWorld* World = GetWorld())
+		{
+			if (UIceShardPoolSubsystem* Pool = World->GetSubsystem<UIceShardPoolSubsystem>())
+			{
+				Pool->ReleaseShard(this);
+				return;
 			}
 		}
 	}
@@ -0,0 +1,259 @@
+#include "Character/Boss/IceShardPoolSubsystem.h"
+
+#include "Character/Boss/IceShardActor.h"
+#include "Character/Boss/IceTileActor.h"
+#include "MarioOdyssey/MarioOdysseyStats.h"
+
+#include "Engine/World.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogIceShardPool, Log, All);
+
+namespace
+{
+	// 풀 대기 액터는 숨김/충돌 off 상태라 위치는 의미 없지만, 아레나 밖으로 치워둔다.
+	const FVector PoolParkingLocation(0.f, 0.f, -100000.f);
+
+	template <typename T>
+	T* PopFreeOfClass(TArray<TObjectPtr<T>>& FreeList, UClass* WantedClass)
+	{
+		for (int32 i = FreeList.Num() - 1; i >= 0; --i)
+		{
+			T* Candidate = FreeList[i].Get();
+			if (!IsValid(Candidate))
+			{
+				// 외부에서 파괴된 액터는 풀에서 제거
+				FreeList.RemoveAtSwap(i, 1, EAllowShrinking::No);
+				continue;
+			}
+
+			if (Candidate->GetClass() == WantedClass)
+			{
+				FreeList.RemoveAtSwap(i, 1, EAllowShrinking::No);
+				return Candidate;
+			}
+		}
+		return nullptr;
+	}
+
+	template <typename T>
+	int32 CountOfClass(const TArray<TObjectPtr<T>>& List, UClass* WantedClass)
+	{
+		int32 Count = 0;
+		for (const TObjectPtr<T>& It : List)
+		{
+			if (IsValid(It.Get()) && It->GetClass() == WantedClass)
+			{
+				++Count;
+			}
+		}
+		return Count;
+	}
+}
+
+void UIceShardPoolSubsystem::Deinitialize()
+{
+	UE_LOG(LogIceShardPool, Log, TEXT("[IceShardPool] Shard hit=%d miss=%d peak=%d | Tile hit=%d miss=%d peak=%d"),
+		Stats.ShardHits, Stats.ShardMisses, Stats.ShardPeakActive,
+		Stats.TileHits, Stats.TileMisses, Stats.TilePeakActive);
+
+	FreeShards.Reset();
+	ActiveShards.Reset();
+	FreeTiles.Reset();
+	ActiveTiles.Reset();
+
+	Super::Deinitialize();
+}
+
+int32 UIceShardPoolSubsystem::Prewarm(TSubclassOf<AIceShardActor> ShardClass, int32 ShardCount, TSubclassOf<AIceTileActor> TileClass, int32 TileCount, int32 MaxSpawns)
+{
+	int32 Spawned = 0;
+
+	if (ShardClass)
+	{
+		const int32 Have = CountOfClass(FreeShards, ShardClass) + CountOfClass(ActiveShards, ShardClass);
+		for (int32 i = Have; i < ShardCount && Spawned < MaxSpawns; ++i)
+		{
+			if (AIceShardActor* Shard = SpawnPooledShard(ShardClass, PoolParkingLocation, FRotator::ZeroRotator))
+			{
+				Shard->DeactivateToPool();
+				FreeShards.Add(Shard);
+				++Spawned;
+			}
+		}
+	}
+
+	if (TileClass)
+	{
+		const int32 Have = CountOfClass(FreeTiles, TileClass) + CountOfClass(ActiveTiles, TileClass);
+		for (int32 i = Have; i < TileCount && Spawned < MaxSpawns; ++i)
+		{
+			if (AIceTileActor* Tile = SpawnPooledTile(TileClass, PoolParkingLocation, FRotator::ZeroRotator))
+			{
+				Tile->DeactivateToPool();
+				FreeTiles.Add(Tile);
+				++Spawned;
+			}
+		}
+	}
+
+	return Spawned;
+}
+
+AIceShardActor* UIceShardPoolSubsystem::AcquireShard(TSubclassOf<AIceShardActor> ShardClass, const FVector& Location, const FRotator& Rotation, AActor* InOwner)
+{
+	if (!ShardClass)
+	{
+		return nullptr;
+	}
+
+	AIceShardActor* Shard = PopFreeOfClass(FreeShards, ShardClass.Get());
+	if (Shard)
+	{
+		++Stats.ShardHits;
+	}
+	else
+	{
+		++Stats.ShardMisses;
+		Shard = SpawnPooledShard(ShardClass, Location, Rotation);
+		if (!Shard)
+		{
+			return nullptr;
+		}
+	}
+
+	Shard->ActivateFromPool(Location, Rotation, InOwner);
+	INC_DWORD_STAT(STAT_MarioOdyssey_PoolAcquires);
+	ActiveShards.Add(Shard);
+	Stats.ShardPeakActive = FMath::Max(Stats.ShardPeakActive, ActiveShards.Num());
+	return Shard;
+}
+
+void UIceShardPoolSubsystem::ReleaseShard(AIceShardActor* Shard)
+{
+	if (!IsValid(Shard))
+	{
+		return;
+	}
+
+	if (ActiveShards.RemoveSwap(Shard, EAllowShrinking::No) == 0)
+	{
+		// 이미 회수된 샤드(중복 Release) 무시
+		return;
+	}
+
+	Shard->DeactivateToPool();
+	FreeShards.Add(Shard);
+}
+
+AIceTileActor* UIceShardPoolSubsystem::AcquireTile(TSubclassOf<AIceTileActor> TileClass, const FVector& Location, const FRotator& Rotation, AActor* InOwner)
+{
+	if (!TileClass)
+	{
+		return nullptr;
+	}
+
+	AIceTileActor* Tile = PopFreeOfClass(FreeTiles, TileClass.Get());
+	if (Tile)
+	{
+		++Stats.TileHits;
+	}
+	else
+	{
+		++Stats.TileMisses;
+		Tile = SpawnPooledTile(TileClass, Location, Rotation);
+		if (!Tile)
+		{
+			return nullptr;
+		}
+	}
+
+	Tile->ActivateFromPool(Location, Rotation, InOwner);
+	INC_DWORD_STAT(STAT_MarioOdyssey_PoolAcquires);
+	ActiveTiles.Add(Tile);
+	Stats.TilePeakActive = FMath::Max(Stats.TilePeakActive, ActiveTiles.Num());
+	return Tile;
+}
+
+void UIceShardPoolSubsystem::ReleaseTile(AIceTileActor* Tile)
+{
+	if (!IsValid(Tile))
+	{
+		return;
+	}
+
+	if (ActiveTiles.RemoveSwap(Tile, EAllowShrinking::No) == 0)
+	{
+		return;
+	}
+
+	Tile->DeactivateToPool();
+	FreeTiles.Add(Tile);
+}
+
+int32 UIceShardPoolSubsystem::RecycleActive(int32 MaxCount)
+{
+	int32 Recycled = 0;
+
+	// 뒤에서부터 꺼내 배열 이동 없이 회수
+	while (ActiveShards.Num() > 0 && Recycled < MaxCount)
+	{
+		AIceShardActor* Shard = ActiveShards.Pop(EAllowShrinking::No).Get();
+		if (IsValid(Shard))
+		{
+			Shard->DeactivateToPool();
+			FreeShards.Add(Shard);
+		}
+		++Recycled;
+	}
+
+	while (ActiveTiles.Num() > 0 && Recycled < MaxCount)
+	{
+		AIceTileActor* Tile = ActiveTiles.Pop(EAllowShrinking::No).Get();
+		if (IsValid(Tile))
+		{
+			Tile->DeactivateToPool();
+			FreeTiles.Add(Tile);
+		}
+		++Recycled;
+	}
+
+	return ActiveShards.Num() + ActiveTiles.Num();
+}
+
+AIceShardActor* UIceShardPoolSubsystem::SpawnPooledShard(TSubclassOf<AIceShardActor> ShardClass, const FVector& Location, const FRotator& Rotation)
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	FActorSpawnParameters SP;
+	SP.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	AIceShardActor* Shard = World->SpawnActor<AIceShardActor>(ShardClass, Location, Rotation, SP);
+	if (Shard)
+	{
+		Shard->MarkPooled();
+	}
+	return Shard;
+}
+
+AIceTileActor* UIceShardPoolSubsystem::SpawnPooledTile(TSubclassOf<AIceTileActor> TileClass, const FVector& Location, const FRotator& Rotation)
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	FActorSpawnParameters SP;
+	SP.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	AIceTileActor* Tile = World->SpawnActor<AIceTileActor>(TileClass, Location, Rotation, SP);
+	if (Tile)
+	{
+		Tile->MarkPooled();
+	}
+	return Tile;
+}
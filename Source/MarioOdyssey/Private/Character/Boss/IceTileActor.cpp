@@ -2,6 +2,7 @@
 
 #include "Components/BoxComponent.h"
 #include "Components/StaticMeshComponent.h"
+#include "World/ActorRegistrySubsystem.h"
 
 AIceTileActor::AIceTileActor()
 {
@@ -31,3 +32,54 @@ AIceTileActor::AIceTileActor()
 
 	Tags.Add(TEXT("IceTile"));
 }
+
+void AIceTileActor::BeginPlay()
+{
+	Super::BeginPlay();
+
+	UActorRegistrySubsystem::AutoRegister(this);
+
+	RegisterIceFootprint();
+}
+
+void AIceTileActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UnregisterIceFootprint();
+
+	UActorRegistrySubsystem::AutoUnregister(this);
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AIceTileActor::ActivateFromPool(const FVector& Location, const FRotator& Rotation, AActor* InOwner)
+{
+	SetOwner(InOwner);
+	SetActorLocationAndRotation(Location, Rotation, false, nullptr, ETeleportType::TeleportPhysics);
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+	RegisterIceFootprint();
+}
+
+void AIceTileActor::DeactivateToPool()
+{
+	UnregisterIceFootprint();
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+	SetOwner(nullptr);
+}
+
+void AIceTileActor::RegisterIceFootprint()
+{
+	if (UIceTileGridSubsystem* Grid = UIceTileGridSubsystem::Get(this))
+	{
+		Grid->AddFootprint(Box ? Box->Bounds.GetBox() : GetComponentsBoundingBox(), IceFootprint);
+	}
+}
+
+void AIceTileActor::UnregisterIceFootprint()
+{
+	if (UIceTileGridSubsystem* Grid = UIceTileGridSubsystem::Get(this))
+	{
+		Grid->RemoveFootprint(IceFootprint);
+	}
+}
@@ -6,11 +6,11 @@
 #include "Components/CapsuleComponent.h"
 #include "GameFramework/DamageType.h"
 #include "GameFramework/CharacterMovementComponent.h"
-#include "TimerManager.h"
 
 #include "MarioOdyssey/MarioCharacter.h"
 #include "Capture/CapturableInterface.h"
 #include "Capture/CaptureComponent.h"
+#include "Capture/PlayerTargetSubsystem.h"
 
 ABulletBillCharacter::ABulletBillCharacter()
 {
@@ -163,7 +163,7 @@ void ABulletBillCharacter::Input_LookCamera(const FInputActionValue& Value)
 	if (!bIsCaptured) return;
 
 	// ViewTarget이 마리오라서, Look 입력은 Mario(TargetControlRotation)에게 전달해야 한다.
-	// Controller Rotation을 직접 건드리면 CaptureTickCamera()가 다음 틱에 원래 값으로 되돌려 "휙 돌아옴/고정" 증상이 발생한다.
+	// Controller Rotation을 직접 건드리면 카메라 매니저가 다음 프레임에 마리오 목표 회전으로 되돌려 "휙 돌아옴/고정" 증상이 발생한다.
 	if (CapturingMario.IsValid())
 	{
 		CapturingMario->CaptureFeedLookInput(Value);
@@ -197,15 +197,16 @@ void ABulletBillCharacter::Input_JumpCompleted_Passthrough(const FInputActionVal
 
 AMarioCharacter* ABulletBillCharacter::GetMarioViewTarget() const
 {
-	if (UWorld* World = GetWorld())
+	const UPlayerTargetSubsystem* Targets = UPlayerTargetSubsystem::Get(this);
+	AMarioCharacter* Mario = Targets ? Targets->GetMario() : nullptr;
+	if (!Mario)
 	{
-		if (APlayerController* PC = UGameplayStatics::GetPlayerController(World, 0))
-		{
-			// 정책상 ViewTarget이 Mario라 이게 제일 안정적
-			return Cast<AMarioCharacter>(PC->GetViewTarget());
-		}
+		return nullptr;
 	}
-	return nullptr;
+
+	// 기존 의미 유지: 플레이어 카메라가 마리오를 보고 있을 때만 반환(컷신 카메라 등이면 nullptr)
+	const APlayerController* PC = UGameplayStatics::GetPlayerController(this, 0);
+	return (PC && PC->GetViewTarget() == Mario) ? Mario : nullptr;
 }
 
 void ABulletBillCharacter::MoveAndHandleHit(float Dt)
@@ -339,11 +340,6 @@ void ABulletBillCharacter::StartSpawnGrace(float GraceSeconds)
 		return;
 	}
 
-	if (UWorld* World = GetWorld())
-	{
-		World->GetTimerManager().ClearTimer(SpawnGraceTimer);
-	}
-
 	bSpawnGraceActive = true;
 
 	if (UCapsuleComponent* Cap = GetCapsuleComponent())
@@ -351,11 +347,8 @@ void ABulletBillCharacter::StartSpawnGrace(float GraceSeconds)
 		Cap->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 	}
 
-	// grace 종료 후 충돌 다시 켜기
-	if (UWorld* World = GetWorld())
-	{
-		World->GetTimerManager().SetTimer(SpawnGraceTimer, this, &ABulletBillCharacter::EndSpawnGrace, GraceSeconds, false);
-	}
+	// grace 종료 후 충돌 다시 켜기(같은 태그로 다시 걸면 덮어씀)
+	Timeline.Schedule(ETimelineTag::SpawnGrace, GraceSeconds, &ABulletBillCharacter::EndSpawnGrace);
 }
 
 void ABulletBillCharacter::EndSpawnGrace()
@@ -10,6 +10,11 @@
 #include "GameFramework/DamageType.h"
 #include "Components/SphereComponent.h"
 #include "Components/CapsuleComponent.h"
+#include "Capture/PlayerTargetSubsystem.h"
+#include "World/DeterministicSimSubsystem.h"
+#include "MarioOdyssey/MarioOdysseyStats.h"
+#include "MarioSceneQuery.h"
+#include "CollisionResponseSnapshot.h"
 
 // Enhanced Input
 #include "EnhancedInputComponent.h"
@@ -93,6 +98,7 @@ void AGoombaCharacter::BeginPlay()
 	Super::BeginPlay();
 
 	HomeLocation = GetActorLocation();
+	UDeterministicSimSubsystem::InitRandomStream(this, PatrolRandom);
 	SetState(EGoombaAIState::Patrol);
 
 	// 캡슐 높이에 맞춰 머리 스피어 위치 보정
@@ -111,7 +117,7 @@ void AGoombaCharacter::OnContactBeginOverlap_Goomba(UPrimitiveComponent* Overlap
 	// 본인이 캡쳐중이면(플레이어 조종) 컨택 공격을 막는 옵션(베이스 정책 유지)
 	if (bDisableContactDamageWhileCaptured && bIsCaptured) return;
 
-	APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
+	APawn* PlayerPawn = Cast<APawn>(GetPlayerTargetActor());
 	if (!PlayerPawn || OtherActor != PlayerPawn) return; // “플레이어가 조종 중인 Pawn”만 때림
 
 	// ===== 스택 내부 자기 넉백/데미지 방지 =====
@@ -316,8 +322,9 @@ void AGoombaCharacter::SetState(EGoombaAIState NewState)
 
 AActor* AGoombaCharacter::GetPlayerTargetActor() const
 {
-	if (!GetWorld()) return nullptr;
-	return UGameplayStatics::GetPlayerPawn(GetWorld(), 0); // 평상시=마리오, 캡쳐중=굼바
+	// 평상시=마리오, 캡쳐중=굼바
+	const UPlayerTargetSubsystem* Targets = UPlayerTargetSubsystem::Get(this);
+	return Targets ? Targets->GetControlledPawn() : nullptr;
 }
 
 bool AGoombaCharacter::CanDetectTarget(const AActor* Target) const
@@ -353,18 +360,15 @@ void AGoombaCharacter::UpdatePatrol(float Dt)
 	if (!bHasPatrolTarget)
 	{
 		// NavMesh에서 스폰 근처 랜덤 포인트
-		if (UNavigationSystemV1* NavSys = UNavigationSystemV1::GetCurrent(GetWorld()))
+		FVector NewTarget;
+		if (PickPatrolPoint(NewTarget))
 		{
-			FNavLocation Out;
-			if (NavSys->GetRandomReachablePointInRadius(HomeLocation, PatrolRadius, Out))
-			{
-				PatrolTarget = Out.Location;
-				bHasPatrolTarget = true;
+			PatrolTarget = NewTarget;
+			bHasPatrolTarget = true;
 
-				if (AAIController* AIC = GetAICon())
-				{
-					AIC->MoveToLocation(PatrolTarget, 25.f);
-				}
+			if (AAIController* AIC = GetAICon())
+			{
+				AIC->MoveToLocation(PatrolTarget, 25.f);
 			}
 		}
 	}
@@ -378,6 +382,39 @@ void AGoombaCharacter::UpdatePatrol(float Dt)
 	}
 }
 
+bool AGoombaCharacter::PickPatrolPoint(FVector& OutLocation)
+{
+	UNavigationSystemV1* NavSys = UNavigationSystemV1::GetCurrent(GetWorld());
+	if (!NavSys) return false;
+
+	FNavLocation Out;
+	if (!UDeterministicSimSubsystem::IsDeterministic(this))
+	{
+		if (!MarioSceneQuery::GetRandomReachablePointInRadius(NavSys, HomeLocation, PatrolRadius, Out))
+		{
+			return false;
+		}
+
+		OutLocation = Out.Location;
+		return true;
+	}
+
+	// 결정적 모드: GetRandomReachablePointInRadius는 내부에서 전역 FRand를 써서 재현이 안 되므로
+	// 원 안 균등 분포 점을 시드 스트림으로 뽑고 NavMesh에 투영
+	const float Angle = PatrolRandom.FRandRange(0.f, 2.f * PI);
+	const float Radius = FMath::Sqrt(PatrolRandom.FRand()) * PatrolRadius;
+	const FVector Candidate = HomeLocation + FVector(FMath::Cos(Angle) * Radius, FMath::Sin(Angle) * Radius, 0.f);
+
+	const FVector QueryExtent(PatrolRadius * 0.25f, PatrolRadius * 0.25f, 500.f);
+	if (!MarioSceneQuery::ProjectPointToNavigation(NavSys, Candidate, Out, QueryExtent))
+	{
+		return false;
+	}
+
+	OutLocation = Out.Location;
+	return true;
+}
+
 void AGoombaCharacter::UpdateChase(float Dt, AActor* Target)
 {
 	if (!CanDetectTarget(Target))
@@ -611,6 +648,7 @@ void AGoombaCharacter::OnHeadStackSphereBeginOverlap(UPrimitiveComponent* Overla
 
 void AGoombaCharacter::UpdateStackPresentation(float Dt)
 {
+	MARIO_SCOPE_CYCLE(STAT_MarioOdyssey_GoombaStackPresentation);
 	AGoombaCharacter* Root = this;
 	if (!Root || !Root->IsStackRoot()) return;
 
@@ -665,10 +703,13 @@ void AGoombaCharacter::UpdateStackPresentation(float Dt)
 		Below = Cur;
 
 		// Followers must NOT block movement. Keep only overlap (still capturable by queries).
+		// 매 프레임 호출되므로 이미 적용된 팔로워는 물리 필터 갱신 없이 통과
 		if (UCapsuleComponent* Cap = Cur->GetCapsuleComponent())
 		{
-			Cap->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
-			Cap->SetCollisionResponseToAllChannels(ECR_Overlap);
+			FCollisionResponseSnapshot::Capture(Cap)
+				.SetEnabled(ECollisionEnabled::QueryOnly)
+				.SetAllResponses(ECR_Overlap)
+				.ApplyTo(Cap);
 		}
 
 	}
@@ -817,12 +858,6 @@ void AGoombaCharacter::Input_ReleaseCapture_Passthrough(const FInputActionValue&
 	OnReleaseCapturePressed(Value);
 }
 
-void AGoombaCharacter::ClearCapturedHitStun_Proxy()
-{
-	// 베이스의 피격 스턴 해제 로직 호출
-	ClearCapturedHitStun();
-}
-
 // ======================================================
 // Damage forwarding
 // ======================================================
@@ -863,13 +898,7 @@ void AGoombaCharacter::OnCapturedPawnDamaged_Implementation(float Damage, AContr
 
 	// 입력 잠금
 	bInputLocked = true;
-	if (UWorld* World = GetWorld())
-	{
-		World->GetTimerManager().ClearTimer(CapturedHitStunTimer);
-		World->GetTimerManager().SetTimer(
-			CapturedHitStunTimer, this, &AGoombaCharacter::ClearCapturedHitStun_Proxy,
-			CapturedHitStunSeconds, false);
-	}
+	Timeline.Schedule(ETimelineTag::CapturedHitStun, CapturedHitStunSeconds, &AGoombaCharacter::ClearCapturedHitStun);
 
 	// 넉백은 스택 루트에 적용(전체 스택이 밀리게)
 	AGoombaCharacter* Root = GetStackRoot();
@@ -8,6 +8,8 @@
 
 #include "MarioOdyssey/MarioCharacter.h"
 #include "Capture/CaptureComponent.h"
+#include "Capture/PlayerTargetSubsystem.h"
+#include "World/DeterministicSimSubsystem.h"
 
 AMonsterCharacterBase::AMonsterCharacterBase()
 {
@@ -36,9 +38,17 @@ void AMonsterCharacterBase::BeginPlay()
 	{
 		DefaultMaxWalkSpeed = Move->MaxWalkSpeed;
 		DefaultJumpZVelocity = Move->JumpZVelocity;
+		UDeterministicSimSubsystem::ApplyToMovement(Move);
 	}
 }
 
+void AMonsterCharacterBase::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	Timeline.Tick(this, DeltaSeconds);
+}
+
 void AMonsterCharacterBase::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)
 {
 	Super::SetupPlayerInputComponent(PlayerInputComponent);
@@ -84,7 +94,8 @@ void AMonsterCharacterBase::OnContactBeginOverlap(UPrimitiveComponent* Overlappe
 	// 본인이 캡쳐중이면(플레이어 조종) 컨택 공격을 막는 옵션
 	if (bDisableContactDamageWhileCaptured && bIsCaptured) return;
 
-	APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
+	const UPlayerTargetSubsystem* Targets = UPlayerTargetSubsystem::Get(this);
+	APawn* PlayerPawn = Targets ? Targets->GetControlledPawn() : nullptr;
 	if (!PlayerPawn || OtherActor != PlayerPawn) return;
 
 	// Mario는 자신의 캡슐 Hit로 컨택 데미지를 처리하므로, 기본값은 중복을 막는다.
@@ -216,10 +227,7 @@ void AMonsterCharacterBase::OnCaptured_Implementation(AController* Capturer, con
 
 	StopAIMove();
 
-	if (UWorld* World = GetWorld())
-	{
-		World->GetTimerManager().ClearTimer(CapturedHitStunTimer);
-	}
+	Timeline.Cancel(ETimelineTag::CapturedHitStun);
 
 	// 캡쳐 시작 순간엔 Capturer의 Pawn이 마리오인 상태라 캐싱 가능
 	CapturingMario = Capturer ? Cast<AMarioCharacter>(Capturer->GetPawn()) : nullptr;
@@ -234,10 +242,7 @@ void AMonsterCharacterBase::OnReleased_Implementation(const FCaptureReleaseConte
 	bRunHeld = false;
 	bInputLocked = false;
 
-	if (UWorld* World = GetWorld())
-	{
-		World->GetTimerManager().ClearTimer(CapturedHitStunTimer);
-	}
+	Timeline.Cancel(ETimelineTag::CapturedHitStun);
 
 	// 이동 파라미터 원복
 	if (UCharacterMovementComponent* Move = GetCharacterMovement())
@@ -273,11 +278,7 @@ void AMonsterCharacterBase::OnCapturedPawnDamaged_Implementation(float Damage, A
 
 	// 잠시 입력 잠금
 	bInputLocked = true;
-	if (UWorld* World = GetWorld())
-	{
-		World->GetTimerManager().ClearTimer(CapturedHitStunTimer);
-		World->GetTimerManager().SetTimer(CapturedHitStunTimer, this, &AMonsterCharacterBase::ClearCapturedHitStun, CapturedHitStunSeconds, false);
-	}
+	Timeline.Schedule(ETimelineTag::CapturedHitStun, CapturedHitStunSeconds, &AMonsterCharacterBase::ClearCapturedHitStun);
 
 	OnCapturedPawnDamagedExtra(Damage, InstigatorController, DamageCauser);
 }
@@ -286,3 +287,61 @@ void AMonsterCharacterBase::ClearCapturedHitStun()
 {
 	bInputLocked = false;
 }
+
+#if !UE_BUILD_SHIPPING
+#include "Character/Monster/GoombaCharacter.h"
+#include "Engine/World.h"
+#include "Dev/MarioBenchCommand.h"
+
+namespace MonsterBench
+{
+	// 임의 맵을 몬스터 N마리 스트레스 맵으로(타이머/틱 부하 측정용)
+	static FMarioBenchCommand MarioSpawnStressCommand(
+		TEXT("mario.SpawnStress"),
+		TEXT("마리오 주변 링에 몬스터 스폰. 인자: [수=50] [클래스 경로=Goomba] [반경=1500]"),
+		[](const TArray<FString>& Args, UWorld* World)
+		{
+			AMarioCharacter* M = MarioBench::FindMario(World);
+			if (!M) return;
+
+			const int32 Count = MarioBench::IntArg(Args, 0, 50);
+
+			UClass* MonsterClass = AGoombaCharacter::StaticClass();
+			if (Args.Num() > 1)
+			{
+				UClass* Loaded = LoadClass<AMonsterCharacterBase>(nullptr, *Args[1]);
+				if (!Loaded)
+				{
+					UE_LOG(LogMarioBench, Warning, TEXT("[MarioBench] SpawnStress: class not found: %s"), *Args[1]);
+					return;
+				}
+				MonsterClass = Loaded;
+			}
+
+			const float Radius = MarioBench::FloatArg(Args, 2, 1500.f);
+			const FVector Center = M->GetActorLocation();
+
+			FActorSpawnParameters Params;
+			Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+			int32 Spawned = 0;
+			for (int32 i = 0; i < Count; ++i)
+			{
+				const float Angle = (2.f * PI * i) / Count;
+				const FVector Loc = Center + FVector(FMath::Cos(Angle), FMath::Sin(Angle), 0.f) * Radius;
+				const FRotator Rot = (Center - Loc).Rotation();
+
+				APawn* Monster = World->SpawnActor<APawn>(MonsterClass, Loc, FRotator(0.f, Rot.Yaw, 0.f), Params);
+				if (!Monster) continue;
+
+				if (!Monster->GetController())
+				{
+					Monster->SpawnDefaultController();
+				}
+				++Spawned;
+			}
+
+			UE_LOG(LogMarioBench, Display, TEXT("[MarioBench] SpawnStress: %d x %s"), Spawned, *MonsterClass->GetName());
+		});
+}
+#endif
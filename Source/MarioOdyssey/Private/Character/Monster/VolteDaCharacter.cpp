@@ -2,9 +2,10 @@
 
 #include "EnhancedInputComponent.h"
 #include "InputActionValue.h"
-#include "EngineUtils.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Kismet/GameplayStatics.h"
+#include "Capture/PlayerTargetSubsystem.h"
+#include "World/ActorRegistrySubsystem.h"
 
 AVolteDaCharacter::AVolteDaCharacter()
 {
@@ -107,18 +108,16 @@ void AVolteDaCharacter::CacheRevealActors()
 	RevealActors.Reset();
 
 	bRevealVisibleApplied = false;
-	UWorld* World = GetWorld();
-	if (!World) return;
+	const UActorRegistrySubsystem* Registry = UActorRegistrySubsystem::Get(this);
+	if (!Registry) return;
 
-	for (TActorIterator<AActor> It(World); It; ++It)
-	{
-		AActor* A = *It;
-		if (!A) continue;
+	TArray<AActor*> Tagged;
+	Registry->GetActorsWithTag(RevealActorTag, Tagged);
 
-		if (A->ActorHasTag(RevealActorTag))
-		{
-			RevealActors.Add(A);
-		}
+	RevealActors.Reserve(Tagged.Num());
+	for (AActor* A : Tagged)
+	{
+		RevealActors.Add(A);
 	}
 }
 
@@ -180,7 +179,8 @@ void AVolteDaCharacter::Tick(float DeltaSeconds)
     // ===== Simple flee AI (when NOT captured) =====
     if (!bIsCaptured && bEnableFleeAI)
     {
-        AActor* Player = UGameplayStatics::GetPlayerPawn(this, 0);
+        const UPlayerTargetSubsystem* Targets = UPlayerTargetSubsystem::Get(this);
+        AActor* Player = Targets ? Targets->GetControlledPawn() : nullptr;
         if (!Player) return;
 
         const FVector SelfLoc = GetActorLocation();
@@ -0,0 +1,58 @@
+#include "CollisionResponseSnapshot.h"
+
+#include "Components/PrimitiveComponent.h"
+#include "Engine/CollisionProfile.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogCollisionSnapshot, Log, All);
+
+FCollisionResponseSnapshot FCollisionResponseSnapshot::Capture(const UPrimitiveComponent* Component)
+{
+	FCollisionResponseSnapshot Out;
+	if (!Component) return Out;
+
+	Out.Responses = Component->GetCollisionResponseToChannels();
+	Out.Enabled = Component->BodyInstance.GetCollisionEnabled(false);
+	Out.ObjectType = Component->GetCollisionObjectType();
+	return Out;
+}
+
+FCollisionResponseSnapshot FCollisionResponseSnapshot::FromProfile(FName ProfileName)
+{
+	FCollisionResponseSnapshot Out;
+
+	FCollisionResponseTemplate Template;
+	if (UCollisionProfile::Get()->GetProfileTemplate(ProfileName, Template))
+	{
+		Out.Responses = Template.ResponseToChannels;
+		Out.Enabled = Template.CollisionEnabled;
+		Out.ObjectType = Template.ObjectType;
+	}
+	else
+	{
+		UE_LOG(LogCollisionSnapshot, Warning, TEXT("Collision profile not found: %s"), *ProfileName.ToString());
+	}
+	return Out;
+}
+
+bool FCollisionResponseSnapshot::ApplyTo(UPrimitiveComponent* Component) const
+{
+	if (!Component) return false;
+
+	bool bChanged = false;
+	if (Component->GetCollisionObjectType() != ObjectType)
+	{
+		Component->SetCollisionObjectType(ObjectType);
+		bChanged = true;
+	}
+	if (Component->GetCollisionResponseToChannels() != Responses)
+	{
+		Component->SetCollisionResponseToChannels(Responses);
+		bChanged = true;
+	}
+	if (Component->BodyInstance.GetCollisionEnabled(false) != Enabled)
+	{
+		Component->SetCollisionEnabled(Enabled);
+		bChanged = true;
+	}
+	return bChanged;
+}
@@ -0,0 +1,489 @@
+#include "Dev/InputReplaySubsystem.h"
+
+#include "MarioOdyssey/MarioCharacter.h"
+#include "Capture/PlayerTargetSubsystem.h"
+#include "World/DeterministicSimSubsystem.h"
+
+#include "Engine/World.h"
+#include "Engine/LocalPlayer.h"
+#include "GameFramework/PlayerController.h"
+#include "EnhancedInputSubsystems.h"
+#include "EnhancedPlayerInput.h"
+#include "InputAction.h"
+#include "InputMappingContext.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogInputReplay, Log, All);
+
+namespace
+{
+	constexpr uint32 ReplayMagic = 0x3152494D; // "MIR1"
+	constexpr int32 ReplayVersion = 1;
+
+	int32 NumComponents(EInputActionValueType Type)
+	{
+		switch (Type)
+		{
+		case EInputActionValueType::Axis2D: return 2;
+		case EInputActionValueType::Axis3D: return 3;
+		default: return 1;
+		}
+	}
+
+#if !UE_BUILD_SHIPPING
+	FAutoConsoleCommandWithWorldAndArgs RecordCommand(
+		TEXT("input.Record"),
+		TEXT("플레이어 입력 기록 시작. 인자: <파일 경로>. 재현하려면 -DeterministicSim으로 실행한 상태에서 기록"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (UInputReplaySubsystem* Replay = UInputReplaySubsystem::Get(World))
+			{
+				Replay->StartRecording(Args.Num() > 0 ? Args[0] : FString());
+			}
+		}));
+
+	FAutoConsoleCommandWithWorldAndArgs ReplayCommand(
+		TEXT("input.Replay"),
+		TEXT("기록한 입력 재생. 인자: <파일 경로>. 같은 맵을 새로 연 직후에 실행"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (UInputReplaySubsystem* Replay = UInputReplaySubsystem::Get(World))
+			{
+				Replay->StartReplay(Args.Num() > 0 ? Args[0] : FString());
+			}
+		}));
+
+	FAutoConsoleCommandWithWorld StopCommand(
+		TEXT("input.Stop"),
+		TEXT("입력 기록/재생 중지(기록 중이면 파일 저장)"),
+		FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+		{
+			if (UInputReplaySubsystem* Replay = UInputReplaySubsystem::Get(World))
+			{
+				Replay->Stop();
+			}
+		}));
+#endif
+}
+
+UInputReplaySubsystem* UInputReplaySubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UInputReplaySubsystem>() : nullptr;
+}
+
+bool UInputReplaySubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+#if UE_BUILD_SHIPPING
+	return false;
+#else
+	return Super::ShouldCreateSubsystem(Outer);
+#endif
+}
+
+void UInputReplaySubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (!InWorld.IsGameWorld()) return;
+
+	FString Path;
+	if (FParse::Value(FCommandLine::Get(), TEXT("InputReplay="), Path))
+	{
+		// 여기서 한 번만 읽어 두고 마리오가 준비되면 읽은 이벤트로 바로 시작
+		int32 Seed = 0;
+		float StepHz = 0.f;
+		int32 Substeps = 1;
+		if (!LoadRecording(Path, Seed, StepHz, Substeps)) return;
+
+		PendingMode = EMode::Replaying;
+		PendingPath = Path;
+		bQuitWhenDone = FParse::Param(FCommandLine::Get(), TEXT("InputReplayQuit"));
+
+		// 액터 BeginPlay(랜덤 스트림 시드) 전에 기록 당시 결정적 설정을 먼저 적용
+		UDeterministicSimSubsystem* Sim = UDeterministicSimSubsystem::Get(this);
+		if (Sim && StepHz > 0.f)
+		{
+			Sim->SetDeterministic(true, Seed, StepHz, Substeps);
+		}
+	}
+	else if (FParse::Value(FCommandLine::Get(), TEXT("InputRecord="), Path))
+	{
+		PendingMode = EMode::Recording;
+		PendingPath = Path;
+	}
+}
+
+void UInputReplaySubsystem::Deinitialize()
+{
+	Stop();
+	Super::Deinitialize();
+}
+
+TStatId UInputReplaySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UInputReplaySubsystem, STATGROUP_Tickables);
+}
+
+UEnhancedInputLocalPlayerSubsystem* UInputReplaySubsystem::GetInputSubsystem() const
+{
+	const UPlayerTargetSubsystem* Targets = UPlayerTargetSubsystem::Get(this);
+	const AMarioCharacter* Mario = Targets ? Targets->GetMario() : nullptr;
+
+	// 캡쳐 중에는 컨트롤러가 캡쳐 Pawn으로 옮겨가므로 첫 로컬 플레이어 기준
+	const APlayerController* PC = GetWorld() ? GetWorld()->GetFirstPlayerController() : nullptr;
+	if (!PC && Mario)
+	{
+		PC = Cast<APlayerController>(Mario->GetController());
+	}
+	return PC ? ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(PC->GetLocalPlayer()) : nullptr;
+}
+
+bool UInputReplaySubsystem::GatherActions()
+{
+	Actions.Reset();
+
+	const UPlayerTargetSubsystem* Targets = UPlayerTargetSubsystem::Get(this);
+	const AMarioCharacter* Mario = Targets ? Targets->GetMario() : nullptr;
+	const UInputMappingContext* IMC = Mario ? Mario->GetPlayerMappingContext() : nullptr;
+	if (!IMC) return false;
+
+	for (const FEnhancedActionKeyMapping& Mapping : IMC->GetMappings())
+	{
+		if (Mapping.Action && !Actions.Contains(Mapping.Action))
+		{
+			Actions.Add(Mapping.Action);
+		}
+	}
+
+	// 파일 포맷상 액션 인덱스는 uint8
+	if (Actions.Num() > MAX_uint8)
+	{
+		Actions.SetNum(MAX_uint8);
+	}
+	return Actions.Num() > 0;
+}
+
+bool UInputReplaySubsystem::StartRecording(const FString& Path)
+{
+	if (Mode != EMode::Idle || Path.IsEmpty()) return false;
+
+	if (!GatherActions() || !GetInputSubsystem())
+	{
+		UE_LOG(LogInputReplay, Warning, TEXT("[InputReplay] Mario input mapping not ready; recording not started"));
+		return false;
+	}
+
+	if (!UDeterministicSimSubsystem::IsDeterministic(this))
+	{
+		UE_LOG(LogInputReplay, Warning, TEXT("[InputReplay] Recording without -DeterministicSim: replay will not reproduce frame timing exactly"));
+	}
+
+	FilePath = Path;
+	Frame = 0;
+	Events.Reset();
+	LastValues.Init(FVector::ZeroVector, Actions.Num());
+	StartWallSeconds = FPlatformTime::Seconds();
+	Mode = EMode::Recording;
+
+	UE_LOG(LogInputReplay, Display, TEXT("[InputReplay] Recording %d actions -> %s"), Actions.Num(), *FilePath);
+	return true;
+}
+
+bool UInputReplaySubsystem::StartReplay(const FString& Path)
+{
+	if (Mode != EMode::Idle || Path.IsEmpty()) return false;
+
+	int32 Seed = 0;
+	float StepHz = 0.f;
+	int32 Substeps = 1;
+	if (!LoadRecording(Path, Seed, StepHz, Substeps))
+	{
+		return false;
+	}
+
+	// 기록 당시 결정적 설정으로 전환(랜덤 스트림은 액터 BeginPlay 시점 설정을 쓰므로
+	// 콘솔 재생이면 -DeterministicSim -SimSeed=<같은 시드>로 맵을 연 상태여야 정확히 일치)
+	UDeterministicSimSubsystem* Sim = UDeterministicSimSubsystem::Get(this);
+	if (Sim && StepHz > 0.f)
+	{
+		Sim->SetDeterministic(true, Seed, StepHz, Substeps);
+	}
+
+	BeginReplay(Path);
+	return true;
+}
+
+void UInputReplaySubsystem::BeginReplay(const FString& Path)
+{
+	FilePath = Path;
+	Frame = 0;
+	NextEvent = 0;
+	LastValues.Init(FVector::ZeroVector, Actions.Num());
+	StartWallSeconds = FPlatformTime::Seconds();
+	Mode = EMode::Replaying;
+
+	UE_LOG(LogInputReplay, Display, TEXT("[InputReplay] Replaying %d events from %s"), Events.Num(), *FilePath);
+}
+
+void UInputReplaySubsystem::Stop()
+{
+	if (Mode == EMode::Idle) return;
+
+	const double WallSeconds = FPlatformTime::Seconds() - StartWallSeconds;
+	const UDeterministicSimSubsystem* Sim = UDeterministicSimSubsystem::Get(this);
+	const double SimSeconds = Frame * ((Sim && Sim->IsEnabled()) ? Sim->GetFixedStep() : 0.f);
+
+	if (Mode == EMode::Recording)
+	{
+		// 누른 채 멈춘 입력은 해제 이벤트를 남겨야 재생이 끝에서 그 입력을 계속 주입하지 않는다
+		for (int32 i = 0; i < LastValues.Num(); ++i)
+		{
+			if (!LastValues[i].IsZero())
+			{
+				FInputEvent& E = Events.AddDefaulted_GetRef();
+				E.Frame = Frame;
+				E.ActionIndex = static_cast<uint8>(i);
+				E.Value = FVector::ZeroVector;
+				LastValues[i] = FVector::ZeroVector;
+			}
+		}
+		SaveRecording();
+	}
+
+	UE_LOG(LogInputReplay, Display, TEXT("[InputReplay] %s stopped: %u frames, wall %.2fs, sim %.2fs"),
+		Mode == EMode::Recording ? TEXT("Recording") : TEXT("Replay"), Frame, WallSeconds, SimSeconds);
+
+	Mode = EMode::Idle;
+	Events.Reset();
+
+	if (bQuitWhenDone)
+	{
+		FPlatformMisc::RequestExit(false);
+	}
+}
+
+void UInputReplaySubsystem::Tick(float DeltaTime)
+{
+	if (Mode == EMode::Idle)
+	{
+		if (PendingMode == EMode::Idle) return;
+
+		const UPlayerTargetSubsystem* Targets = UPlayerTargetSubsystem::Get(this);
+		if (!Targets || !Targets->GetMario()) return;
+
+		const EMode StartMode = PendingMode;
+		const FString Path = PendingPath;
+		PendingMode = EMode::Idle;
+		PendingPath.Reset();
+
+		if (StartMode == EMode::Recording) StartRecording(Path);
+		else BeginReplay(Path); // 커맨드라인 재생은 OnWorldBeginPlay에서 이미 읽었다
+		return;
+	}
+
+	if (Mode == EMode::Recording)
+	{
+		TickRecord();
+	}
+	else
+	{
+		TickReplay();
+	}
+	++Frame;
+}
+
+void UInputReplaySubsystem::TickRecord()
+{
+	UEnhancedInputLocalPlayerSubsystem* EIS = GetInputSubsystem();
+	UEnhancedPlayerInput* PlayerInput = EIS ? EIS->GetPlayerInput() : nullptr;
+	if (!PlayerInput) return;
+
+	// 틱커블 단계 = 이번 프레임 입력 처리가 끝난 뒤. 값이 바뀐 액션만 기록
+	for (int32 i = 0; i < Actions.Num(); ++i)
+	{
+		const FVector Value = PlayerInput->GetActionValue(Actions[i]).Get<FVector>();
+		if (Value.Equals(LastValues[i], 0.f)) continue;
+
+		FInputEvent& E = Events.AddDefaulted_GetRef();
+		E.Frame = Frame;
+		E.ActionIndex = static_cast<uint8>(i);
+		E.Value = Value;
+		LastValues[i] = Value;
+	}
+}
+
+void UInputReplaySubsystem::TickReplay()
+{
+	// 기록의 Frame 값은 "그 프레임에 처리된 입력"이므로 한 프레임 앞서 주입한다
+	const uint32 TargetFrame = Frame + 1;
+	while (Events.IsValidIndex(NextEvent) && Events[NextEvent].Frame <= TargetFrame)
+	{
+		const FInputEvent& E = Events[NextEvent++];
+		if (LastValues.IsValidIndex(E.ActionIndex))
+		{
+			LastValues[E.ActionIndex] = E.Value;
+		}
+	}
+
+	UEnhancedInputLocalPlayerSubsystem* EIS = GetInputSubsystem();
+	if (EIS)
+	{
+		// 0이 아닌 값은 매 프레임 주입해야 홀드(Triggered)가 유지되고, 주입을 멈추면 Completed가 발생
+		for (int32 i = 0; i < Actions.Num(); ++i)
+		{
+			if (Actions[i] && !LastValues[i].IsZero())
+			{
+				EIS->InjectInputForAction(Actions[i], FInputActionValue(Actions[i]->ValueType, LastValues[i]));
+			}
+		}
+	}
+
+	// 마지막 이벤트 프레임을 지나면 종료(해제 이벤트 없이 저장된 이전 기록도 끝난다)
+	if (!Events.IsValidIndex(NextEvent) && (Events.Num() == 0 || TargetFrame > Events.Last().Frame))
+	{
+		Stop();
+	}
+}
+
+bool UInputReplaySubsystem::SaveRecording() const
+{
+	TArray<uint8> Bytes;
+	FMemoryWriter Ar(Bytes);
+
+	uint32 Magic = ReplayMagic;
+	int32 Version = ReplayVersion;
+	FString MapName = GetWorld() ? GetWorld()->GetMapName() : FString();
+	const UDeterministicSimSubsystem* Sim = UDeterministicSimSubsystem::Get(this);
+	int32 Seed = Sim ? Sim->GetSeed() : 0;
+	float StepHz = (Sim && Sim->IsEnabled()) ? 1.f / Sim->GetFixedStep() : 0.f;
+	int32 Substeps = Sim ? Sim->GetSubsteps() : 1;
+	Ar << Magic << Version << MapName << Seed << StepHz << Substeps;
+
+	int32 NumActions = Actions.Num();
+	Ar << NumActions;
+	for (const TObjectPtr<const UInputAction>& Action : Actions)
+	{
+		FString ActionPath = Action ? Action->GetPathName() : FString();
+		uint8 ValueType = static_cast<uint8>(Action ? Action->ValueType : EInputActionValueType::Axis3D);
+		Ar << ActionPath << ValueType;
+	}
+
+	int32 NumEvents = Events.Num();
+	Ar << NumEvents;
+
+	uint32 PrevFrame = 0;
+	for (const FInputEvent& E : Events)
+	{
+		// 프레임은 이전 이벤트와의 차이만 가변 길이로
+		uint32 FrameDelta = E.Frame - PrevFrame;
+		Ar.SerializeIntPacked(FrameDelta);
+		PrevFrame = E.Frame;
+
+		uint8 ActionIndex = E.ActionIndex;
+		Ar << ActionIndex;
+
+		const int32 Components = Actions[ActionIndex] ? NumComponents(Actions[ActionIndex]->ValueType) : NumComponents(EInputActionValueType::Axis3D);
+		for (int32 c = 0; c < Components; ++c)
+		{
+			float V = static_cast<float>(E.Value[c]);
+			Ar << V;
+		}
+	}
+
+	if (!FFileHelper::SaveArrayToFile(Bytes, *FilePath))
+	{
+		UE_LOG(LogInputReplay, Warning, TEXT("[InputReplay] Failed to write %s"), *FilePath);
+		return false;
+	}
+
+	UE_LOG(LogInputReplay, Display, TEXT("[InputReplay] Saved %d events (%d bytes) -> %s"), Events.Num(), Bytes.Num(), *FilePath);
+	return true;
+}
+
+bool UInputReplaySubsystem::LoadRecording(const FString& Path, int32& OutSeed, float& OutStepHz, int32& OutSubsteps)
+{
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *Path))
+	{
+		UE_LOG(LogInputReplay, Warning, TEXT("[InputReplay] Cannot read %s"), *Path);
+		return false;
+	}
+
+	FMemoryReader Ar(Bytes);
+
+	uint32 Magic = 0;
+	int32 Version = 0;
+	FString MapName;
+	Ar << Magic << Version;
+	if (Magic != ReplayMagic || Version != ReplayVersion)
+	{
+		UE_LOG(LogInputReplay, Warning, TEXT("[InputReplay] %s is not a replay file (or unsupported version)"), *Path);
+		return false;
+	}
+
+	Ar << MapName << OutSeed << OutStepHz << OutSubsteps;
+	if (GetWorld() && MapName != GetWorld()->GetMapName())
+	{
+		UE_LOG(LogInputReplay, Warning, TEXT("[InputReplay] Recorded on %s but current map is %s"), *MapName, *GetWorld()->GetMapName());
+	}
+
+	int32 NumActions = 0;
+	Ar << NumActions;
+	Actions.Reset();
+
+	// 액션 에셋을 못 찾더라도 값 크기는 파일에 기록된 타입으로 읽는다
+	TArray<int32> ComponentsByAction;
+	for (int32 i = 0; i < NumActions && !Ar.IsError(); ++i)
+	{
+		FString ActionPath;
+		uint8 ValueType = 0;
+		Ar << ActionPath << ValueType;
+
+		const UInputAction* Action = Cast<UInputAction>(FSoftObjectPath(ActionPath).TryLoad());
+		if (!Action)
+		{
+			UE_LOG(LogInputReplay, Warning, TEXT("[InputReplay] Missing input action %s; its events are skipped"), *ActionPath);
+		}
+		Actions.Add(Action);
+		ComponentsByAction.Add(NumComponents(static_cast<EInputActionValueType>(ValueType)));
+	}
+
+	int32 NumEvents = 0;
+	Ar << NumEvents;
+	Events.Reset();
+	Events.Reserve(NumEvents);
+
+	uint32 PrevFrame = 0;
+	for (int32 i = 0; i < NumEvents && !Ar.IsError(); ++i)
+	{
+		FInputEvent& E = Events.AddDefaulted_GetRef();
+
+		uint32 FrameDelta = 0;
+		Ar.SerializeIntPacked(FrameDelta);
+		E.Frame = PrevFrame + FrameDelta;
+		PrevFrame = E.Frame;
+
+		Ar << E.ActionIndex;
+
+		const int32 Components = ComponentsByAction.IsValidIndex(E.ActionIndex) ? ComponentsByAction[E.ActionIndex] : 0;
+		for (int32 c = 0; c < Components; ++c)
+		{
+			float V = 0.f;
+			Ar << V;
+			E.Value[c] = V;
+		}
+	}
+
+	if (Ar.IsError())
+	{
+		UE_LOG(LogInputReplay, Warning, TEXT("[InputReplay] %s is truncated"), *Path);
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,521 @@
+#include "Dev/MarioBenchmarkSubsystem.h"
+#include "Dev/MarioBenchCommand.h"
+
+#include "MarioOdyssey/MarioCharacter.h"
+#include "Capture/PlayerTargetSubsystem.h"
+
+#include "Engine/World.h"
+#include "Engine/LocalPlayer.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "EnhancedInputSubsystems.h"
+#include "InputActionValue.h"
+#include "HAL/FileManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+	// 착지/이륙 대기가 맵 상황 때문에 끝나지 않는 경우 다음 단계로 넘어가는 한도
+	constexpr int32 WaitConditionTimeoutFrames = 300;
+
+	uint8 ActionBit(EMarioBenchAction Action)
+	{
+		return uint8(1u << static_cast<uint8>(Action));
+	}
+
+	double CyclesToMs(uint64 Cycles)
+	{
+		return FPlatformTime::ToMilliseconds64(Cycles);
+	}
+
+#if !UE_BUILD_SHIPPING
+	FMarioBenchCommand MarioBenchCommand(
+		TEXT("mario.Bench"),
+		TEXT("마리오 컨트롤러 벤치마크 실행. 인자: [프레임 수=5000] [라벨]. 실행 중 다시 호출하면 중지"),
+		[](const TArray<FString>& Args, UWorld* World)
+		{
+			UMarioBenchmarkSubsystem* Bench = UMarioBenchmarkSubsystem::Get(World);
+			if (!Bench) return;
+
+			if (Bench->IsRunning())
+			{
+				Bench->StopBenchmark();
+				return;
+			}
+
+			const int32 Frames = MarioBench::IntArg(Args, 0, 5000);
+			Bench->StartBenchmark(Frames, Args.Num() > 1 ? Args[1] : FString());
+		});
+#endif
+}
+
+void FMarioBenchTickBracket::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (!Owner) return;
+
+	if (bIsStart)
+	{
+		Owner->OnMovementTickStart();
+	}
+	else
+	{
+		Owner->OnMovementTickEnd();
+	}
+}
+
+UMarioBenchmarkSubsystem* UMarioBenchmarkSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UMarioBenchmarkSubsystem>() : nullptr;
+}
+
+bool UMarioBenchmarkSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+#if UE_BUILD_SHIPPING
+	return false;
+#else
+	return Super::ShouldCreateSubsystem(Outer);
+#endif
+}
+
+void UMarioBenchmarkSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	MovementStartTick.Owner = this;
+	MovementStartTick.bIsStart = true;
+	MovementStartTick.bCanEverTick = true;
+	MovementStartTick.bStartWithTickEnabled = true;
+
+	MovementEndTick.Owner = this;
+	MovementEndTick.bIsStart = false;
+	MovementEndTick.bCanEverTick = true;
+	MovementEndTick.bStartWithTickEnabled = true;
+	// 이동 틱이 끝나자마자 실행되어 다른 틱이 측정 구간에 끼어드는 것을 줄인다
+	MovementEndTick.bHighPriority = true;
+}
+
+void UMarioBenchmarkSubsystem::Deinitialize()
+{
+	if (bRunning)
+	{
+		StopBenchmark();
+	}
+	DetachFromMario();
+
+	Super::Deinitialize();
+}
+
+void UMarioBenchmarkSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// 커맨드라인 자동 실행(-MarioBench=5000 [-MarioBenchLabel=xxx] [-MarioBenchQuit])
+	int32 Frames = 0;
+	if (InWorld.IsGameWorld() && FParse::Value(FCommandLine::Get(), TEXT("MarioBench="), Frames) && Frames > 0)
+	{
+		FParse::Value(FCommandLine::Get(), TEXT("MarioBenchLabel="), RunLabel);
+		bQuitWhenDone = FParse::Param(FCommandLine::Get(), TEXT("MarioBenchQuit"));
+
+		// 마리오 스폰/입력 세팅이 끝난 뒤 시작하도록 Tick에서 대기
+		PendingFrames = Frames;
+	}
+}
+
+TStatId UMarioBenchmarkSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMarioBenchmarkSubsystem, STATGROUP_Tickables);
+}
+
+void UMarioBenchmarkSubsystem::StartBenchmark(int32 FrameCount, const FString& Label)
+{
+	if (bRunning) return;
+
+	TargetFrames = FMath::Max(1, FrameCount);
+	if (!Label.IsEmpty())
+	{
+		RunLabel = Label;
+	}
+
+	if (!AttachToMario())
+	{
+		UE_LOG(LogMarioBench, Warning, TEXT("[MarioBench] Mario (or its local player) not found; benchmark not started"));
+		return;
+	}
+
+	Samples.Reset();
+	Samples.Reserve(TargetFrames);
+	Timings.Reset();
+#if !UE_BUILD_SHIPPING
+	TimerOpsAtStart = GMarioTimerOps;
+#endif
+
+	BuildCourse();
+	StepIndex = 0;
+	StepFrames = 0;
+	HeldMask = 0;
+	CourseFrame = 0;
+
+	bRunning = true;
+	UE_LOG(LogMarioBench, Display, TEXT("[MarioBench] Started: %d frames"), TargetFrames);
+}
+
+void UMarioBenchmarkSubsystem::StopBenchmark()
+{
+	if (!bRunning) return;
+
+	bRunning = false;
+	DetachFromMario();
+	WriteResults();
+
+	if (bQuitWhenDone)
+	{
+		FPlatformMisc::RequestExit(false);
+	}
+}
+
+bool UMarioBenchmarkSubsystem::AttachToMario()
+{
+	const UPlayerTargetSubsystem* Targets = UPlayerTargetSubsystem::Get(this);
+	AMarioCharacter* M = Targets ? Targets->GetMario() : nullptr;
+	if (!M || !Cast<APlayerController>(M->GetController())) return false;
+
+	Mario = M;
+	M->SetBenchTimings(&Timings);
+
+	UCharacterMovementComponent* Move = M->GetCharacterMovement();
+	ULevel* Level = GetWorld() ? GetWorld()->PersistentLevel : nullptr;
+	if (Move && Level && !bBracketsRegistered)
+	{
+		MovementStartTick.TickGroup = Move->PrimaryComponentTick.TickGroup;
+		MovementEndTick.TickGroup = Move->PrimaryComponentTick.TickGroup;
+		MovementStartTick.RegisterTickFunction(Level);
+		MovementEndTick.RegisterTickFunction(Level);
+
+		Move->PrimaryComponentTick.AddPrerequisite(this, MovementStartTick);
+		MovementEndTick.AddPrerequisite(Move, Move->PrimaryComponentTick);
+		bBracketsRegistered = true;
+	}
+	return true;
+}
+
+void UMarioBenchmarkSubsystem::DetachFromMario()
+{
+	AMarioCharacter* M = Mario.Get();
+	if (M)
+	{
+		M->SetBenchTimings(nullptr);
+	}
+
+	if (bBracketsRegistered)
+	{
+		if (UCharacterMovementComponent* Move = M ? M->GetCharacterMovement() : nullptr)
+		{
+			Move->PrimaryComponentTick.RemovePrerequisite(this, MovementStartTick);
+			MovementEndTick.RemovePrerequisite(Move, Move->PrimaryComponentTick);
+		}
+		MovementStartTick.UnRegisterTickFunction();
+		MovementEndTick.UnRegisterTickFunction();
+		bBracketsRegistered = false;
+	}
+
+	Mario.Reset();
+}
+
+void UMarioBenchmarkSubsystem::OnMovementTickStart()
+{
+	MovementStartCycles = FPlatformTime::Cycles64();
+}
+
+void UMarioBenchmarkSubsystem::OnMovementTickEnd()
+{
+	if (MovementStartCycles == 0) return;
+
+	Timings.MovementCycles += FPlatformTime::Cycles64() - MovementStartCycles;
+	MovementStartCycles = 0;
+}
+
+void UMarioBenchmarkSubsystem::Tick(float DeltaTime)
+{
+	if (!bRunning)
+	{
+		// 커맨드라인 자동 실행 대기
+		if (PendingFrames > 0 && UPlayerTargetSubsystem::Get(this) && UPlayerTargetSubsystem::Get(this)->GetMario())
+		{
+			const int32 Frames = PendingFrames;
+			PendingFrames = 0;
+			StartBenchmark(Frames, RunLabel);
+		}
+		return;
+	}
+
+	if (!Mario.IsValid())
+	{
+		UE_LOG(LogMarioBench, Warning, TEXT("[MarioBench] Mario destroyed during run; writing partial results"));
+		StopBenchmark();
+		return;
+	}
+
+	// 월드 틱 이후(틱커블 단계)라 이번 프레임 측정값이 모두 누적된 상태
+	if (CourseFrame > 0)
+	{
+		FFrameSample& S = Samples.AddDefaulted_GetRef();
+		S.DeltaSeconds = DeltaTime;
+		S.TickMs = CyclesToMs(Timings.TickCycles);
+		S.DownhillBoostMs = CyclesToMs(Timings.DownhillBoostCycles);
+		S.WallSlideMs = CyclesToMs(Timings.WallSlideCycles);
+		S.MovementMs = CyclesToMs(Timings.MovementCycles);
+	}
+	Timings.Reset();
+
+	if (Samples.Num() >= TargetFrames)
+	{
+		StopBenchmark();
+		return;
+	}
+
+	// 다음 프레임 입력
+	AdvanceCourse();
+	InjectHeldInputs();
+	++CourseFrame;
+}
+
+void UMarioBenchmarkSubsystem::BuildCourse()
+{
+	auto Wait = [this](int32 Frames) { Course.Add({ EStepKind::WaitFrames, EMarioBenchAction::Jump, Frames }); };
+	auto WaitGrounded = [this]() { Course.Add({ EStepKind::WaitGrounded, EMarioBenchAction::Jump, 0 }); };
+	auto WaitAirborne = [this]() { Course.Add({ EStepKind::WaitAirborne, EMarioBenchAction::Jump, 0 }); };
+	auto Press = [this](EMarioBenchAction A) { Course.Add({ EStepKind::Press, A, 0 }); };
+	auto Hold = [this](EMarioBenchAction A) { Course.Add({ EStepKind::Hold, A, 0 }); };
+	auto Release = [this](EMarioBenchAction A) { Course.Add({ EStepKind::Release, A, 0 }); };
+
+	Course.Reset();
+
+	// 달리기 유지
+	Hold(EMarioBenchAction::Run);
+	Wait(30);
+
+	// 3단 점프(착지 직후 점프 연계)
+	for (int32 i = 0; i < 3; ++i)
+	{
+		WaitGrounded();
+		Press(EMarioBenchAction::Jump);
+		WaitAirborne();
+	}
+	WaitGrounded();
+	Wait(20);
+
+	// 구르기: 웅크린 상태에서 달리기 재입력
+	Release(EMarioBenchAction::Run);
+	Hold(EMarioBenchAction::Crouch);
+	Wait(6);
+	Press(EMarioBenchAction::Run);
+	Wait(45);
+	Release(EMarioBenchAction::Crouch);
+	Wait(20);
+
+	// 엉덩방아
+	Press(EMarioBenchAction::Jump);
+	Wait(15);
+	Press(EMarioBenchAction::Crouch);
+	WaitGrounded();
+	Wait(100);
+
+	// 엉덩방아 -> 다이브
+	Press(EMarioBenchAction::Jump);
+	Wait(15);
+	Press(EMarioBenchAction::Crouch);
+	Wait(8);
+	Press(EMarioBenchAction::Crouch);
+	WaitGrounded();
+	Wait(30);
+
+	// 벽 슬라이드 시도(맵에 벽이 있으면 전방 점프로 붙는다) + 모자 던지기
+	Hold(EMarioBenchAction::Run);
+	Press(EMarioBenchAction::Jump);
+	Wait(60);
+	Press(EMarioBenchAction::ThrowCap);
+	WaitGrounded();
+	Wait(30);
+}
+
+void UMarioBenchmarkSubsystem::AdvanceCourse()
+{
+	AMarioCharacter* M = Mario.Get();
+	const UCharacterMovementComponent* Move = M ? M->GetCharacterMovement() : nullptr;
+	if (!Move || Course.Num() == 0) return;
+
+	// 한 프레임에 대기 단계를 만날 때까지 진행
+	for (int32 Guard = 0; Guard < Course.Num(); ++Guard)
+	{
+		const FStep& Step = Course[StepIndex];
+		bool bDone = true;
+
+		switch (Step.Kind)
+		{
+		case EStepKind::WaitFrames:
+			bDone = StepFrames >= Step.Frames;
+			break;
+		case EStepKind::WaitGrounded:
+			bDone = Move->IsMovingOnGround() || StepFrames >= WaitConditionTimeoutFrames;
+			break;
+		case EStepKind::WaitAirborne:
+			bDone = Move->IsFalling() || StepFrames >= WaitConditionTimeoutFrames;
+			break;
+		case EStepKind::Press:
+			InjectAction(Step.Action, FInputActionValue(true));
+			break;
+		case EStepKind::Hold:
+			HeldMask |= ActionBit(Step.Action);
+			break;
+		case EStepKind::Release:
+			HeldMask &= ~ActionBit(Step.Action);
+			break;
+		}
+
+		if (!bDone)
+		{
+			++StepFrames;
+			return;
+		}
+
+		StepFrames = 0;
+		StepIndex = (StepIndex + 1) % Course.Num();
+
+		// 누름은 프레임당 하나(같은 프레임에 Started가 겹치지 않게)
+		if (Step.Kind == EStepKind::Press)
+		{
+			return;
+		}
+	}
+}
+
+void UMarioBenchmarkSubsystem::InjectHeldInputs()
+{
+	AMarioCharacter* M = Mario.Get();
+	if (!M) return;
+
+	// 이동: 천천히 방향이 바뀌는 전방 입력(벽/경사를 고르게 훑도록)
+	const float Angle = CourseFrame * 0.01f;
+	InjectRaw(M->GetMoveAction(), FInputActionValue(FVector2D(FMath::Sin(Angle) * 0.3f, 1.f)));
+
+	// 홀드 입력은 매 프레임 주입해야 Triggered가 유지된다
+	for (const EMarioBenchAction A : { EMarioBenchAction::Crouch, EMarioBenchAction::Run })
+	{
+		if (HeldMask & ActionBit(A))
+		{
+			InjectAction(A, FInputActionValue(true));
+		}
+	}
+}
+
+void UMarioBenchmarkSubsystem::InjectAction(EMarioBenchAction Action, const FInputActionValue& Value)
+{
+	InjectRaw(ResolveAction(Action), Value);
+}
+
+void UMarioBenchmarkSubsystem::InjectRaw(const UInputAction* Action, const FInputActionValue& Value)
+{
+	const AMarioCharacter* M = Mario.Get();
+	if (!M || !Action) return;
+
+	const APlayerController* PC = Cast<APlayerController>(M->GetController());
+	UEnhancedInputLocalPlayerSubsystem* EIS = PC ? ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(PC->GetLocalPlayer()) : nullptr;
+	if (!EIS) return;
+
+	// 실제 입력과 같은 경로(매핑 컨텍스트/트리거)로 처리되도록 Enhanced Input에 주입
+	EIS->InjectInputForAction(Action, Value);
+}
+
+const UInputAction* UMarioBenchmarkSubsystem::ResolveAction(EMarioBenchAction Action) const
+{
+	const AMarioCharacter* M = Mario.Get();
+	if (!M) return nullptr;
+
+	switch (Action)
+	{
+	case EMarioBenchAction::Jump:     return M->GetJumpAction();
+	case EMarioBenchAction::Crouch:   return M->GetCrouchAction();
+	case EMarioBenchAction::Run:      return M->GetRunAction();
+	case EMarioBenchAction::ThrowCap: return M->GetThrowCapAction();
+	}
+	return nullptr;
+}
+
+void UMarioBenchmarkSubsystem::WriteResults() const
+{
+	if (Samples.Num() == 0)
+	{
+		UE_LOG(LogMarioBench, Warning, TEXT("[MarioBench] No samples recorded"));
+		return;
+	}
+
+	const FString Dir = FPaths::Combine(FPaths::ProfilingDir(), TEXT("MarioBench"));
+	IFileManager::Get().MakeDirectory(*Dir, true);
+
+	const FString Stamp = FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S"));
+	const FString BaseName = RunLabel.IsEmpty() ? Stamp : FString::Printf(TEXT("%s-%s"), *RunLabel, *Stamp);
+
+	// 프레임별 CSV
+	FString Csv = TEXT("frame,delta_ms,tick_ms,downhill_boost_ms,wall_slide_ms,movement_ms\n");
+	TArray<double> Tick, Downhill, WallSlide, Movement;
+	for (int32 i = 0; i < Samples.Num(); ++i)
+	{
+		const FFrameSample& S = Samples[i];
+		Csv += FString::Printf(TEXT("%d,%.4f,%.5f,%.5f,%.5f,%.5f\n"),
+			i, S.DeltaSeconds * 1000.f, S.TickMs, S.DownhillBoostMs, S.WallSlideMs, S.MovementMs);
+
+		Tick.Add(S.TickMs);
+		Downhill.Add(S.DownhillBoostMs);
+		WallSlide.Add(S.WallSlideMs);
+		Movement.Add(S.MovementMs);
+	}
+
+	// 요약 JSON(커밋 간 회귀 추적용)
+	auto StatsJson = [](const TCHAR* Name, const TArray<double>& Values)
+	{
+		const FMarioBenchSampleStats St = FMarioBenchSampleStats::Compute(Values);
+		return FString::Printf(TEXT("\"%s\":{\"avg_ms\":%.5f,\"p50_ms\":%.5f,\"p95_ms\":%.5f,\"max_ms\":%.5f}"),
+			Name, St.Avg, St.P50, St.P95, St.Max);
+	};
+
+	// 타이머 연산/초(게임 시간 기준). 타임라인 Schedule 1회 = 이전 구조의 SetTimer 1회
+	double SimSeconds = 0.0;
+	for (const FFrameSample& S : Samples) SimSeconds += S.DeltaSeconds;
+	const double InvSeconds = SimSeconds > 0.0 ? 1.0 / SimSeconds : 0.0;
+
+#if !UE_BUILD_SHIPPING
+	const FMarioTimerOpCounters& TimerOps = GMarioTimerOps;
+#else
+	const FMarioTimerOpCounters TimerOps;
+#endif
+	const uint64 HeapSets = TimerOps.HeapSets - TimerOpsAtStart.HeapSets;
+	const uint64 TimelineSchedules = TimerOps.TimelineSchedules - TimerOpsAtStart.TimelineSchedules;
+	const uint64 TimelineCancels = TimerOps.TimelineCancels - TimerOpsAtStart.TimelineCancels;
+
+	// combined = 힙 SetTimer + 타임라인 Schedule 합(측정값의 단순 합이며 타임라인을 끈 실측 기준선이 아님)
+	const FString TimerJson = FString::Printf(
+		TEXT("\"timer_ops\":{\"heap_sets_per_sec\":%.2f,\"timeline_schedules_per_sec\":%.2f,\"timeline_cancels_per_sec\":%.2f,\"combined_timer_ops_per_sec\":%.2f}"),
+		HeapSets * InvSeconds, TimelineSchedules * InvSeconds, TimelineCancels * InvSeconds,
+		(HeapSets + TimelineSchedules) * InvSeconds);
+
+	const FString Json = FString::Printf(TEXT("{\"label\":\"%s\",\"frames\":%d,%s,%s,%s,%s,%s}\n"),
+		*RunLabel.ReplaceCharWithEscapedChar(), Samples.Num(),
+		*StatsJson(TEXT("Tick"), Tick),
+		*StatsJson(TEXT("UpdateDownhillBoost"), Downhill),
+		*StatsJson(TEXT("UpdateWallSlidePhysics"), WallSlide),
+		*StatsJson(TEXT("CharacterMovement"), Movement),
+		*TimerJson);
+
+	const FString CsvPath = FPaths::Combine(Dir, BaseName + TEXT(".csv"));
+	const FString JsonPath = FPaths::Combine(Dir, BaseName + TEXT(".json"));
+	FFileHelper::SaveStringToFile(Csv, *CsvPath);
+	FFileHelper::SaveStringToFile(Json, *JsonPath);
+
+	UE_LOG(LogMarioBench, Display, TEXT("[MarioBench] %d frames -> %s"), Samples.Num(), *JsonPath);
+	UE_LOG(LogMarioBench, Display, TEXT("[MarioBench] %s"), *Json.TrimEnd());
+}
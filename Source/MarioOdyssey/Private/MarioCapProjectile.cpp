@@ -1,13 +1,14 @@
 #include "MarioCapProjectile.h"
 
+#include "MarioOdyssey/MarioOdysseyStats.h"
+
 #include "Kismet/GameplayStatics.h"
 #include "Capture/CaptureComponent.h"
-#include "Capture/CapturableInterface.h"
+#include "Capture/CaptureCapability.h"
 #include "GameFramework/Pawn.h"
 #include "Components/SphereComponent.h"
 #include "GameFramework/ProjectileMovementComponent.h"
 #include "GameFramework/RotatingMovementComponent.h"
-#include "TimerManager.h"
 
 namespace
 {
@@ -18,6 +19,7 @@ namespace
 AMarioCapProjectile::AMarioCapProjectile()
 {
 	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false; // Launch 때만 켠다
 
 	Collision = CreateDefaultSubobject<USphereComponent>(TEXT("Collision"));
 	SetRootComponent(Collision);
@@ -50,44 +52,34 @@ AMarioCapProjectile::AMarioCapProjectile()
 	InitialLifeSpan = 0.0f;
 }
 
-bool AMarioCapProjectile::IsCapturableTarget(AActor* TargetActor, UPrimitiveComponent* TargetComp) const
+uint8 AMarioCapProjectile::GetCapturePriority(const AActor* TargetActor, const UPrimitiveComponent* TargetComp) const
 {
-	if (!TargetActor) return false;
+	if (!TargetActor) return 0;
 	//Actor가 CapturableInterface 구현
-	if (TargetActor->GetClass()->ImplementsInterface(UCapturableInterface::StaticClass()))
+	if (CaptureCapability::IsCapturableClass(TargetActor->GetClass()))
 	{
-		return true;
+		return 3;
 	}
 	// 일부 구현은 "몬스터 컴포넌트"가 인터페이스 구현
-	if (TargetComp && TargetComp->GetClass()->ImplementsInterface(UCapturableInterface::StaticClass()))
+	if (TargetComp && CaptureCapability::IsCapturableClass(TargetComp->GetClass()))
 	{
-		return true;
+		return 2;
 	}
 	// 태그 기반 fallback(프로필/채널 꼬임, 블루프린트 인터페이스 누락 대비)
 	if (TargetActor->ActorHasTag(TAG_Capturable) || TargetActor->ActorHasTag(TAG_Monster))
 	{
-		return true;
+		return 1;
 	}
-	return false;
+	return 0;
 }
 
-bool AMarioCapProjectile::TryCaptureTarget(AActor* TargetActor, UPrimitiveComponent* TargetComp, const FHitResult* OptionalHit)
+bool AMarioCapProjectile::TryCaptureTarget(AActor* TargetActor, const FVector& HitLocation)
 {
 	if (!OwnerActor.IsValid() || !TargetActor) return false;
-	if (TargetActor == OwnerActor.Get()) return false;
-	if (!IsCapturableTarget(TargetActor, TargetComp)) return false;
 
 	FCaptureContext Ctx;
 	Ctx.SourceActor = this;
-	if (OptionalHit)
-	{
-		const FVector Impact = FVector(OptionalHit->ImpactPoint);
-		Ctx.HitLocation = Impact.IsNearlyZero() ? TargetActor->GetActorLocation() : Impact;
-	}
-	else
-	{
-		Ctx.HitLocation = TargetActor->GetActorLocation();
-	}
+	Ctx.HitLocation = HitLocation;
 
 	if (APawn* OwnerPawn = Cast<APawn>(OwnerActor.Get()))
 	{
@@ -114,21 +106,154 @@ bool AMarioCapProjectile::TryCaptureTarget(AActor* TargetActor, UPrimitiveCompon
 	return false;
 }
 
+bool AMarioCapProjectile::QueueCaptureCandidate(AActor* TargetActor, UPrimitiveComponent* TargetComp, const FHitResult* OptionalHit, bool bFromHit)
+{
+	if (!TargetActor || TargetActor == OwnerActor.Get()) return false;
+
+	const uint8 Priority = GetCapturePriority(TargetActor, TargetComp);
+	if (Priority == 0) return false;
+
+	FVector HitLocation = TargetActor->GetActorLocation();
+	if (OptionalHit && !FVector(OptionalHit->ImpactPoint).IsNearlyZero())
+	{
+		HitLocation = FVector(OptionalHit->ImpactPoint);
+	}
+
+	// 같은 액터의 여러 컴포넌트는 후보 1개로 합친다
+	for (FCaptureCandidate& Existing : CaptureCandidates)
+	{
+		if (Existing.Actor.Get() == TargetActor)
+		{
+			if (Priority > Existing.Priority)
+			{
+				Existing.Priority = Priority;
+				Existing.HitLocation = HitLocation;
+			}
+			Existing.bFromHit |= bFromHit;
+			return true;
+		}
+	}
+
+	FCaptureCandidate& Candidate = CaptureCandidates.AddDefaulted_GetRef();
+	Candidate.Actor = TargetActor;
+	Candidate.HitLocation = HitLocation;
+	Candidate.Priority = Priority;
+	Candidate.bFromHit = bFromHit;
+	return true;
+}
+
+void AMarioCapProjectile::ResolveCaptureCandidates()
+{
+	if (CaptureCandidates.Num() == 0) return;
+
+	// 우선순위가 높고, 같으면 모자에 가까운 후보 1개
+	const FVector CapLocation = GetActorLocation();
+	const FCaptureCandidate* Best = nullptr;
+	float BestDistSq = 0.f;
+	bool bAnyFromHit = false;
+	for (const FCaptureCandidate& Candidate : CaptureCandidates)
+	{
+		bAnyFromHit |= Candidate.bFromHit;
+		if (!Candidate.Actor.IsValid()) continue;
+
+		const float DistSq = FVector::DistSquared(CapLocation, Candidate.HitLocation);
+		if (!Best || Candidate.Priority > Best->Priority || (Candidate.Priority == Best->Priority && DistSq < BestDistSq))
+		{
+			Best = &Candidate;
+			BestDistSq = DistSq;
+		}
+	}
+
+	AActor* Target = Best ? Best->Actor.Get() : nullptr;
+	const FVector HitLocation = Best ? Best->HitLocation : FVector::ZeroVector;
+	CaptureCandidates.Reset();
+
+	if (Target && TryCaptureTarget(Target, HitLocation))
+	{
+		Retire(ECapRetireReason::Captured);
+		return;
+	}
+
+	// 기존 동작 유지: 블록 Hit는 항상, Overlap은 Outgoing일 때만 Hover로
+	if (bAnyFromHit || Phase == ECapPhase::Outgoing)
+	{
+		EnterHover();
+	}
+}
+
 void AMarioCapProjectile::BeginPlay()
 {
 	Super::BeginPlay();
 
 	OwnerActor = GetOwner();
-	
+
+	// 스폰 직후엔 풀 대기 상태(마리오가 Launch로 꺼내 쓴다)
+	DeactivateToPool();
+}
+
+void AMarioCapProjectile::Launch(const FVector& Location, const FRotator& Rotation, const FVector& Dir, float Speed)
+{
+	INC_DWORD_STAT(STAT_MarioOdyssey_PoolAcquires);
+
+	OwnerActor = GetOwner();
+
 	Phase = ECapPhase::Outgoing;
+	PhaseElapsed = 0.f;
 	bHoldReleased = false;
 	bMinHoverPassed = false;
+	bHasLastBlockNormal = false;
+	bInFlight = true;
+
+	// ProjectileMove가 Collision(루트)을 직접 움직이므로 위치만 옮기면 된다
+	SetActorLocationAndRotation(Location, Rotation, false, nullptr, ETeleportType::ResetPhysics);
 
-	// 0.1초 전진 후 Hover
-	if (UWorld* World = GetWorld())
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+	SetActorTickEnabled(true);
+
+	if (ProjectileMove && Collision)
+	{
+		// 정지(StopSimulating) 시 UpdatedComponent가 해제되므로 다시 연결
+		ProjectileMove->SetUpdatedComponent(Collision);
+		ProjectileMove->bIsHomingProjectile = false;
+		ProjectileMove->HomingTargetComponent = nullptr;
+		ProjectileMove->Activate(true);
+	}
+	if (RotMove)
 	{
-		World->GetTimerManager().SetTimer(OutgoingTimer, this, &AMarioCapProjectile::EnterHover, OutgoingDuration, false);
+		RotMove->Activate(true);
 	}
+
+	FireInDirection(Dir, Speed);
+}
+
+void AMarioCapProjectile::Retire(ECapRetireReason Reason)
+{
+	if (!bInFlight) return;
+
+	DeactivateToPool();
+	OnRetired.ExecuteIfBound(Reason);
+}
+
+void AMarioCapProjectile::DeactivateToPool()
+{
+	bInFlight = false;
+	PhaseElapsed = 0.f;
+	CaptureCandidates.Reset();
+
+	if (ProjectileMove)
+	{
+		ProjectileMove->StopMovementImmediately();
+		ProjectileMove->Deactivate();
+	}
+	if (RotMove)
+	{
+		RotMove->Deactivate();
+	}
+
+	SetActorTickEnabled(false);
+	SetActorEnableCollision(false);
+	SetActorHiddenInGame(true);
 }
 
 void AMarioCapProjectile::FireInDirection(const FVector& Dir, float Speed)
@@ -155,15 +280,9 @@ void AMarioCapProjectile::EnterHover()
 {
 	if (Phase == ECapPhase::Returning) return; // Returning 중엔 건드리지 않음
 
+	// 벽/몬스터에 다시 닿으면 체공 시계를 처음부터(최소/최대 체공 재시작)
 	Phase = ECapPhase::Hover;
-
-	//기존 타이머/OutgoingTimer 정리해서 꼬임 방지
-	if (UWorld* World = GetWorld())
-	{
-		World->GetTimerManager().ClearTimer(OutgoingTimer);
-		World->GetTimerManager().ClearTimer(MinHoverTimer);
-		World->GetTimerManager().ClearTimer(MaxHoverTimer);
-	}
+	PhaseElapsed = 0.f;
 
 	// StopSimulating으로 UpdatedComponent가 끊겼을 수 있으니 Hover에서 복구
 	if (ProjectileMove && Collision)
@@ -173,32 +292,36 @@ void AMarioCapProjectile::EnterHover()
 		ProjectileMove->StopMovementImmediately();
 		ProjectileMove->bIsHomingProjectile = false;
 	}
-
-	// Hover 타이머 재설정
-	if (UWorld* World = GetWorld())
-	{
-		World->GetTimerManager().SetTimer(MinHoverTimer, this, &AMarioCapProjectile::OnMinHoverReached, MinHoverTime, false);
-		World->GetTimerManager().SetTimer(MaxHoverTimer, this, &AMarioCapProjectile::OnMaxHoverReached, MaxHoverTime, false);
-	}
 }
 
-void AMarioCapProjectile::OnMinHoverReached()
+void AMarioCapProjectile::TickPhaseClock(float DeltaTime)
 {
-	bMinHoverPassed = true;
+	PhaseElapsed += DeltaTime;
 
-	// 키를 이미 뗐다면, 최소 체공 지난 즉시 귀환
-	if (bHoldReleased && Phase == ECapPhase::Hover)
+	switch (Phase)
 	{
-		BeginReturn();
-	}
-}
+	case ECapPhase::Outgoing:
+		// 0.1초 전진 후 Hover
+		if (PhaseElapsed >= OutgoingDuration)
+		{
+			EnterHover();
+		}
+		break;
 
-void AMarioCapProjectile::OnMaxHoverReached()
-{
-	// 홀드를 계속 누르고 있어도 최대 3초면 무조건 귀환
-	if (Phase == ECapPhase::Hover)
-	{
-		BeginReturn();
+	case ECapPhase::Hover:
+		if (!bMinHoverPassed && PhaseElapsed >= MinHoverTime)
+		{
+			bMinHoverPassed = true;
+		}
+		// 키를 이미 뗐다면 최소 체공 지난 즉시, 홀드 중이어도 최대 체공이면 무조건 귀환
+		if ((bHoldReleased && bMinHoverPassed) || PhaseElapsed >= MaxHoverTime)
+		{
+			BeginReturn();
+		}
+		break;
+
+	case ECapPhase::Returning:
+		break;
 	}
 }
 
@@ -206,22 +329,11 @@ void AMarioCapProjectile::BeginReturn()
 {
 	if (Phase == ECapPhase::Returning) return;
 	Phase = ECapPhase::Returning;
-	
-	if (UWorld* World = GetWorld())
-	{
-		World->GetTimerManager().ClearTimer(OutgoingTimer);
-		World->GetTimerManager().ClearTimer(MinHoverTimer);
-		World->GetTimerManager().ClearTimer(MaxHoverTimer);
-	}
+	PhaseElapsed = 0.f;
 
-	if (!OwnerActor.IsValid())
+	if (!OwnerActor.IsValid() || !ProjectileMove || !Collision)
 	{
-		Destroy();
-		return;
-	}
-	if (!ProjectileMove || !Collision)
-	{
-		Destroy();
+		Retire(ECapRetireReason::Lost);
 		return;
 	}
 	
@@ -248,33 +360,33 @@ void AMarioCapProjectile::BeginReturn()
 void AMarioCapProjectile::OnCapHit(UPrimitiveComponent* HitComp, AActor* OtherActor, UPrimitiveComponent* OtherComp,
 	FVector NormalImpulse, const FHitResult& Hit)
 {
+	if (!bInFlight) return;
 	if (!OtherActor || !OwnerActor.IsValid()) return;
 	if (OtherActor == OwnerActor.Get()) return;
 
 	bHasLastBlockNormal = Hit.bBlockingHit;
 	LastBlockNormal = Hit.Normal;
 
-	// 프리셋/채널이 Block으로 잡혀도 캡쳐가 동작하도록 Hit에서도 캡쳐 시도
-	if (TryCaptureTarget(OtherActor, OtherComp, &Hit))
+	// 프리셋/채널이 Block으로 잡혀도 캡쳐가 동작하도록 Hit에서도 후보 수집(Hover 전환은 판정 후)
+	if (QueueCaptureCandidate(OtherActor, OtherComp, &Hit, true))
 	{
-		Destroy();
 		return;
 	}
 
-	// 기존 동작 유지: 벽/몬스터에 닿으면 Hover로 들어감
+	// 기존 동작 유지: 벽에 닿으면 Hover로 들어감
 	EnterHover();
 }
 
 void AMarioCapProjectile::OnCapBeginOverlap(UPrimitiveComponent* OverlappedComp, AActor* OtherActor,
 	UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
 {
+	if (!bInFlight) return;
 	if (!OtherActor || !OwnerActor.IsValid()) return;
 	if (OtherActor == OwnerActor.Get()) return;
 
 	const FHitResult* HitPtr = bFromSweep ? &SweepResult : nullptr;
-	if (TryCaptureTarget(OtherActor, OtherComp, HitPtr))
+	if (QueueCaptureCandidate(OtherActor, OtherComp, HitPtr, false))
 	{
-		Destroy();
 		return;
 	}
 
@@ -287,6 +399,8 @@ void AMarioCapProjectile::OnCapBeginOverlap(UPrimitiveComponent* OverlappedComp,
 
 void AMarioCapProjectile::OnProjectileStopped(const FHitResult& ImpactResult)
 {
+	if (!bInFlight) return;
+
 	bHasLastBlockNormal = ImpactResult.bBlockingHit;
 	LastBlockNormal = ImpactResult.Normal;
 	if (Phase != ECapPhase::Returning)
@@ -304,6 +418,20 @@ void AMarioCapProjectile::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
+	// 지난 이동 중 모인 캡쳐 후보를 한 번에 판정(성공 시 Retire)
+	ResolveCaptureCandidates();
+	if (!bInFlight)
+	{
+		return;
+	}
+
+	// Outgoing/Hover 진행(BeginReturn에서 Retire 될 수 있음)
+	TickPhaseClock(DeltaTime);
+	if (!bInFlight)
+	{
+		return;
+	}
+
 	// Returning이면 캐치 거리에서 종료(=마리오에게 돌아옴)
 	if (Phase == ECapPhase::Returning && OwnerActor.IsValid())
 	{
@@ -311,12 +439,12 @@ void AMarioCapProjectile::Tick(float DeltaTime)
 		const float Dist = FVector::Dist(GetActorLocation(), OwnerActor->GetActorLocation());
 		if (Dist <= CatchDistance)
 		{
-			Destroy();
+			Retire(ECapRetireReason::Caught);
 			return;
 		}
 
 		// Return 이동(벽 관통 없이)
-		if (!ProjectileMove || !Collision) { Destroy(); return; }
+		if (!ProjectileMove || !Collision) { Retire(ECapRetireReason::Lost); return; }
 
 		const FVector ToOwner = OwnerActor->GetActorLocation() - GetActorLocation();
 		FVector Dir = ToOwner.GetSafeNormal();
@@ -365,3 +493,62 @@ void AMarioCapProjectile::Tick(float DeltaTime)
 		}
 	}
 }
+
+#if !UE_BUILD_SHIPPING
+#include "MarioOdyssey/MarioCharacter.h"
+#include "Engine/World.h"
+#include "Dev/MarioBenchCommand.h"
+#include "UObject/UObjectArray.h"
+
+// AMarioCharacter의 friend. 입력 주입 없이 던지기 경로만 반복한다
+struct FMarioCapBenchAccess
+{
+	static void ThrowCap(AMarioCharacter& Mario) { Mario.ThrowCap(); }
+};
+
+namespace MarioCapBench
+{
+	// 모자 풀 검증: 던지기 -> 즉시 회수를 N번 반복하는 동안 액터/UObject 생성 수를 센다(둘 다 0이어야 함)
+	static FMarioBenchCommand MarioCapThrowStressCommand(
+		TEXT("mario.CapThrowStress"),
+		TEXT("모자 던지기/회수 반복 중 액터 할당 확인. 인자: [반복 수=1000]"),
+		[](const TArray<FString>& Args, UWorld* World)
+		{
+			AMarioCharacter* M = MarioBench::FindMario(World);
+			if (!M) return;
+
+			const int32 Throws = MarioBench::IntArg(Args, 0, 1000);
+
+			// 첫 던지기 전에 모자가 이미 있어야 한다(BeginPlay 프리스폰)
+			const AMarioCapProjectile* Cap = M->GetCapActor();
+			if (!Cap)
+			{
+				UE_LOG(LogMarioBench, Warning, TEXT("[MarioBench] CapThrowStress: Mario has no pooled cap (CapProjectileClass unset?)"));
+				return;
+			}
+
+			int32 ActorSpawns = 0;
+			const FDelegateHandle SpawnHandle = World->AddOnActorSpawnedHandler(
+				FOnActorSpawned::FDelegate::CreateLambda([&ActorSpawns](AActor*) { ++ActorSpawns; }));
+			const int32 ObjectsBefore = GUObjectArray.GetObjectArrayNumMinusAvailable();
+
+			int32 Launched = 0;
+			for (int32 i = 0; i < Throws; ++i)
+			{
+				FMarioCapBenchAccess::ThrowCap(*M);
+				if (AMarioCapProjectile* Active = M->GetCapActor(); Active && Active->IsInFlight())
+				{
+					++Launched;
+					Active->Retire(ECapRetireReason::Caught);
+				}
+			}
+
+			const int32 ObjectDelta = GUObjectArray.GetObjectArrayNumMinusAvailable() - ObjectsBefore;
+			World->RemoveOnActorSpawnedHandler(SpawnHandle);
+
+			UE_LOG(LogMarioBench, Display, TEXT("[MarioBench] CapThrowStress: %d/%d launched, actor spawns %d, UObject delta %d -> %s"),
+				Launched, Throws, ActorSpawns, ObjectDelta,
+				(Launched == Throws && ActorSpawns == 0 && ObjectDelta == 0) ? TEXT("PASS") : TEXT("FAIL"));
+		});
+}
+#endif
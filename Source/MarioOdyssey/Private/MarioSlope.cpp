@@ -0,0 +1,157 @@
+#include "MarioSlope.h"
+
+#include "Components/PrimitiveComponent.h"
+
+float MarioSlope::CosSqFromDegrees(float Degrees)
+{
+	const float C = FMath::Cos(FMath::DegreesToRadians(FMath::Clamp(Degrees, 0.f, 90.f)));
+	return C * C;
+}
+
+FMarioSlopeEval MarioSlope::Evaluate(const FVector& FloorNormal, float MinSlopeCosSq)
+{
+	FMarioSlopeEval Out;
+
+	const float Nz = FloorNormal.Z;
+	const float HorizSq = FloorNormal.X * FloorNormal.X + FloorNormal.Y * FloorNormal.Y;
+
+	// 평지(수평 성분 없음) 또는 수직 벽(투영 결과 XY = 0)
+	if (HorizSq <= UE_SMALL_NUMBER || FMath::IsNearlyZero(Nz))
+	{
+		return Out;
+	}
+
+	// 경사각 >= Min  <=>  cos <= cosMin. 노멀이 정규화되지 않았어도 되도록 |N|^2로 스케일
+	Out.bSteepEnough = (Nz < 0.f) || (Nz * Nz <= MinSlopeCosSq * (HorizSq + Nz * Nz));
+
+	const float InvHoriz = FMath::InvSqrt(HorizSq) * (Nz > 0.f ? 1.f : -1.f);
+	Out.Downhill2D = FVector2D(FloorNormal.X * InvHoriz, FloorNormal.Y * InvHoriz);
+	Out.bHasDownhill = true;
+	return Out;
+}
+
+const FMarioSlopeEval& FMarioSlopeCache::Get(const FHitResult& FloorHit, float MinSlopeAngleDeg)
+{
+	++NumLookups;
+
+	if (MinSlopeAngleDeg != CachedMinSlopeAngleDeg)
+	{
+		CachedMinSlopeAngleDeg = MinSlopeAngleDeg;
+		MinSlopeCosSq = MarioSlope::CosSqFromDegrees(MinSlopeAngleDeg);
+		bValid = false;
+	}
+
+	// 움직이는/회전하는 발판은 같은 면이어도 노멀이 바뀌므로 노멀까지 키에 포함
+	const FVector& HitNormal = FloorHit.ImpactNormal;
+	if (bValid
+		&& FaceIndex == FloorHit.FaceIndex
+		&& Component == FloorHit.Component
+		&& Normal == HitNormal)
+	{
+		return Eval;
+	}
+
+	Component = FloorHit.Component;
+	FaceIndex = FloorHit.FaceIndex;
+	Normal = HitNormal;
+	Eval = MarioSlope::Evaluate(HitNormal, MinSlopeCosSq);
+	bValid = true;
+	++NumEvaluations;
+	return Eval;
+}
+
+#if !UE_BUILD_SHIPPING
+#include "Dev/MarioBenchCommand.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+
+namespace MarioSlopeBench
+{
+	// 이전 UpdateDownhillBoost의 Acos/투영/정규화 경로(MarioSlope::Evaluate 검증 기준)
+	static bool LegacySlopeIsRunningDownhill(const FVector& RawNormal, const FVector2D& Vel2D, float MinSlopeAngleDeg, float DotThreshold, bool& bOutHasDownhill)
+	{
+		const FVector FloorNormal = RawNormal.GetSafeNormal();
+		const float CosAngle = FVector::DotProduct(FloorNormal, FVector::UpVector);
+		const float SlopeAngleDeg = FMath::RadiansToDegrees(FMath::Acos(FMath::Clamp(CosAngle, -1.f, 1.f)));
+
+		FVector DownhillDir = -FVector::UpVector + CosAngle * FloorNormal;
+		FVector Downhill2D(DownhillDir.X, DownhillDir.Y, 0.f);
+		bOutHasDownhill = DownhillDir.Normalize() && Downhill2D.Normalize();
+		if (!bOutHasDownhill) return false;
+
+		const FVector VelDir = FVector(Vel2D.X, Vel2D.Y, 0.f).GetSafeNormal();
+		return SlopeAngleDeg >= MinSlopeAngleDeg && FVector::DotProduct(VelDir, Downhill2D) >= DotThreshold;
+	}
+
+	// 경사 평가 마이크로 벤치 + 이전 계산과의 일치 검사(기록된 노멀 대신 시드 고정 난수 노멀 사용)
+	static FMarioBenchCommand MarioBenchSlopeCommand(
+		TEXT("mario.BenchSlope"),
+		TEXT("내리막 경사 평가 마이크로 벤치. 인자: [반복 수=1000000] [같은 면 연속 프레임=30]"),
+		[](const TArray<FString>& Args, UWorld*)
+		{
+			const int32 Iterations = MarioBench::IntArg(Args, 0, 1000000);
+			const int32 FramesPerFace = MarioBench::IntArg(Args, 1, 30);
+			constexpr float MinSlopeAngleDeg = 12.f;
+			constexpr float DotThreshold = 0.55f;
+
+			FRandomStream Rng(1234);
+			TArray<FHitResult> Floors;
+			TArray<FVector2D> Vels;
+			Floors.SetNum(1024);
+			Vels.SetNum(1024);
+			for (int32 i = 0; i < Floors.Num(); ++i)
+			{
+				// 0~40도 바닥(평지 일부 포함)
+				const float Tilt = (i % 8 == 0) ? 0.f : Rng.FRandRange(0.f, 40.f);
+				const float Yaw = Rng.FRandRange(0.f, 360.f);
+				Floors[i].ImpactNormal = FRotator(Tilt, Yaw, 0.f).RotateVector(FVector::UpVector);
+				Floors[i].FaceIndex = i;
+				Vels[i] = FVector2D(Rng.FRandRange(-1.f, 1.f), Rng.FRandRange(-1.f, 1.f)) * 800.f;
+			}
+
+			int32 Mismatches = 0;
+			int32 LegacyHits = 0;
+			int32 NewHits = 0;
+
+			const uint64 LegacyStart = FPlatformTime::Cycles64();
+			for (int32 i = 0; i < Iterations; ++i)
+			{
+				const int32 Idx = (i / FramesPerFace) % Floors.Num();
+				bool bHas = false;
+				LegacyHits += LegacySlopeIsRunningDownhill(Floors[Idx].ImpactNormal, Vels[i % Vels.Num()], MinSlopeAngleDeg, DotThreshold, bHas) ? 1 : 0;
+			}
+			const uint64 LegacyCycles = FPlatformTime::Cycles64() - LegacyStart;
+
+			FMarioSlopeCache Cache;
+			const uint64 NewStart = FPlatformTime::Cycles64();
+			for (int32 i = 0; i < Iterations; ++i)
+			{
+				const int32 Idx = (i / FramesPerFace) % Floors.Num();
+				const FVector2D& Vel = Vels[i % Vels.Num()];
+				const FMarioSlopeEval& Eval = Cache.Get(Floors[Idx], MinSlopeAngleDeg);
+				NewHits += (Eval.bSteepEnough && MarioSlope::IsMovingDownhill(Eval, Vel, Vel.Size(), DotThreshold)) ? 1 : 0;
+			}
+			const uint64 NewCycles = FPlatformTime::Cycles64() - NewStart;
+
+			// 일치 검사(경계값 근처 부동소수 오차 허용을 위해 개수로 보고)
+			const float CosMinSq = MarioSlope::CosSqFromDegrees(MinSlopeAngleDeg);
+			for (int32 i = 0; i < Floors.Num(); ++i)
+			{
+				bool bLegacyHas = false;
+				const bool bLegacy = LegacySlopeIsRunningDownhill(Floors[i].ImpactNormal, Vels[i], MinSlopeAngleDeg, DotThreshold, bLegacyHas);
+				const FMarioSlopeEval Eval = MarioSlope::Evaluate(Floors[i].ImpactNormal, CosMinSq);
+				const bool bNew = Eval.bSteepEnough && MarioSlope::IsMovingDownhill(Eval, Vels[i], Vels[i].Size(), DotThreshold);
+				if (bLegacy != bNew || bLegacyHas != Eval.bHasDownhill)
+				{
+					++Mismatches;
+				}
+			}
+
+			UE_LOG(LogMarioBench, Display,
+				TEXT("[MarioBench] Slope x%d (face run %d): legacy %.2f ns/call, cached %.2f ns/call (%u evals), hits %d/%d, mismatches %d/%d"),
+				Iterations, FramesPerFace,
+				FPlatformTime::ToMilliseconds64(LegacyCycles) * 1e6 / Iterations, FPlatformTime::ToMilliseconds64(NewCycles) * 1e6 / Iterations, Cache.NumEvaluations,
+				LegacyHits, NewHits, Mismatches, Floors.Num());
+		});
+}
+#endif
@@ -1,11 +1,15 @@
 #include "UI/MarioPlayerController.h"
 
 #include "UI/MarioHUDWidget.h"
+#include "Camera/MarioPlayerCameraManager.h"
 #include "Progress/MarioGameInstance.h"
 #include "UObject/ConstructorHelpers.h"
 
 AMarioPlayerController::AMarioPlayerController()
 {
+	// 마리오/캡쳐 공용 카메라(고정 스텝 보간 + 충돌 프로브 예산)
+	PlayerCameraManagerClass = AMarioPlayerCameraManager::StaticClass();
+
 	// 기본 HUD 위젯: /Game/_BP/UI/WBP_HUD
 	static ConstructorHelpers::FClassFinder<UMarioHUDWidget> HudBP(TEXT("/Game/_BP/UI/WBP_HUD"));
 	if (HudBP.Succeeded())
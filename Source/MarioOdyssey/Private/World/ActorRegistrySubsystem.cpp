@@ -0,0 +1,223 @@
+#include "World/ActorRegistrySubsystem.h"
+
+#include "MarioOdyssey/MarioOdysseyStats.h"
+
+#include "Engine/Level.h"
+#include "Engine/World.h"
+
+UActorRegistrySubsystem* UActorRegistrySubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!WorldContextObject) return nullptr;
+
+	const UWorld* World = WorldContextObject->GetWorld();
+	return World ? World->GetSubsystem<UActorRegistrySubsystem>() : nullptr;
+}
+
+void UActorRegistrySubsystem::AutoRegister(AActor* Actor)
+{
+	if (UActorRegistrySubsystem* Registry = Get(Actor))
+	{
+		Registry->RegisterActor(Actor);
+	}
+}
+
+void UActorRegistrySubsystem::AutoUnregister(AActor* Actor)
+{
+	if (UActorRegistrySubsystem* Registry = Get(Actor))
+	{
+		Registry->UnregisterActor(Actor);
+	}
+}
+
+void UActorRegistrySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &UActorRegistrySubsystem::HandleLevelAddedToWorld);
+	LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &UActorRegistrySubsystem::HandleLevelRemovedFromWorld);
+}
+
+void UActorRegistrySubsystem::Deinitialize()
+{
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+	FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+
+	if (UWorld* World = GetWorld())
+	{
+		World->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+		World->RemoveOnActorDestroyededHandler(ActorDestroyedHandle);
+	}
+
+	ActorsByTag.Reset();
+	ActorsByClass.Reset();
+
+	Super::Deinitialize();
+}
+
+void UActorRegistrySubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// 레벨 배치 액터 태그는 시작 시 1회만 인덱싱(이후 조회는 태그 버킷만 확인)
+	for (ULevel* Level : InWorld.GetLevels())
+	{
+		IndexLevelTags(Level);
+	}
+
+	ActorSpawnedHandle = InWorld.AddOnActorSpawnedHandler(
+		FOnActorSpawned::FDelegate::CreateUObject(this, &UActorRegistrySubsystem::HandleActorSpawned));
+	ActorDestroyedHandle = InWorld.AddOnActorDestroyedHandler(
+		FOnActorDestroyed::FDelegate::CreateUObject(this, &UActorRegistrySubsystem::HandleActorDestroyed));
+}
+
+void UActorRegistrySubsystem::RegisterActor(AActor* Actor)
+{
+	if (!IsValid(Actor)) return;
+
+	bool bAlreadyRegistered = false;
+	ActorsByClass.FindOrAdd(Actor->GetClass()).Add(Actor, &bAlreadyRegistered);
+	if (bAlreadyRegistered)
+	{
+		return;
+	}
+
+	IndexTags(Actor);
+	OnRegisteredActorChanged.Broadcast(Actor, true);
+}
+
+void UActorRegistrySubsystem::UnregisterActor(AActor* Actor)
+{
+	if (!Actor) return;
+
+	bool bRemoved = false;
+	if (TSet<TWeakObjectPtr<AActor>>* Bucket = ActorsByClass.Find(Actor->GetClass()))
+	{
+		bRemoved = Bucket->Remove(Actor) > 0;
+	}
+
+	UnindexTags(Actor);
+
+	if (bRemoved)
+	{
+		OnRegisteredActorChanged.Broadcast(Actor, false);
+	}
+}
+
+void UActorRegistrySubsystem::GetActorsWithTag(FName Tag, TArray<AActor*>& OutActors) const
+{
+	const TSet<TWeakObjectPtr<AActor>>* Bucket = ActorsByTag.Find(Tag);
+	if (!Bucket) return;
+
+	OutActors.Reserve(OutActors.Num() + Bucket->Num());
+	for (const TWeakObjectPtr<AActor>& Weak : *Bucket)
+	{
+		AActor* A = Weak.Get();
+		// 런타임에 태그가 제거된 경우도 걸러낸다.
+		if (IsValid(A) && A->ActorHasTag(Tag))
+		{
+			OutActors.Add(A);
+		}
+	}
+}
+
+void UActorRegistrySubsystem::GetActorsOfClass(const UClass* Class, TArray<AActor*>& OutActors) const
+{
+	if (!Class) return;
+
+	for (const TPair<const UClass*, TSet<TWeakObjectPtr<AActor>>>& Pair : ActorsByClass)
+	{
+		if (!Pair.Key || !Pair.Key->IsChildOf(Class)) continue;
+
+		OutActors.Reserve(OutActors.Num() + Pair.Value.Num());
+		for (const TWeakObjectPtr<AActor>& Weak : Pair.Value)
+		{
+			AActor* A = Weak.Get();
+			if (IsValid(A))
+			{
+				OutActors.Add(A);
+			}
+		}
+	}
+}
+
+void UActorRegistrySubsystem::IndexTags(AActor* Actor)
+{
+	for (const FName& Tag : Actor->Tags)
+	{
+		if (Tag.IsNone()) continue;
+		ActorsByTag.FindOrAdd(Tag).Add(Actor);
+	}
+}
+
+void UActorRegistrySubsystem::UnindexTags(AActor* Actor)
+{
+	for (const FName& Tag : Actor->Tags)
+	{
+		if (TSet<TWeakObjectPtr<AActor>>* Bucket = ActorsByTag.Find(Tag))
+		{
+			Bucket->Remove(Actor);
+		}
+	}
+}
+
+void UActorRegistrySubsystem::IndexLevelTags(ULevel* Level)
+{
+	if (!Level) return;
+
+	for (AActor* Actor : Level->Actors)
+	{
+		if (IsValid(Actor) && Actor->Tags.Num() > 0)
+		{
+			IndexTags(Actor);
+		}
+	}
+}
+
+void UActorRegistrySubsystem::HandleActorSpawned(AActor* Actor)
+{
+	INC_DWORD_STAT(STAT_MarioOdyssey_ActorSpawns);
+
+	if (IsValid(Actor) && Actor->Tags.Num() > 0)
+	{
+		IndexTags(Actor);
+	}
+}
+
+void UActorRegistrySubsystem::HandleActorDestroyed(AActor* Actor)
+{
+	INC_DWORD_STAT(STAT_MarioOdyssey_ActorDestroys);
+
+	// 등록 액터는 EndPlay에서 이미 빠졌다. 태그로만 인덱싱된 배치/스폰 액터를 여기서 정리
+	if (Actor && Actor->Tags.Num() > 0)
+	{
+		UnindexTags(Actor);
+	}
+}
+
+void UActorRegistrySubsystem::HandleLevelAddedToWorld(ULevel* Level, UWorld* InWorld)
+{
+	if (InWorld != GetWorld()) return;
+	IndexLevelTags(Level);
+}
+
+void UActorRegistrySubsystem::HandleLevelRemovedFromWorld(ULevel* Level, UWorld* InWorld)
+{
+	if (InWorld != GetWorld()) return;
+
+	// Level이 nullptr이면 월드의 모든 레벨 제거
+	if (!Level)
+	{
+		ActorsByTag.Reset();
+		ActorsByClass.Reset();
+		return;
+	}
+
+	// 스트리밍 아웃되는 액터는 파괴 알림 없이 사라질 수 있으므로 레벨 단위로 정리
+	for (AActor* Actor : Level->Actors)
+	{
+		if (Actor)
+		{
+			UnregisterActor(Actor);
+		}
+	}
+}
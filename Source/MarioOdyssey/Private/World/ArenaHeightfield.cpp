@@ -0,0 +1,100 @@
+#include "World/ArenaHeightfield.h"
+
+#include "MarioSceneQuery.h"
+
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "GameFramework/Actor.h"
+
+void FArenaHeightfield::BeginBuild(UWorld* World, const FVector2D& Center, float Radius, float InCellSize, float TraceTopZ, float TraceBottomZ, const AActor* IgnoredActor)
+{
+	Reset();
+
+	if (!World || Radius <= 0.f || InCellSize <= KINDA_SMALL_NUMBER)
+	{
+		return;
+	}
+
+	CellSize = InCellSize;
+	Resolution = FMath::CeilToInt(2.f * Radius / CellSize) + 1;
+	Origin = Center - FVector2D(Radius, Radius);
+
+	BuildWorld = World;
+	BuildIgnoredActor = IgnoredActor;
+	BuildTopZ = TraceTopZ;
+	BuildBottomZ = TraceBottomZ;
+	NextSample = 0;
+
+	Heights.SetNumUninitialized(Resolution * Resolution);
+}
+
+bool FArenaHeightfield::StepBuild(double BudgetSeconds)
+{
+	UWorld* World = BuildWorld.Get();
+	if (!IsBuilding() || !World)
+	{
+		return IsBuilt();
+	}
+
+	// 최소 1개는 매번 진행(예산 0이어도 끝난다)
+	const double StartSeconds = FPlatformTime::Seconds();
+	do
+	{
+		TraceSample(World, NextSample++);
+	}
+	while (IsBuilding() && FPlatformTime::Seconds() - StartSeconds < BudgetSeconds);
+
+	return IsBuilt();
+}
+
+void FArenaHeightfield::TraceSample(UWorld* World, int32 Index)
+{
+	const FVector2D XY = Origin + FVector2D((Index % Resolution) * CellSize, (Index / Resolution) * CellSize);
+
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(ArenaHeightfieldBuild), false, BuildIgnoredActor.Get());
+	const FCollisionObjectQueryParams ObjectParams(ECC_WorldStatic);
+
+	FHitResult Hit;
+	const bool bHit = MarioSceneQuery::LineTraceSingleByObjectType(World, Hit, FVector(XY, BuildTopZ), FVector(XY, BuildBottomZ), ObjectParams, Params);
+	Heights[Index] = bHit ? Hit.ImpactPoint.Z : NoGround;
+}
+
+void FArenaHeightfield::Reset()
+{
+	Heights.Reset();
+	Resolution = 0;
+	CellSize = 0.f;
+	NextSample = 0;
+	BuildWorld.Reset();
+	BuildIgnoredActor.Reset();
+}
+
+bool FArenaHeightfield::SampleGroundZ(const FVector2D& WorldXY, float& OutZ) const
+{
+	if (!IsBuilt())
+	{
+		return false;
+	}
+
+	const FVector2D Local = (WorldXY - Origin) / CellSize;
+	const int32 X0 = FMath::FloorToInt(Local.X);
+	const int32 Y0 = FMath::FloorToInt(Local.Y);
+	if (X0 < 0 || Y0 < 0 || X0 + 1 >= Resolution || Y0 + 1 >= Resolution)
+	{
+		return false;
+	}
+
+	const float H00 = GetHeight(X0, Y0);
+	const float H10 = GetHeight(X0 + 1, Y0);
+	const float H01 = GetHeight(X0, Y0 + 1);
+	const float H11 = GetHeight(X0 + 1, Y0 + 1);
+	if (H00 == NoGround || H10 == NoGround || H01 == NoGround || H11 == NoGround)
+	{
+		return false;
+	}
+
+	const float FX = Local.X - X0;
+	const float FY = Local.Y - Y0;
+	OutZ = FMath::Lerp(FMath::Lerp(H00, H10, FX), FMath::Lerp(H01, H11, FX), FY);
+	return true;
+}
@@ -3,7 +3,6 @@
 #include "Components/AudioComponent.h"
 #include "Components/BoxComponent.h"
 #include "Engine/World.h"
-#include "EngineUtils.h"
 #include "Kismet/GameplayStatics.h"
 #include "TimerManager.h"
 
@@ -12,11 +11,20 @@
 #include "Character/Boss/AttrenashinFist.h"
 #include "Character/Boss/IceShardActor.h"
 #include "Character/Boss/IceTileActor.h"
+#include "Character/Boss/IceShardPoolSubsystem.h"
+#include "World/ActorRegistrySubsystem.h"
+#include "World/IceTileBatchComponent.h"
+#include "World/IceTileGridSubsystem.h"
+#include "Audio/BgmManager.h"
+#include "MarioOdyssey/MarioOdysseyStats.h"
+#include "MarioTimers.h"
 
 #include "LevelSequenceActor.h"
 #include "LevelSequencePlayer.h"
 #include "MovieSceneSequencePlayer.h"
 
+DEFINE_LOG_CATEGORY_STATIC(LogBossArena, Log, All);
+
 ABossArenaController::ABossArenaController()
 {
     PrimaryActorTick.bCanEverTick = true;
@@ -28,6 +36,13 @@ ABossArenaController::ABossArenaController()
     EncounterTrigger->SetCollisionResponseToAllChannels(ECR_Ignore);
     EncounterTrigger->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
     EncounterTrigger->SetGenerateOverlapEvents(true);
+
+    IceTileBatch = CreateDefaultSubobject<UIceTileBatchComponent>(TEXT("IceTileBatch"));
+    IceTileBatch->SetupAttachment(RootComponent);
+    // 인스턴스는 월드 좌표로 추가하므로 트리거 박스 이동/스케일을 따라가지 않게
+    IceTileBatch->SetUsingAbsoluteLocation(true);
+    IceTileBatch->SetUsingAbsoluteRotation(true);
+    IceTileBatch->SetUsingAbsoluteScale(true);
 }
 
 void ABossArenaController::BeginPlay()
@@ -39,8 +54,23 @@ void ABossArenaController::BeginPlay()
         EncounterTrigger->OnComponentBeginOverlap.AddDynamic(this, &ABossArenaController::OnEncounterTriggerBeginOverlap);
     }
 
+    // 묶음을 끈 아레나는 컴포넌트 BeginPlay에서 격자에 등록된 것을 해제(샤드가 타일 풀로 돌아감)
+    if (!bBatchIceTiles)
+    {
+        UIceTileGridSubsystem* Grid = UIceTileGridSubsystem::Get(this);
+        if (Grid && Grid->GetTileBatch() == IceTileBatch)
+        {
+            Grid->SetTileBatch(nullptr);
+        }
+    }
+
     CachedMario = Cast<AMarioCharacter>(UGameplayStatics::GetPlayerCharacter(this, 0));
 
+    // 바닥 격자는 여기서 시작만 하고 Tick에서 예산 내로 나눠 채운다(완료 전 주먹은 트레이스로 대체)
+    const float ArenaZ = bUseFixedBossSpawnTransform ? FixedBossSpawnLocation.Z : BossSpawnLocation.Z;
+    ArenaHeightfield.BeginBuild(GetWorld(), FVector2D::ZeroVector, ArenaHeightfieldRadius, ArenaHeightfieldCellSize,
+        ArenaZ + 8000.f, ArenaZ - 8000.f, this);
+
     CacheCutsceneProxyInitialTransforms();
     // 기본 대기 상태: 프록시 표시
     RestoreCutsceneProxyTransforms();
@@ -51,6 +81,21 @@ void ABossArenaController::Tick(float DeltaSeconds)
 {
     Super::Tick(DeltaSeconds);
 
+    // 정리 작업은 게임오버 대기 중에도 진행
+    if (ArenaReset.bActive)
+    {
+        StepArenaReset();
+    }
+
+    if (ArenaHeightfield.IsBuilding())
+    {
+        MARIO_SCOPE_CYCLE(STAT_MarioOdyssey_ArenaHeightfieldSlice);
+        if (ArenaHeightfield.StepBuild(FMath::Max(0.0f, ArenaHeightfieldBudgetMs) * 0.001))
+        {
+            UE_LOG(LogBossArena, Verbose, TEXT("[BossArena] Heightfield built (%d samples)"), ArenaHeightfield.GetNumSamples());
+        }
+    }
+
     const bool bMarioGameOver = CachedMario.IsValid() && CachedMario->IsGameOverPublic();
 
     // 사망 시점에 컷신/지연/보스 상태를 즉시 정리해서
@@ -133,7 +178,7 @@ void ABossArenaController::StartEncounterCutsceneWithDelay()
     }
 
     bWaitingForEncounterDelay = true;
-    World->GetTimerManager().SetTimer(
+    MarioTimers::Set(World->GetTimerManager(),
         EncounterDelayTimerHandle,
         this,
         &ABossArenaController::OnEncounterStartDelayElapsed,
@@ -182,11 +227,23 @@ void ABossArenaController::BeginEncounterCutscene()
 
     bIsCutscenePlaying = true;
 
-    // 컷신 직전: 기존 보스/주먹/샤드/타일 잔존물 제거
-    CleanupLiveBossActors();
+    // 컷신 직전: 기존 보스/주먹/샤드/타일 잔존물 제거 + 프록시 원위치 + 풀 프리웜을
+    // 프레임 예산 안에서 나눠 처리하고, 끝나면 컷신 시작
+    BeginArenaReset(/*bRestoreProxies=*/true, /*bPrewarmPool=*/true, [this]()
+    {
+        StartEncounterSequence();
+    });
+}
 
-    // 컷신 프록시를 원위치/가시화
-    RestoreCutsceneProxyTransforms();
+void ABossArenaController::StartEncounterSequence()
+{
+    // 정리 중 사망 등으로 취소된 경우
+    if (!bIsCutscenePlaying)
+    {
+        return;
+    }
+
+    // 컷신 프록시 가시화(원위치는 리셋 작업에서 끝남)
     SetCutsceneProxyVisible(true);
 
     // 컷신 시작 전 카메라 블렌드
@@ -256,6 +313,10 @@ void ABossArenaController::SpawnBossNow()
         BossActor = SpawnedBoss;
         LastHeadHitCount = SpawnedBoss->GetHeadHitCount();
         bBossDefeated = false;
+
+        // 첫 얼음비 전에 샤드/타일 풀 확보(전투 중 SpawnActor 히치 방지)
+        // 타일을 인스턴스로 묶으면 타일 액터는 만들지 않는다
+        SpawnedBoss->PrewarmIceShardPool(IceShardPoolPrewarmCount, bBatchIceTiles ? 0 : IceTilePoolPrewarmCount);
     }
 
     bWaitingForBossSpawn = false;
@@ -268,6 +329,12 @@ void ABossArenaController::UpdateBossProgress()
         return;
     }
 
+    // 페이즈가 바뀌면 스템 레이어만 페이드(재생은 이어짐)
+    if (bBossBGMStarted && BossBGMStems.Num() > 0 && BossActor->GetPhase() != LastBgmStemPhase)
+    {
+        ApplyBossBgmStemPhase(BossActor->GetPhase(), BossBGMStemFadeSeconds);
+    }
+
     const int32 CurrentHeadHits = BossActor->GetHeadHitCount();
     if (CurrentHeadHits != LastHeadHitCount)
     {
@@ -301,10 +368,9 @@ void ABossArenaController::HandleBossDefeated()
         EncounterCutsceneActor->GetSequencePlayer()->OnFinished.RemoveDynamic(this, &ABossArenaController::OnEncounterCutsceneFinished);
     }
 
-    CleanupLiveBossActors();
-
-    // 클리어 후 프록시는 기본적으로 숨김 유지
+    // 클리어 후 프록시는 기본적으로 숨김 유지. 잔존물은 프레임 분할로 정리
     SetCutsceneProxyVisible(false);
+    BeginArenaReset(/*bRestoreProxies=*/false, /*bPrewarmPool=*/false, nullptr);
 }
 
 void ABossArenaController::HandlePlayerEliminated()
@@ -324,61 +390,205 @@ void ABossArenaController::HandlePlayerEliminated()
         SeqPlayer->Stop();
     }
 
-    CleanupLiveBossActors();
-
     bHasEncounterStarted = false;
     bBossDefeated = false;
     LastHeadHitCount = 0;
 
-    RestoreCutsceneProxyTransforms();
-    SetCutsceneProxyVisible(true);
+    // 잔존물 정리/프록시 원복은 프레임 분할, 끝나면 프록시 표시
+    BeginArenaReset(/*bRestoreProxies=*/true, /*bPrewarmPool=*/false, [this]()
+    {
+        SetCutsceneProxyVisible(true);
+    });
 
     // 플레이어 쪽 카메라로 복귀(0초로 즉시)
     TransitionToPlayerCamera(0.0f);
 }
 
-void ABossArenaController::CleanupLiveBossActors()
+void ABossArenaController::BeginArenaReset(bool bRestoreProxies, bool bPrewarmPool, TFunction<void()> OnComplete)
 {
-    // 보스 본체 제거
+    // 진행 중인 작업이 있으면 남은 대상은 아래에서 다시 수집되므로 그대로 덮어쓴다
+    ArenaReset = FArenaResetJob();
+    ArenaReset.bActive = true;
+    ArenaReset.bRecyclePool = true;
+    ArenaReset.bClearTileBatch = IceTileBatch && IceTileBatch->GetNumTiles() > 0;
+    ArenaReset.bPrewarmPool = bPrewarmPool;
+    ArenaReset.OnComplete = MoveTemp(OnComplete);
+
+    // 보스 본체는 즉시 제거(페이즈 틱 함수가 다음 프레임까지 남지 않게)
     if (BossActor.IsValid())
     {
         BossActor->Destroy();
         BossActor.Reset();
     }
 
-    UWorld* World = GetWorld();
-    if (!World)
+    QueueLiveBossActors();
+
+    if (bRestoreProxies)
+    {
+        TArray<AActor*> AllProxies;
+        CollectAllProxyActors(AllProxies);
+
+        ArenaReset.PendingProxies.Reserve(AllProxies.Num());
+        for (AActor* Proxy : AllProxies)
+        {
+            ArenaReset.PendingProxies.Add(Proxy);
+        }
+    }
+
+    // 정리할 것이 적으면 이번 프레임 안에 끝나고 OnComplete까지 바로 호출된다
+    StepArenaReset();
+}
+
+void ABossArenaController::QueueLiveBossActors()
+{
+    UActorRegistrySubsystem* Registry = UActorRegistrySubsystem::Get(this);
+    if (!Registry)
     {
         return;
     }
 
-    // 잔존 주먹 제거(플레이어 사망 후 주먹이 남는 문제 해결)
-    for (TActorIterator<AAttrenashinFist> It(World); It; ++It)
+    // Destroy -> EndPlay에서 레지스트리 해제가 일어나므로 먼저 한 번에 수집한 뒤 정리
+    TArray<AActor*> LiveActors;
+
+    // 잔존 주먹 제거(플레이어 사망 후 주먹이 남는 문제 해결). 먼저 넣어 첫 프레임에 파괴
+    Registry->GetActorsOfClass(AAttrenashinFist::StaticClass(), LiveActors);
+
+    // 풀 소속 액터는 파괴하지 않고 풀로 회수(StepArenaReset)해 다음 시도에서 재사용한다.
+    TArray<AIceShardActor*> Shards;
+    Registry->GetActorsOfClass(Shards);
+    for (AIceShardActor* Shard : Shards)
     {
-        AAttrenashinFist* Fist = *It;
-        if (IsValid(Fist))
+        if (!Shard->IsPooled())
         {
-            Fist->Destroy();
+            LiveActors.Add(Shard);
         }
     }
 
-    // 전투 잔존 샤드/타일 정리(재도전 시 상태 리셋)
-    for (TActorIterator<AIceShardActor> It(World); It; ++It)
+    TArray<AIceTileActor*> Tiles;
+    Registry->GetActorsOfClass(Tiles);
+    for (AIceTileActor* Tile : Tiles)
     {
-        AIceShardActor* Shard = *It;
-        if (IsValid(Shard))
+        if (!Tile->IsPooled())
         {
-            Shard->Destroy();
+            LiveActors.Add(Tile);
         }
     }
 
-    for (TActorIterator<AIceTileActor> It(World); It; ++It)
+    ArenaReset.PendingDestroys.Reserve(LiveActors.Num());
+    for (AActor* Actor : LiveActors)
     {
-        AIceTileActor* Tile = *It;
-        if (IsValid(Tile))
+        if (!IsValid(Actor))
         {
-            Tile->Destroy();
+            continue;
         }
+
+        // 파괴 차례까지 보이지도/부딪히지도/틱하지도 않게(Destroy보다 훨씬 싸다)
+        Actor->SetActorHiddenInGame(true);
+        Actor->SetActorEnableCollision(false);
+        Actor->SetActorTickEnabled(false);
+        ArenaReset.PendingDestroys.Add(Actor);
+    }
+}
+
+void ABossArenaController::StepArenaReset()
+{
+    MARIO_SCOPE_CYCLE(STAT_MarioOdyssey_ArenaResetSlice);
+
+    const double StartSeconds = FPlatformTime::Seconds();
+    const double Deadline = StartSeconds + FMath::Max(0.0f, ArenaResetBudgetMs) * 0.001;
+    const int32 BatchSize = FMath::Max(1, ArenaResetBatchSize);
+    bool bDidWork = false;
+
+    // 예산이 0이어도 프레임마다 최소 1건은 처리
+    auto HasBudget = [&]()
+    {
+        return !bDidWork || FPlatformTime::Seconds() < Deadline;
+    };
+
+    UWorld* World = GetWorld();
+    UIceShardPoolSubsystem* Pool = World ? World->GetSubsystem<UIceShardPoolSubsystem>() : nullptr;
+    if (!Pool)
+    {
+        ArenaReset.bRecyclePool = false;
+        ArenaReset.bPrewarmPool = false;
+    }
+
+    // 1) 사용 중인 풀 샤드/타일 회수(숨김/충돌 off라 싸다)
+    while (ArenaReset.bRecyclePool && HasBudget())
+    {
+        ArenaReset.bRecyclePool = Pool->RecycleActive(BatchSize) > 0;
+        bDidWork = true;
+    }
+
+    // 2) 인스턴스 타일은 격자 기록과 함께 한 번에 제거
+    if (ArenaReset.bClearTileBatch && HasBudget())
+    {
+        if (IceTileBatch)
+        {
+            IceTileBatch->ClearTiles();
+        }
+        ArenaReset.bClearTileBatch = false;
+        bDidWork = true;
+    }
+
+    // 3) 풀 밖 잔존 액터 파괴
+    while (ArenaReset.DestroyIndex < ArenaReset.PendingDestroys.Num() && HasBudget())
+    {
+        if (AActor* Actor = ArenaReset.PendingDestroys[ArenaReset.DestroyIndex++].Get())
+        {
+            Actor->Destroy();
+            bDidWork = true;
+        }
+    }
+
+    // 4) 프록시 원위치
+    while (ArenaReset.ProxyIndex < ArenaReset.PendingProxies.Num() && HasBudget())
+    {
+        if (AActor* Proxy = ArenaReset.PendingProxies[ArenaReset.ProxyIndex++].Get())
+        {
+            RestoreCutsceneProxy(Proxy);
+            bDidWork = true;
+        }
+    }
+
+    // 5) 보스 스폰 전에 CDO 기준으로 풀 채우기(스폰 프레임의 SpawnActor 몰림 방지). 스폰이 가장 비싸므로 1개씩
+    if (ArenaReset.bPrewarmPool && HasBudget())
+    {
+        const AAttrenashinBoss* BossCDO = BossClass ? BossClass->GetDefaultObject<AAttrenashinBoss>() : nullptr;
+        ArenaReset.bPrewarmPool = BossCDO != nullptr;
+
+        const int32 TileCount = bBatchIceTiles ? 0 : IceTilePoolPrewarmCount;
+        while (ArenaReset.bPrewarmPool && HasBudget())
+        {
+            ArenaReset.bPrewarmPool = Pool->Prewarm(BossCDO->GetIceShardClass(), IceShardPoolPrewarmCount, BossCDO->GetIceTileClass(), TileCount, 1) > 0;
+            bDidWork = true;
+        }
+    }
+
+    ++ArenaReset.Frames;
+    ArenaReset.WorkSeconds += FPlatformTime::Seconds() - StartSeconds;
+
+    const bool bDone = !ArenaReset.bRecyclePool && !ArenaReset.bClearTileBatch && !ArenaReset.bPrewarmPool
+        && ArenaReset.DestroyIndex >= ArenaReset.PendingDestroys.Num()
+        && ArenaReset.ProxyIndex >= ArenaReset.PendingProxies.Num();
+    if (bDone)
+    {
+        FinishArenaReset();
+    }
+}
+
+void ABossArenaController::FinishArenaReset()
+{
+    UE_LOG(LogBossArena, Verbose, TEXT("[BossArena] Reset done: %d destroys, %d proxies, %d frames, %.3f ms total"),
+        ArenaReset.PendingDestroys.Num(), ArenaReset.PendingProxies.Num(), ArenaReset.Frames, ArenaReset.WorkSeconds * 1000.0);
+
+    // 콜백에서 새 리셋을 시작해도 안전하도록 먼저 비운다
+    TFunction<void()> OnComplete = MoveTemp(ArenaReset.OnComplete);
+    ArenaReset = FArenaResetJob();
+
+    if (OnComplete)
+    {
+        OnComplete();
     }
 }
 
@@ -499,43 +709,48 @@ void ABossArenaController::RestoreCutsceneProxyTransforms()
 
     for (AActor* Proxy : AllProxies)
     {
-        if (!IsValid(Proxy))
-        {
-            continue;
-        }
+        RestoreCutsceneProxy(Proxy);
+    }
+}
 
-        int32 CachedIndex = FindCachedProxyIndex(Proxy);
-        if (CachedIndex == INDEX_NONE)
-        {
-            // BeginPlay 이후 배열이 바뀌었거나 늦게 할당된 프록시를 안전하게 캐시에 편입
-            CutsceneProxyCachedActors.Add(Proxy);
-            CutsceneProxyInitialTransforms.Add(Proxy->GetActorTransform());
-            CutsceneProxyInitialHiddenStates.Add(Proxy->IsHidden());
-            CutsceneProxyInitialCollisionStates.Add(Proxy->GetActorEnableCollision());
-            CutsceneProxyInitialTickStates.Add(Proxy->IsActorTickEnabled());
-            CachedIndex = CutsceneProxyCachedActors.Num() - 1;
-        }
+void ABossArenaController::RestoreCutsceneProxy(AActor* Proxy)
+{
+    if (!IsValid(Proxy))
+    {
+        return;
+    }
 
-        // 1) 머리/손 프록시는 사용자 지정 고정 좌표/회전으로 항상 워프
-        const bool bWarpedToAuthored = WarpProxyToAuthoredTransform(Proxy);
+    int32 CachedIndex = FindCachedProxyIndex(Proxy);
+    if (CachedIndex == INDEX_NONE)
+    {
+        // BeginPlay 이후 배열이 바뀌었거나 늦게 할당된 프록시를 안전하게 캐시에 편입
+        CutsceneProxyCachedActors.Add(Proxy);
+        CutsceneProxyInitialTransforms.Add(Proxy->GetActorTransform());
+        CutsceneProxyInitialHiddenStates.Add(Proxy->IsHidden());
+        CutsceneProxyInitialCollisionStates.Add(Proxy->GetActorEnableCollision());
+        CutsceneProxyInitialTickStates.Add(Proxy->IsActorTickEnabled());
+        CachedIndex = CutsceneProxyCachedActors.Num() - 1;
+    }
 
-        // 2) 명시되지 않은 추가 프록시는 BeginPlay 당시 초기 트랜스폼으로 복원
-        if (!bWarpedToAuthored && CutsceneProxyInitialTransforms.IsValidIndex(CachedIndex))
-        {
-            const FTransform& T = CutsceneProxyInitialTransforms[CachedIndex];
-            Proxy->SetActorTransform(T, false, nullptr, ETeleportType::TeleportPhysics);
-        }
+    // 1) 머리/손 프록시는 사용자 지정 고정 좌표/회전으로 항상 워프
+    const bool bWarpedToAuthored = WarpProxyToAuthoredTransform(Proxy);
 
-        // 상태는 SetCutsceneProxyVisible()에서 최종 결정되므로 여기선 복원만 수행
-        if (CutsceneProxyInitialCollisionStates.IsValidIndex(CachedIndex) && !bEnableProxyCollisionWhenVisible)
-        {
-            Proxy->SetActorEnableCollision(CutsceneProxyInitialCollisionStates[CachedIndex]);
-        }
+    // 2) 명시되지 않은 추가 프록시는 BeginPlay 당시 초기 트랜스폼으로 복원
+    if (!bWarpedToAuthored && CutsceneProxyInitialTransforms.IsValidIndex(CachedIndex))
+    {
+        const FTransform& T = CutsceneProxyInitialTransforms[CachedIndex];
+        Proxy->SetActorTransform(T, false, nullptr, ETeleportType::TeleportPhysics);
+    }
 
-        if (CutsceneProxyInitialTickStates.IsValidIndex(CachedIndex))
-        {
-            Proxy->SetActorTickEnabled(CutsceneProxyInitialTickStates[CachedIndex]);
-        }
+    // 상태는 SetCutsceneProxyVisible()에서 최종 결정되므로 여기선 복원만 수행
+    if (CutsceneProxyInitialCollisionStates.IsValidIndex(CachedIndex) && !bEnableProxyCollisionWhenVisible)
+    {
+        Proxy->SetActorEnableCollision(CutsceneProxyInitialCollisionStates[CachedIndex]);
+    }
+
+    if (CutsceneProxyInitialTickStates.IsValidIndex(CachedIndex))
+    {
+        Proxy->SetActorTickEnabled(CutsceneProxyInitialTickStates[CachedIndex]);
     }
 }
 
@@ -570,7 +785,31 @@ void ABossArenaController::TransitionToPlayerCamera(float BlendSeconds)
 
 void ABossArenaController::StartBossBGMNative()
 {
-    if (bBossBGMStarted || !BossBattleBGM)
+    if (bBossBGMStarted)
+    {
+        return;
+    }
+
+    if (BossBGMStems.Num() > 0)
+    {
+        if (ABgmManager* Bgm = ResolveBgmManager())
+        {
+            TArray<USoundBase*> Sounds;
+            TArray<float> Volumes;
+            for (const FBossBgmStem& Stem : BossBGMStems)
+            {
+                Sounds.Add(Stem.Sound);
+                Volumes.Add(0.0f);
+            }
+
+            Bgm->PlayStems(Sounds, Volumes, BossBGMFadeInSeconds);
+            ApplyBossBgmStemPhase(GetBgmStemPhase(), BossBGMFadeInSeconds);
+            bBossBGMStarted = Bgm->IsPlayingStems();
+            return;
+        }
+    }
+
+    if (!BossBattleBGM)
     {
         return;
     }
@@ -602,6 +841,14 @@ void ABossArenaController::StartBossBGMNative()
 
 void ABossArenaController::StopBossBGMNative()
 {
+    if (ABgmManager* Bgm = CachedBgmManager.Get())
+    {
+        if (Bgm->IsPlayingStems())
+        {
+            Bgm->StopStems(BossBGMFadeOutSeconds);
+        }
+    }
+
     if (!BossBgmComp)
     {
         bBossBGMStarted = false;
@@ -619,3 +866,39 @@ void ABossArenaController::StopBossBGMNative()
 
     bBossBGMStarted = false;
 }
+
+ABgmManager* ABossArenaController::ResolveBgmManager()
+{
+    if (CachedBgmManager.IsValid())
+    {
+        return CachedBgmManager.Get();
+    }
+
+    // 레지스트리 조회라 매니저가 아직 없을 때 반복 호출돼도 월드 탐색은 일어나지 않는다
+    ABgmManager* M = ABgmManager::Get(this);
+    CachedBgmManager = M;
+    return M;
+}
+
+EAttrenashinPhase ABossArenaController::GetBgmStemPhase() const
+{
+    return BossActor.IsValid() ? BossActor->GetPhase() : EAttrenashinPhase::Phase0;
+}
+
+void ABossArenaController::ApplyBossBgmStemPhase(EAttrenashinPhase NewPhase, float FadeSeconds)
+{
+    LastBgmStemPhase = NewPhase;
+
+    ABgmManager* Bgm = CachedBgmManager.Get();
+    if (!Bgm || !Bgm->IsPlayingStems())
+    {
+        return;
+    }
+
+    for (int32 i = 0; i < BossBGMStems.Num(); ++i)
+    {
+        const FBossBgmStem& Stem = BossBGMStems[i];
+        const bool bAudible = static_cast<uint8>(NewPhase) >= static_cast<uint8>(Stem.FromPhase);
+        Bgm->SetStemVolume(i, bAudible ? Stem.Volume * BossBGMVolume : 0.0f, FadeSeconds);
+    }
+}
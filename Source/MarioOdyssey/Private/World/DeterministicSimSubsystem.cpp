@@ -0,0 +1,138 @@
+#include "World/DeterministicSimSubsystem.h"
+
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogDeterministicSim, Log, All);
+
+#if !UE_BUILD_SHIPPING
+namespace
+{
+	FAutoConsoleCommandWithWorldAndArgs DeterministicCommand(
+		TEXT("sim.Deterministic"),
+		TEXT("결정적 고정 스텝 모드(현재 월드). 인자: <0|1> [Seed] [StepHz] [Substeps]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			UDeterministicSimSubsystem* Sim = UDeterministicSimSubsystem::Get(World);
+			if (!Sim) return;
+
+			const bool bEnable = Args.Num() > 0 ? FCString::Atoi(*Args[0]) != 0 : !Sim->IsEnabled();
+			const int32 Seed = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : Sim->GetSeed();
+			const float StepHz = Args.Num() > 2 ? FCString::Atof(*Args[2]) : 1.f / Sim->GetFixedStep();
+			const int32 Substeps = Args.Num() > 3 ? FCString::Atoi(*Args[3]) : Sim->GetSubsteps();
+			Sim->SetDeterministic(bEnable, Seed, StepHz, Substeps);
+		}));
+}
+#endif
+
+UDeterministicSimSubsystem* UDeterministicSimSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UDeterministicSimSubsystem>() : nullptr;
+}
+
+void UDeterministicSimSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	bEnabled = FParse::Param(FCommandLine::Get(), TEXT("DeterministicSim"));
+	FParse::Value(FCommandLine::Get(), TEXT("SimSeed="), Seed);
+	FParse::Value(FCommandLine::Get(), TEXT("SimStepHz="), StepHz);
+	FParse::Value(FCommandLine::Get(), TEXT("SimSubsteps="), Substeps);
+	StepHz = FMath::Max(1.f, StepHz);
+	Substeps = FMath::Clamp(Substeps, 1, 16);
+
+	// 에디터 월드는 설정만 들고 엔진 타임스텝은 건드리지 않는다
+	const UWorld* World = GetWorld();
+	if (bEnabled && World && World->IsGameWorld())
+	{
+		ApplyEngineTimeStep();
+	}
+}
+
+void UDeterministicSimSubsystem::Deinitialize()
+{
+	RestoreEngineTimeStep();
+	Super::Deinitialize();
+}
+
+bool UDeterministicSimSubsystem::IsDeterministic(const UObject* WorldContextObject)
+{
+	const UDeterministicSimSubsystem* Sim = Get(WorldContextObject);
+	return Sim && Sim->IsEnabled();
+}
+
+void UDeterministicSimSubsystem::SetDeterministic(bool bEnable, int32 InSeed, float InStepHz, int32 InSubsteps)
+{
+	bEnabled = bEnable;
+	Seed = InSeed;
+	StepHz = FMath::Max(1.f, InStepHz);
+	Substeps = FMath::Clamp(InSubsteps, 1, 16);
+
+	if (bEnable)
+	{
+		ApplyEngineTimeStep();
+	}
+	else
+	{
+		RestoreEngineTimeStep();
+	}
+
+	UE_LOG(LogDeterministicSim, Display, TEXT("[DeterministicSim] %s seed=%d step=%.2fHz substeps=%d"),
+		bEnable ? TEXT("ON") : TEXT("OFF"), Seed, StepHz, Substeps);
+}
+
+void UDeterministicSimSubsystem::ApplyEngineTimeStep()
+{
+	if (!bAppliedToEngine)
+	{
+		bPrevUseFixedTimeStep = FApp::UseFixedTimeStep();
+		PrevFixedDeltaTime = FApp::GetFixedDeltaTime();
+		bAppliedToEngine = true;
+	}
+
+	FApp::SetUseFixedTimeStep(true);
+	FApp::SetFixedDeltaTime(1.0 / StepHz);
+}
+
+void UDeterministicSimSubsystem::RestoreEngineTimeStep()
+{
+	if (!bAppliedToEngine) return;
+
+	FApp::SetUseFixedTimeStep(bPrevUseFixedTimeStep);
+	FApp::SetFixedDeltaTime(PrevFixedDeltaTime);
+	bAppliedToEngine = false;
+}
+
+void UDeterministicSimSubsystem::InitRandomStream(const AActor* Actor, FRandomStream& OutStream, uint32 Salt)
+{
+	const UDeterministicSimSubsystem* Sim = Get(Actor);
+	if (!Sim || !Sim->IsEnabled())
+	{
+		OutStream.GenerateNewSeed();
+		return;
+	}
+
+	// 레벨에 배치된 액터는 저장된 이름을 그대로 쓰므로 스폰 순서와 무관한 시드가 된다.
+	// 런타임 스폰 액터는 이름 번호가 스폰 순서대로 붙으므로 같은 입력으로 같은 순서로 스폰될 때만 같은 시드
+	uint32 Hash = GetTypeHash(Sim->GetSeed());
+	Hash = HashCombine(Hash, GetTypeHash(Actor->GetName()));
+	Hash = HashCombine(Hash, Salt);
+
+	OutStream.Initialize(static_cast<int32>(Hash));
+}
+
+void UDeterministicSimSubsystem::ApplyToMovement(UCharacterMovementComponent* Move)
+{
+	const UDeterministicSimSubsystem* Sim = Move ? Get(Move) : nullptr;
+	if (!Sim || !Sim->IsEnabled()) return;
+
+	Move->MaxSimulationTimeStep = Sim->GetFixedStep() / Sim->GetSubsteps();
+	Move->MaxSimulationIterations = Sim->GetSubsteps();
+}
@@ -0,0 +1,286 @@
+#include "World/IceTileBatchComponent.h"
+
+#include "Character/Boss/IceTileActor.h"
+#include "MarioOdyssey/MarioOdysseyStats.h"
+
+#include "Components/BoxComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "PhysicsEngine/BodySetup.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogIceTileBatch, Log, All);
+
+UIceTileBatchComponent::UIceTileBatchComponent(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	PrimaryComponentTick.bCanEverTick = false;
+
+	// 런타임에 인스턴스를 추가/제거하므로 Movable
+	SetMobility(EComponentMobility::Movable);
+	SetCanEverAffectNavigation(false);
+
+	// AIceTileActor::Box와 같은 충돌 정책(보스/샤드/타일끼리 무시, Pawn Overlap, Visibility Block).
+	// 바디는 인스턴스마다 생기고 모양은 메시 단순 충돌(ValidateCollisionShape)
+	SetCollisionProfileName(TEXT("Boss_IceTile_Hazard"));
+	SetCollisionObjectType(ECC_WorldDynamic);
+	SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+	SetCollisionResponseToAllChannels(ECR_Ignore);
+	SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
+	SetCollisionResponseToChannel(ECC_Visibility, ECR_Block);
+	SetGenerateOverlapEvents(true);
+}
+
+void UIceTileBatchComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (UIceTileGridSubsystem* Grid = UIceTileGridSubsystem::Get(this))
+	{
+		Grid->SetTileBatch(this);
+	}
+}
+
+void UIceTileBatchComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	ClearTiles();
+
+	if (UIceTileGridSubsystem* Grid = UIceTileGridSubsystem::Get(this))
+	{
+		if (Grid->GetTileBatch() == this)
+		{
+			Grid->SetTileBatch(nullptr);
+		}
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UIceTileBatchComponent::ConfigureFromTileClass(TSubclassOf<AIceTileActor> TileClass)
+{
+	bConfiguredFromClass = true;
+
+	const AIceTileActor* TileCDO = TileClass ? TileClass->GetDefaultObject<AIceTileActor>() : nullptr;
+	if (!TileCDO)
+	{
+		return;
+	}
+
+	// 에디터에서 직접 지정한 값은 유지
+	const UBoxComponent* TileBox = TileCDO->GetTileBox();
+	const UStaticMeshComponent* TileMesh = TileCDO->GetTileMesh();
+
+	if (TileExtent.IsNearlyZero() && TileBox)
+	{
+		TileExtent = TileBox->GetUnscaledBoxExtent() * TileBox->GetRelativeScale3D();
+		TileExtentOffset = TileBox->GetRelativeLocation();
+	}
+
+	if (!GetStaticMesh() && TileMesh && TileMesh->GetStaticMesh())
+	{
+		SetStaticMesh(TileMesh->GetStaticMesh());
+		for (int32 i = 0; i < TileMesh->GetNumMaterials(); ++i)
+		{
+			SetMaterial(i, TileMesh->GetMaterial(i));
+		}
+
+		// 타일 Mesh는 Box 아래에 붙어 있다
+		TileMeshOffset = TileBox ? TileMesh->GetRelativeTransform() * TileBox->GetRelativeTransform() : TileMesh->GetRelativeTransform();
+	}
+
+	ValidateCollisionShape();
+}
+
+void UIceTileBatchComponent::ValidateCollisionShape() const
+{
+	const UStaticMesh* Mesh = GetStaticMesh();
+	const UBodySetup* BodySetup = Mesh ? Mesh->GetBodySetup() : nullptr;
+	if (!BodySetup || TileExtent.IsNearlyZero())
+	{
+		return;
+	}
+
+	// 메시 로컬 박스(전체 크기)를 인스턴스 스케일로 옮겨 타일 Box와 비교
+	const FKAggregateGeom& Geom = BodySetup->AggGeom;
+	const bool bSingleBox = Geom.BoxElems.Num() == 1 && Geom.GetElementCount() == 1;
+	if (bSingleBox)
+	{
+		const FKBoxElem& Elem = Geom.BoxElems[0];
+		const FVector MeshHalfExtent = FVector(Elem.X, Elem.Y, Elem.Z) * 0.5f * TileMeshOffset.GetScale3D().GetAbs();
+		if (MeshHalfExtent.Equals(TileExtent, 1.f))
+		{
+			return;
+		}
+	}
+
+	UE_LOG(LogIceTileBatch, Warning, TEXT("[IceTileBatch] %s: mesh simple collision (%d elems) does not match tile box extent %s; instance bodies will differ from the tile area"),
+		*GetNameSafe(Mesh), Geom.GetElementCount(), *TileExtent.ToString());
+}
+
+int32 UIceTileBatchComponent::AddTile(TSubclassOf<AIceTileActor> TileClass, const FVector& Location, const FRotator& Rotation)
+{
+	if (!bConfiguredFromClass)
+	{
+		ConfigureFromTileClass(TileClass);
+	}
+
+	const FTransform TileTransform(Rotation, Location);
+	const int32 Index = AddInstance(TileMeshOffset * TileTransform, /*bWorldSpace=*/true);
+	if (Index == INDEX_NONE)
+	{
+		return INDEX_NONE;
+	}
+
+	const FBox LocalBox(TileExtentOffset - TileExtent, TileExtentOffset + TileExtent);
+	const FBox WorldBox = TileExtent.IsNearlyZero()
+		? FBox(Location, Location)
+		: LocalBox.TransformBy(TileTransform);
+
+	FIceTileFootprint& Footprint = TileFootprints.AddDefaulted_GetRef();
+	if (UIceTileGridSubsystem* Grid = UIceTileGridSubsystem::Get(this))
+	{
+		Grid->AddFootprint(WorldBox, Footprint);
+	}
+
+	INC_DWORD_STAT(STAT_MarioOdyssey_IceTileInstanceAdds);
+	return Index;
+}
+
+void UIceTileBatchComponent::ClearTiles()
+{
+	if (UIceTileGridSubsystem* Grid = UIceTileGridSubsystem::Get(this))
+	{
+		for (FIceTileFootprint& Footprint : TileFootprints)
+		{
+			Grid->RemoveFootprint(Footprint);
+		}
+	}
+
+	TileFootprints.Reset();
+
+	if (GetInstanceCount() > 0)
+	{
+		ClearInstances();
+	}
+}
+
+#if !UE_BUILD_SHIPPING
+#include "MarioOdyssey/MarioCharacter.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "Dev/MarioBenchCommand.h"
+
+namespace IceTileBatchBench
+{
+	// 드로우 수 추정용 메시 LOD0 섹션 수(인스턴스 묶음은 섹션 수, 타일 액터는 액터 수 x 섹션 수로 어림). 실제 드로우 콜 측정 아님
+	static int32 NumMeshSections(const UStaticMesh* Mesh)
+	{
+		return Mesh ? FMath::Max(1, Mesh->GetNumSections(0)) : 0;
+	}
+
+	static int32 CountWorldActors(UWorld* World)
+	{
+		int32 Count = 0;
+		for (TActorIterator<AActor> It(World); It; ++It)
+		{
+			++Count;
+		}
+		return Count;
+	}
+
+	// 얼음 타일 1,000개 부하: 같은 위치 격자에 인스턴스 묶음 추가 vs 타일 액터 스폰을 비교
+	static FMarioBenchCommand MarioIceTileStressCommand(
+		TEXT("mario.IceTileStress"),
+		TEXT("얼음 타일 인스턴스 묶음 vs 타일 액터의 액터 수/추가 시간 비교(드로우 수는 LOD0 섹션 수 기반 추정치). 인자: [타일 수=1000] [타일 클래스 경로]"),
+		[](const TArray<FString>& Args, UWorld* World)
+		{
+			UIceTileGridSubsystem* Grid = UIceTileGridSubsystem::Get(World);
+			if (!Grid) return;
+
+			const int32 Tiles = MarioBench::IntArg(Args, 0, 1000);
+			TSubclassOf<AIceTileActor> TileClass = AIceTileActor::StaticClass();
+			if (Args.Num() > 1)
+			{
+				if (UClass* Loaded = LoadClass<AIceTileActor>(nullptr, *Args[1]))
+				{
+					TileClass = Loaded;
+				}
+			}
+
+			const AMarioCharacter* M = MarioBench::FindMario(World);
+			const FVector Center = M ? M->GetActorLocation() - FVector(0.f, 0.f, M->GetSimpleCollisionHalfHeight()) : FVector::ZeroVector;
+
+			const int32 Side = FMath::CeilToInt(FMath::Sqrt((float)Tiles));
+			const float Spacing = 120.f;
+			auto TileLocation = [&](int32 i)
+			{
+				return Center + FVector((i % Side - Side / 2) * Spacing, (i / Side - Side / 2) * Spacing, 0.f);
+			};
+
+			// 1) 인스턴스 묶음: 아레나 묶음을 건드리지 않도록 임시 액터에 따로 만든다
+			UIceTileBatchComponent* PrevBatch = Grid->GetTileBatch();
+			const int32 ActorsBefore = CountWorldActors(World);
+
+			FActorSpawnParameters Params;
+			Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+			AActor* BatchOwner = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, Params);
+			if (!BatchOwner) return;
+
+			UIceTileBatchComponent* Batch = NewObject<UIceTileBatchComponent>(BatchOwner, TEXT("IceTileStressBatch"));
+			BatchOwner->SetRootComponent(Batch);
+			Batch->RegisterComponent();
+
+			const uint64 BatchStart = FPlatformTime::Cycles64();
+			for (int32 i = 0; i < Tiles; ++i)
+			{
+				Batch->AddTile(TileClass, TileLocation(i), FRotator::ZeroRotator);
+			}
+			const double BatchMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - BatchStart);
+
+			if (!Batch->GetStaticMesh())
+			{
+				// 메시 없는 타일 클래스여도 섹션 수 추정이 되도록 기본 큐브 사용
+				Batch->SetStaticMesh(LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube")));
+			}
+
+			const int32 BatchActors = CountWorldActors(World) - ActorsBefore;
+			const int32 BatchDrawEstimate = NumMeshSections(Batch->GetStaticMesh());
+			const int32 BatchInstances = Batch->GetInstanceCount();
+			const int32 BatchCells = Grid->GetNumOccupiedCells();
+
+			BatchOwner->Destroy();
+			Grid->SetTileBatch(PrevBatch);
+
+			// 2) 타일 액터: 풀 없이 그대로 스폰(기존 방식의 최악 경우)
+			const UStaticMeshComponent* TileMeshComp = TileClass->GetDefaultObject<AIceTileActor>()->GetTileMesh();
+			const UStaticMesh* TileMesh = TileMeshComp ? TileMeshComp->GetStaticMesh() : nullptr;
+
+			TArray<AIceTileActor*> Spawned;
+			Spawned.Reserve(Tiles);
+
+			const uint64 ActorStart = FPlatformTime::Cycles64();
+			for (int32 i = 0; i < Tiles; ++i)
+			{
+				if (AIceTileActor* Tile = World->SpawnActor<AIceTileActor>(TileClass, TileLocation(i), FRotator::ZeroRotator, Params))
+				{
+					Spawned.Add(Tile);
+				}
+			}
+			const double ActorMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - ActorStart);
+
+			const int32 TileActors = CountWorldActors(World) - ActorsBefore;
+			const int32 TileDrawEstimate = Spawned.Num() * NumMeshSections(TileMesh ? TileMesh : Batch->GetStaticMesh());
+
+			for (AIceTileActor* Tile : Spawned)
+			{
+				Tile->Destroy();
+			}
+
+			UE_LOG(LogMarioBench, Display,
+				TEXT("[MarioBench] IceTileStress x%d (%s): batch %d instances, +%d actors, est. %d draws, %d grid cells, add %.3f ms | actors %d spawned, +%d actors, est. %d draws, spawn %.3f ms"),
+				Tiles, *GetNameSafe(TileClass.Get()),
+				BatchInstances, BatchActors, BatchDrawEstimate, BatchCells, BatchMs,
+				Spawned.Num(), TileActors, TileDrawEstimate, ActorMs);
+			UE_LOG(LogMarioBench, Display, TEXT("  est. draws = LOD0 mesh section count (batch) or tiles x sections (actors); not measured. Use stat scenerendering for real draw calls"));
+		});
+}
+#endif
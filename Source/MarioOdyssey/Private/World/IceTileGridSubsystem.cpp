@@ -0,0 +1,222 @@
+#include "World/IceTileGridSubsystem.h"
+
+#include "Character/Boss/IceTileActor.h"
+
+#include "Engine/Level.h"
+#include "Engine/World.h"
+
+namespace
+{
+	const FName IceTileTag(TEXT("IceTile"));
+
+	constexpr float NoTopZ = -MAX_flt;
+
+	// 음수 좌표도 내림 나눗셈
+	FORCEINLINE int32 FloorDiv(int32 Value, int32 Divisor)
+	{
+		return (Value >= 0) ? (Value / Divisor) : ((Value - Divisor + 1) / Divisor);
+	}
+}
+
+UIceTileGridSubsystem* UIceTileGridSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!WorldContextObject) return nullptr;
+
+	const UWorld* World = WorldContextObject->GetWorld();
+	return World ? World->GetSubsystem<UIceTileGridSubsystem>() : nullptr;
+}
+
+void UIceTileGridSubsystem::Deinitialize()
+{
+	Chunks.Reset();
+	StackedTopZ.Reset();
+	NumOccupiedCells = 0;
+	TileBatch.Reset();
+
+	Super::Deinitialize();
+}
+
+void UIceTileGridSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// AIceTileActor는 스스로 기록한다. 여기서는 태그만 붙은 배치 액터(얼음 바닥 등)를 1회 기록
+	for (ULevel* Level : InWorld.GetLevels())
+	{
+		IndexTaggedActors(Level);
+	}
+}
+
+void UIceTileGridSubsystem::IndexTaggedActors(ULevel* Level)
+{
+	if (!Level) return;
+
+	for (AActor* Actor : Level->Actors)
+	{
+		if (!IsValid(Actor) || Actor->IsA<AIceTileActor>() || !Actor->ActorHasTag(IceTileTag))
+		{
+			continue;
+		}
+
+		FIceTileFootprint Footprint;
+		AddFootprint(Actor->GetComponentsBoundingBox(), Footprint);
+	}
+}
+
+FIntPoint UIceTileGridSubsystem::ToCell(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize));
+}
+
+FIntPoint UIceTileGridSubsystem::ToChunk(const FIntPoint& Cell, int32& OutIndex)
+{
+	const FIntPoint Chunk(FloorDiv(Cell.X, ChunkDim), FloorDiv(Cell.Y, ChunkDim));
+	OutIndex = (Cell.Y - Chunk.Y * ChunkDim) * ChunkDim + (Cell.X - Chunk.X * ChunkDim);
+	return Chunk;
+}
+
+void UIceTileGridSubsystem::AddFootprint(const FBox& Bounds, FIceTileFootprint& InOutFootprint)
+{
+	RemoveFootprint(InOutFootprint);
+
+	if (!Bounds.IsValid)
+	{
+		return;
+	}
+
+	// 셀 중심이 영역 안에 있는 셀만(타일 가장자리 밖으로 번지지 않게). 셀보다 작은 영역은 중심 셀 1개
+	FIntPoint MinCell(FMath::CeilToInt(Bounds.Min.X / CellSize - 0.5f), FMath::CeilToInt(Bounds.Min.Y / CellSize - 0.5f));
+	FIntPoint MaxCell(FMath::FloorToInt(Bounds.Max.X / CellSize - 0.5f), FMath::FloorToInt(Bounds.Max.Y / CellSize - 0.5f));
+
+	const FIntPoint CenterCell = ToCell(Bounds.GetCenter());
+	if (MinCell.X > MaxCell.X)
+	{
+		MinCell.X = MaxCell.X = CenterCell.X;
+	}
+	if (MinCell.Y > MaxCell.Y)
+	{
+		MinCell.Y = MaxCell.Y = CenterCell.Y;
+	}
+
+	const float TopZ = Bounds.Max.Z;
+	for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+	{
+		for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+		{
+			int32 Index = 0;
+			TUniquePtr<FChunk>& Chunk = Chunks.FindOrAdd(ToChunk(FIntPoint(X, Y), Index));
+			if (!Chunk)
+			{
+				Chunk = MakeUnique<FChunk>();
+			}
+
+			const uint16 PrevCount = Chunk->Counts[Index]++;
+			if (PrevCount == 0)
+			{
+				Chunk->TopZ[Index] = TopZ;
+				++NumOccupiedCells;
+				continue;
+			}
+
+			// 겹친 셀: 1 -> 2개가 될 때 기존 타일 윗면부터 기록
+			TArray<float, TInlineAllocator<4>>& Stack = StackedTopZ.FindOrAdd(FIntPoint(X, Y));
+			if (PrevCount == 1)
+			{
+				Stack.Reset();
+				Stack.Add(Chunk->TopZ[Index]);
+			}
+			Stack.Add(TopZ);
+			Chunk->TopZ[Index] = FMath::Max(Chunk->TopZ[Index], TopZ);
+		}
+	}
+
+	InOutFootprint.MinCell = MinCell;
+	InOutFootprint.MaxCell = MaxCell;
+	InOutFootprint.TopZ = TopZ;
+	InOutFootprint.bRegistered = true;
+}
+
+void UIceTileGridSubsystem::RemoveFootprint(FIceTileFootprint& InOutFootprint)
+{
+	if (!InOutFootprint.bRegistered)
+	{
+		return;
+	}
+	InOutFootprint.bRegistered = false;
+
+	for (int32 Y = InOutFootprint.MinCell.Y; Y <= InOutFootprint.MaxCell.Y; ++Y)
+	{
+		for (int32 X = InOutFootprint.MinCell.X; X <= InOutFootprint.MaxCell.X; ++X)
+		{
+			int32 Index = 0;
+			TUniquePtr<FChunk>* Chunk = Chunks.Find(ToChunk(FIntPoint(X, Y), Index));
+			if (!Chunk || (*Chunk)->Counts[Index] == 0)
+			{
+				continue;
+			}
+
+			const uint16 NewCount = --(*Chunk)->Counts[Index];
+			if (NewCount == 0)
+			{
+				(*Chunk)->TopZ[Index] = NoTopZ;
+				--NumOccupiedCells;
+				continue;
+			}
+
+			// 남은 타일 윗면 중 최대값으로 낮춘다(가장 높은 타일이 빠졌을 때 없는 면이 남지 않게)
+			const FIntPoint Cell(X, Y);
+			TArray<float, TInlineAllocator<4>>* Stack = StackedTopZ.Find(Cell);
+			if (!Stack)
+			{
+				continue;
+			}
+
+			const int32 StackIndex = Stack->IndexOfByKey(InOutFootprint.TopZ);
+			if (StackIndex != INDEX_NONE)
+			{
+				Stack->RemoveAtSwap(StackIndex, 1, EAllowShrinking::No);
+			}
+
+			if (Stack->Num() > 0)
+			{
+				float NewTopZ = NoTopZ;
+				for (const float Z : *Stack)
+				{
+					NewTopZ = FMath::Max(NewTopZ, Z);
+				}
+				(*Chunk)->TopZ[Index] = NewTopZ;
+			}
+
+			if (NewCount == 1)
+			{
+				StackedTopZ.Remove(Cell);
+			}
+		}
+	}
+}
+
+bool UIceTileGridSubsystem::IsIceAt(const FVector& Location, float Radius, float ZTolerance) const
+{
+	if (NumOccupiedCells == 0)
+	{
+		return false;
+	}
+
+	const FVector Extent(FMath::Max(0.f, Radius), FMath::Max(0.f, Radius), 0.f);
+	const FIntPoint MinCell = ToCell(Location - Extent);
+	const FIntPoint MaxCell = ToCell(Location + Extent);
+
+	for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+	{
+		for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+		{
+			int32 Index = 0;
+			const TUniquePtr<FChunk>* Chunk = Chunks.Find(ToChunk(FIntPoint(X, Y), Index));
+			if (Chunk && (*Chunk)->Counts[Index] > 0 && FMath::Abs((*Chunk)->TopZ[Index] - Location.Z) <= ZTolerance)
+			{
+				return true;
+			}
+		}
+	}
+	return false;
+}
@@ -6,6 +6,7 @@
 #include "Engine/World.h"
 
 #include "Character/Monster/BulletBillCharacter.h"
+#include "MarioTimers.h"
 
 ABulletBillLauncher::ABulletBillLauncher()
 {
@@ -33,7 +34,7 @@ void ABulletBillLauncher::StartSpawning()
 	if (!GetWorld()) return;
 
 	GetWorld()->GetTimerManager().ClearTimer(SpawnTimer);
-	GetWorld()->GetTimerManager().SetTimer(SpawnTimer, this, &ABulletBillLauncher::HandleSpawnTick, SpawnInterval, true, 0.f);
+	MarioTimers::Set(GetWorld()->GetTimerManager(), SpawnTimer, this, &ABulletBillLauncher::HandleSpawnTick, SpawnInterval, true, 0.f);
 }
 
 void ABulletBillLauncher::StopSpawning()
@@ -0,0 +1,507 @@
+#include "World/LedgeEdgeSubsystem.h"
+
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/Level.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "PhysicsEngine/BodySetup.h"
+
+namespace
+{
+	// 윗면이 이 이상 위를 향해야 모서리로 인정(약 18도 기울기까지)
+	constexpr float MinTopUpZ = 0.95f;
+
+	// 이보다 짧은 모서리는 매달릴 폭이 안 된다
+	constexpr float MinEdgeLength = 40.f;
+
+	// 박스 윗면(+Z) 네 모서리(순서대로 이으면 둘레)
+	void AppendBoxTopEdges(const FTransform& ElemTransform, const FVector& HalfExtent, TArray<FVector>& OutCorners)
+	{
+		const FVector H = HalfExtent;
+		OutCorners.Add(ElemTransform.TransformPosition(FVector( H.X,  H.Y, H.Z)));
+		OutCorners.Add(ElemTransform.TransformPosition(FVector( H.X, -H.Y, H.Z)));
+		OutCorners.Add(ElemTransform.TransformPosition(FVector(-H.X, -H.Y, H.Z)));
+		OutCorners.Add(ElemTransform.TransformPosition(FVector(-H.X,  H.Y, H.Z)));
+	}
+}
+
+ULedgeEdgeSubsystem* ULedgeEdgeSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!WorldContextObject) return nullptr;
+
+	const UWorld* World = WorldContextObject->GetWorld();
+	return World ? World->GetSubsystem<ULedgeEdgeSubsystem>() : nullptr;
+}
+
+void ULedgeEdgeSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &ULedgeEdgeSubsystem::HandleLevelAddedToWorld);
+	LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &ULedgeEdgeSubsystem::HandleLevelRemovedFromWorld);
+}
+
+void ULedgeEdgeSubsystem::Deinitialize()
+{
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+	FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+
+	if (UWorld* World = GetWorld())
+	{
+		World->RemoveOnActorDestroyededHandler(ActorDestroyedHandle);
+	}
+
+	Edges.Reset();
+	Cells.Reset();
+	OversizedEdges.Reset();
+	FreeEdges.Reset();
+	LocalEdgesByMesh.Reset();
+	EdgesByComponent.Reset();
+
+	Super::Deinitialize();
+}
+
+void ULedgeEdgeSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	ActorDestroyedHandle = InWorld.AddOnActorDestroyedHandler(
+		FOnActorDestroyed::FDelegate::CreateUObject(this, &ULedgeEdgeSubsystem::HandleActorDestroyed));
+
+	// 배치된 정적 지형은 시작 시 1회만 펼친다(이후 탐지는 격자 조회만)
+	for (ULevel* Level : InWorld.GetLevels())
+	{
+		IndexLevel(Level);
+	}
+}
+
+bool ULedgeEdgeSubsystem::FindGrabEdge(const FLedgeGrabQuery& Query, FLedgeGrabResult& OutResult) const
+{
+	if (Edges.Num() == 0)
+	{
+		return false;
+	}
+
+	FVector Facing = Query.Facing;
+	Facing.Z = 0.f;
+	Facing = Facing.GetSafeNormal();
+
+	const float MinZ = Query.Hand.Z - Query.Below;
+	const float MaxZ = Query.Hand.Z + Query.Above;
+	const float ReachSq = FMath::Square(Query.Reach);
+
+	float BestDistSq = TNumericLimits<float>::Max();
+	bool bFound = false;
+
+	auto TestEdge = [&](int32 EdgeIndex)
+	{
+		const FLedgeEdge& Edge = Edges[EdgeIndex];
+
+		const float EdgeZ = Edge.Start.Z;
+		if (EdgeZ < MinZ || EdgeZ > MaxZ)
+		{
+			return;
+		}
+
+		const FVector Normal(Edge.Normal);
+		if (!Facing.IsZero() && FVector::DotProduct(Facing, -Normal) < Query.MinFacingDot)
+		{
+			return;
+		}
+
+		const FVector Start(Edge.Start);
+		const FVector Delta = FVector(Edge.End) - Start;
+		const float Length = Delta.Size();
+		if (Length < Query.EndMargin * 2.f)
+		{
+			return;
+		}
+
+		const FVector Tangent = Delta / Length;
+		const float Param = FMath::Clamp(FVector::DotProduct(Query.Hand - Start, Tangent), Query.EndMargin, Length - Query.EndMargin);
+
+		FVector ToHand = Query.Hand - (Start + Tangent * Param);
+		ToHand.Z = 0.f;
+
+		const float DistSq = ToHand.SizeSquared();
+		if (DistSq > ReachSq || DistSq >= BestDistSq)
+		{
+			return;
+		}
+
+		BestDistSq = DistSq;
+		bFound = true;
+
+		OutResult.Origin = Start;
+		OutResult.Tangent = Tangent;
+		OutResult.Normal = Normal;
+		OutResult.Length = Length;
+		OutResult.Param = Param;
+	};
+
+	// 셀 경계에 걸친 모서리는 여러 셀에서 중복으로 나올 수 있지만 최단 거리 갱신만 하므로 무해
+	const FIntPoint Min = ToCell(Query.Hand - FVector(Query.Reach));
+	const FIntPoint Max = ToCell(Query.Hand + FVector(Query.Reach));
+	for (int32 X = Min.X; X <= Max.X; ++X)
+	{
+		for (int32 Y = Min.Y; Y <= Max.Y; ++Y)
+		{
+			if (const TArray<int32>* Bucket = Cells.Find(FIntPoint(X, Y)))
+			{
+				for (const int32 EdgeIndex : *Bucket)
+				{
+					TestEdge(EdgeIndex);
+				}
+			}
+		}
+	}
+
+	for (const int32 EdgeIndex : OversizedEdges)
+	{
+		TestEdge(EdgeIndex);
+	}
+
+	return bFound;
+}
+
+void ULedgeEdgeSubsystem::RegisterComponent(UStaticMeshComponent* Component)
+{
+	if (!IsValid(Component) || Component->Mobility != EComponentMobility::Static)
+	{
+		return;
+	}
+
+	if (!Component->IsCollisionEnabled() || Component->GetCollisionResponseToChannel(ECC_Pawn) != ECR_Block)
+	{
+		return;
+	}
+
+	UStaticMesh* Mesh = Component->GetStaticMesh();
+	if (!Mesh)
+	{
+		return;
+	}
+
+	if (EdgesByComponent.Contains(Component))
+	{
+		return;
+	}
+
+	// 모서리가 없어도 키는 남겨 중복 등록을 막는다
+	TArray<int32>& EdgeIndices = EdgesByComponent.Add(Component);
+
+	const TArray<FLocalEdge>& LocalEdges = GetLocalEdges(Mesh);
+	if (LocalEdges.Num() == 0)
+	{
+		return;
+	}
+
+	if (const UInstancedStaticMeshComponent* Instanced = Cast<UInstancedStaticMeshComponent>(Component))
+	{
+		const int32 NumInstances = Instanced->GetInstanceCount();
+		for (int32 i = 0; i < NumInstances; ++i)
+		{
+			FTransform InstanceTransform;
+			if (Instanced->GetInstanceTransform(i, InstanceTransform, true))
+			{
+				AddWorldEdges(LocalEdges, InstanceTransform, EdgeIndices);
+			}
+		}
+		return;
+	}
+
+	AddWorldEdges(LocalEdges, Component->GetComponentTransform(), EdgeIndices);
+}
+
+void ULedgeEdgeSubsystem::UnregisterComponent(UStaticMeshComponent* Component)
+{
+	TArray<int32> EdgeIndices;
+	if (!EdgesByComponent.RemoveAndCopyValue(Component, EdgeIndices))
+	{
+		return;
+	}
+
+	for (const int32 EdgeIndex : EdgeIndices)
+	{
+		RemoveEdge(EdgeIndex);
+	}
+}
+
+const TArray<ULedgeEdgeSubsystem::FLocalEdge>& ULedgeEdgeSubsystem::GetLocalEdges(UStaticMesh* Mesh)
+{
+	if (const TArray<FLocalEdge>* Cached = LocalEdgesByMesh.Find(Mesh))
+	{
+		return *Cached;
+	}
+
+	// 렌더 삼각형은 쿠킹 빌드에서 CPU 접근이 안 되므로 심플 콜리전 박스로 근사한다
+	TArray<FVector> Corners;
+	TArray<FVector> Ups;
+
+	auto AddBox = [&Corners, &Ups](const FTransform& ElemTransform, const FVector& HalfExtent)
+	{
+		AppendBoxTopEdges(ElemTransform, HalfExtent, Corners);
+		Ups.Add(ElemTransform.TransformVectorNoScale(FVector::UpVector));
+	};
+
+	if (const UBodySetup* BodySetup = Mesh->GetBodySetup())
+	{
+		for (const FKBoxElem& Box : BodySetup->AggGeom.BoxElems)
+		{
+			AddBox(FTransform(Box.Rotation, Box.Center), FVector(Box.X, Box.Y, Box.Z) * 0.5f);
+		}
+
+		for (const FKConvexElem& Convex : BodySetup->AggGeom.ConvexElems)
+		{
+			if (Convex.ElemBox.IsValid)
+			{
+				AddBox(FTransform(Convex.ElemBox.GetCenter()) * Convex.GetTransform(), Convex.ElemBox.GetExtent());
+			}
+		}
+	}
+
+	// 심플 콜리전이 없으면(복합 콜리전 전용) 메시 바운드 상자
+	if (Ups.Num() == 0)
+	{
+		const FBox Bounds = Mesh->GetBoundingBox();
+		if (Bounds.IsValid)
+		{
+			AddBox(FTransform(Bounds.GetCenter()), Bounds.GetExtent());
+		}
+	}
+
+	TArray<FLocalEdge>& LocalEdges = LocalEdgesByMesh.Add(Mesh);
+	LocalEdges.Reserve(Ups.Num() * 4);
+
+	for (int32 BoxIndex = 0; BoxIndex < Ups.Num(); ++BoxIndex)
+	{
+		const FVector* C = &Corners[BoxIndex * 4];
+		const FVector Center = (C[0] + C[1] + C[2] + C[3]) * 0.25f;
+
+		for (int32 i = 0; i < 4; ++i)
+		{
+			FLocalEdge& Edge = LocalEdges.AddDefaulted_GetRef();
+			Edge.Start = C[i];
+			Edge.End = C[(i + 1) % 4];
+			Edge.FaceCenter = Center;
+			Edge.Up = Ups[BoxIndex];
+		}
+	}
+
+	return LocalEdges;
+}
+
+void ULedgeEdgeSubsystem::AddWorldEdges(const TArray<FLocalEdge>& LocalEdges, const FTransform& Transform, TArray<int32>& OutEdgeIndices)
+{
+	for (const FLocalEdge& Local : LocalEdges)
+	{
+		// 뒤집히거나 기울어진 면의 모서리는 매달릴 수 없다
+		if (Transform.TransformVectorNoScale(Local.Up).Z < MinTopUpZ)
+		{
+			continue;
+		}
+
+		const FVector Start = Transform.TransformPosition(Local.Start);
+		const FVector End = Transform.TransformPosition(Local.End);
+		if (FVector::DistSquared(Start, End) < FMath::Square(MinEdgeLength))
+		{
+			continue;
+		}
+
+		// 바깥 노멀 = 윗면 중심 -> 변 중점 방향에서 변 방향 성분 제거
+		// (월드 점으로 계산해서 비균등/음수 스케일에서도 방향이 맞다)
+		const FVector Tangent = (End - Start).GetSafeNormal();
+		FVector Normal = (Start + End) * 0.5f - Transform.TransformPosition(Local.FaceCenter);
+		Normal -= Tangent * FVector::DotProduct(Normal, Tangent);
+		Normal.Z = 0.f;
+		if (!Normal.Normalize())
+		{
+			continue;
+		}
+
+		// 높이는 두 끝점 평균으로 맞춰 수평 선분으로 저장
+		const float Z = (Start.Z + End.Z) * 0.5f;
+
+		FLedgeEdge Edge;
+		Edge.Start = FVector3f(Start.X, Start.Y, Z);
+		Edge.End = FVector3f(End.X, End.Y, Z);
+		Edge.Normal = FVector3f(Normal);
+		OutEdgeIndices.Add(AddEdge(Edge));
+	}
+}
+
+int32 ULedgeEdgeSubsystem::AddEdge(const FLedgeEdge& Edge)
+{
+	int32 EdgeIndex;
+	if (FreeEdges.Num() > 0)
+	{
+		EdgeIndex = FreeEdges.Pop(EAllowShrinking::No);
+		Edges[EdgeIndex] = Edge;
+	}
+	else
+	{
+		EdgeIndex = Edges.Add(Edge);
+	}
+
+	FIntPoint Min, Max;
+	GetCellRange(Edge, Min, Max);
+
+	const int64 CellCount = int64(Max.X - Min.X + 1) * int64(Max.Y - Min.Y + 1);
+	if (CellCount > MaxCellsPerEdge)
+	{
+		OversizedEdges.Add(EdgeIndex);
+		return EdgeIndex;
+	}
+
+	for (int32 X = Min.X; X <= Max.X; ++X)
+	{
+		for (int32 Y = Min.Y; Y <= Max.Y; ++Y)
+		{
+			Cells.FindOrAdd(FIntPoint(X, Y)).Add(EdgeIndex);
+		}
+	}
+
+	return EdgeIndex;
+}
+
+void ULedgeEdgeSubsystem::RemoveEdge(int32 EdgeIndex)
+{
+	FIntPoint Min, Max;
+	GetCellRange(Edges[EdgeIndex], Min, Max);
+
+	const int64 CellCount = int64(Max.X - Min.X + 1) * int64(Max.Y - Min.Y + 1);
+	if (CellCount > MaxCellsPerEdge)
+	{
+		OversizedEdges.RemoveSingleSwap(EdgeIndex, EAllowShrinking::No);
+	}
+	else
+	{
+		for (int32 X = Min.X; X <= Max.X; ++X)
+		{
+			for (int32 Y = Min.Y; Y <= Max.Y; ++Y)
+			{
+				const FIntPoint Cell(X, Y);
+				TArray<int32>* Bucket = Cells.Find(Cell);
+				if (!Bucket) continue;
+
+				Bucket->RemoveSingleSwap(EdgeIndex, EAllowShrinking::No);
+				if (Bucket->Num() == 0)
+				{
+					Cells.Remove(Cell);
+				}
+			}
+		}
+	}
+
+	// 다른 컴포넌트의 인덱스가 밀리지 않게 슬롯은 비워 두고 재사용
+	Edges[EdgeIndex] = FLedgeEdge();
+	FreeEdges.Add(EdgeIndex);
+}
+
+void ULedgeEdgeSubsystem::GetCellRange(const FLedgeEdge& Edge, FIntPoint& OutMin, FIntPoint& OutMax) const
+{
+	const FIntPoint A = ToCell(FVector(Edge.Start));
+	const FIntPoint B = ToCell(FVector(Edge.End));
+	OutMin = FIntPoint(FMath::Min(A.X, B.X), FMath::Min(A.Y, B.Y));
+	OutMax = FIntPoint(FMath::Max(A.X, B.X), FMath::Max(A.Y, B.Y));
+}
+
+void ULedgeEdgeSubsystem::IndexLevel(ULevel* Level)
+{
+	if (!Level) return;
+
+	for (AActor* Actor : Level->Actors)
+	{
+		if (!IsValid(Actor)) continue;
+
+		Actor->ForEachComponent<UStaticMeshComponent>(false, [this](UStaticMeshComponent* Component)
+		{
+			RegisterComponent(Component);
+		});
+	}
+}
+
+void ULedgeEdgeSubsystem::RebuildAll(const ULevel* ExcludedLevel)
+{
+	// 메시별 로컬 모서리 캐시는 유지하고 월드 공간 목록만 다시 펼친다
+	Edges.Reset();
+	Cells.Reset();
+	OversizedEdges.Reset();
+	FreeEdges.Reset();
+	EdgesByComponent.Reset();
+
+	if (UWorld* World = GetWorld())
+	{
+		for (ULevel* Level : World->GetLevels())
+		{
+			if (Level != ExcludedLevel)
+			{
+				IndexLevel(Level);
+			}
+		}
+	}
+}
+
+FIntPoint ULedgeEdgeSubsystem::ToCell(const FVector& Location) const
+{
+	return FIntPoint(
+		FMath::FloorToInt(Location.X / CellSize),
+		FMath::FloorToInt(Location.Y / CellSize));
+}
+
+void ULedgeEdgeSubsystem::HandleActorDestroyed(AActor* Actor)
+{
+	if (!Actor || EdgesByComponent.Num() == 0) return;
+
+	Actor->ForEachComponent<UStaticMeshComponent>(false, [this](UStaticMeshComponent* Component)
+	{
+		UnregisterComponent(Component);
+	});
+}
+
+void ULedgeEdgeSubsystem::HandleLevelAddedToWorld(ULevel* Level, UWorld* InWorld)
+{
+	if (InWorld != GetWorld()) return;
+	IndexLevel(Level);
+}
+
+void ULedgeEdgeSubsystem::HandleLevelRemovedFromWorld(ULevel* Level, UWorld* InWorld)
+{
+	if (InWorld != GetWorld()) return;
+
+	// 스트리밍 해제는 드물어서 인덱스 제거 대신 남은 레벨로 전체 재구성
+	RebuildAll(Level);
+}
+
+#if !UE_BUILD_SHIPPING
+#include "Dev/MarioBenchCommand.h"
+#include "DrawDebugHelpers.h"
+
+namespace LedgeEdgeDebug
+{
+	// 사용: mario.DrawLedges [Seconds]
+	static void Draw(const TArray<FString>& Args, UWorld* World)
+	{
+		const ULedgeEdgeSubsystem* Ledges = ULedgeEdgeSubsystem::Get(World);
+		if (!Ledges) return;
+
+		const float Seconds = MarioBench::FloatArg(Args, 0, 10.f);
+		for (const FLedgeEdge& Edge : Ledges->GetEdges())
+		{
+			if (!Edge.IsValid()) continue;
+
+			const FVector Start(Edge.Start);
+			const FVector End(Edge.End);
+			const FVector Mid = (Start + End) * 0.5f;
+			DrawDebugLine(World, Start, End, FColor::Yellow, false, Seconds, 0, 2.f);
+			DrawDebugLine(World, Mid, Mid + FVector(Edge.Normal) * 30.f, FColor::Cyan, false, Seconds, 0, 1.f);
+		}
+	}
+
+	static FMarioBenchCommand DrawCommand(
+		TEXT("mario.DrawLedges"),
+		TEXT("캐시된 잡기 모서리(노랑)와 바깥 노멀(하늘)을 그린다. 인자: 표시 시간(초)"),
+		&Draw);
+}
+#endif
@@ -2,6 +2,7 @@
 
 #include "Components/StaticMeshComponent.h"
 #include "Progress/MarioGameInstance.h"
+#include "World/DeterministicSimSubsystem.h"
 
 AMarioMovingPlatform::AMarioMovingPlatform()
 {
@@ -23,6 +24,8 @@ AMarioMovingPlatform::AMarioMovingPlatform()
 
 void AMarioMovingPlatform::BeginPlay()
 {
+	UDeterministicSimSubsystem::InitRandomStream(this, PhaseRandom);
+
 	Super::BeginPlay();
 
 	RefreshEndpoints();
@@ -144,7 +147,7 @@ void AMarioMovingPlatform::ActivateMovement(bool bResetPhase)
 		if (bRandomStartPhase)
 		{
 			const float Cycle = bPingPong ? (2.f * MoveDuration) : MoveDuration;
-			MoveElapsed = FMath::FRandRange(0.f, FMath::Max(Cycle, KINDA_SMALL_NUMBER));
+			MoveElapsed = PhaseRandom.FRandRange(0.f, FMath::Max(Cycle, KINDA_SMALL_NUMBER));
 		}
 	}
 
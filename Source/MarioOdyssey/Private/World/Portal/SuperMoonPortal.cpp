@@ -8,6 +8,7 @@
 
 #include "MarioOdyssey/MarioCharacter.h"
 #include "Progress/MarioGameInstance.h"
+#include "MarioTimers.h"
 
 ASuperMoonPortal::ASuperMoonPortal()
 {
@@ -157,7 +158,7 @@ void ASuperMoonPortal::StartTravel(AMarioCharacter* Mario)
 		}
 		else
 		{
-			World->GetTimerManager().SetTimer(TravelTimer, this, &ASuperMoonPortal::OpenTargetLevel, Wait, false);
+			MarioTimers::Set(World->GetTimerManager(), TravelTimer, this, &ASuperMoonPortal::OpenTargetLevel, Wait, false);
 		}
 	}
 }
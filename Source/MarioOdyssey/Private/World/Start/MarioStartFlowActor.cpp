@@ -3,6 +3,8 @@
 #include "UI/MarioStartScreenWidget.h"
 #include "UI/MarioHUDWidget.h"
 #include "Audio/BgmManager.h"
+#include "World/ActorRegistrySubsystem.h"
+#include "MarioTimers.h"
 
 #include "Kismet/GameplayStatics.h"
 #include "Blueprint/WidgetBlueprintLibrary.h"
@@ -19,6 +21,8 @@
 #include "TimerManager.h"
 #include "UObject/ConstructorHelpers.h"
 
+DEFINE_LOG_CATEGORY_STATIC(LogMarioStartFlow, Log, All);
+
 AMarioStartFlowActor::AMarioStartFlowActor()
 {
 	PrimaryActorTick.bCanEverTick = false;
@@ -44,7 +48,7 @@ void AMarioStartFlowActor::BeginPlay()
 	// 한 틱 뒤 시작(PC/HUD 생성 순서 안정화)
 	if (UWorld* W = GetWorld())
 	{
-		W->GetTimerManager().SetTimerForNextTick(this, &AMarioStartFlowActor::InitStartScreen);
+		MarioTimers::SetForNextTick(W->GetTimerManager(), this, &AMarioStartFlowActor::InitStartScreen);
 	}
 	else
 	{
@@ -148,7 +152,7 @@ void AMarioStartFlowActor::HandleStartRequested()
 	if (UWorld* W = GetWorld())
 	{
 		W->GetTimerManager().ClearTimer(StartCutsceneTimer);
-		W->GetTimerManager().SetTimer(StartCutsceneTimer, this, &AMarioStartFlowActor::StartCutsceneOrFinish, TotalDelay, false);
+		MarioTimers::Set(W->GetTimerManager(), StartCutsceneTimer, this, &AMarioStartFlowActor::StartCutsceneOrFinish, TotalDelay, false);
 	}
 	else
 	{
@@ -198,29 +202,23 @@ ALevelSequenceActor* AMarioStartFlowActor::ResolveIntroSequenceActor() const
 
 	if (!GetWorld()) return nullptr;
 
-	TArray<AActor*> Found;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), ALevelSequenceActor::StaticClass(), Found);
-
-	for (AActor* A : Found)
+	// 태그 인덱스로 먼저 조회(월드 전체 탐색 없음)
+	if (const UActorRegistrySubsystem* Registry = UActorRegistrySubsystem::Get(this))
 	{
-		if (ALevelSequenceActor* L = Cast<ALevelSequenceActor>(A))
+		TArray<AActor*> Tagged;
+		Registry->GetActorsWithTag(IntroSequenceTag, Tagged);
+
+		for (AActor* A : Tagged)
 		{
-			if (L->ActorHasTag(IntroSequenceTag))
+			if (ALevelSequenceActor* L = Cast<ALevelSequenceActor>(A))
 			{
 				return L;
 			}
 		}
 	}
 
-	// fallback: 첫 번째
-	for (AActor* A : Found)
-	{
-		if (ALevelSequenceActor* L = Cast<ALevelSequenceActor>(A))
-		{
-			return L;
-		}
-	}
-
+	// 월드 전체 탐색 fallback은 두지 않는다(IntroSequenceActor 지정 또는 IntroSequenceTag 필요)
+	UE_LOG(LogMarioStartFlow, Warning, TEXT("[StartFlow] No intro sequence: set IntroSequenceActor or tag a LevelSequenceActor with '%s'"), *IntroSequenceTag.ToString());
 	return nullptr;
 }
 
@@ -235,7 +233,7 @@ void AMarioStartFlowActor::HandleIntroFinished()
 	if (UWorld* W = GetWorld())
 	{
 		W->GetTimerManager().ClearTimer(FinishToGameplayTimer);
-		W->GetTimerManager().SetTimer(FinishToGameplayTimer, this, &AMarioStartFlowActor::FinishAfterFadeOut, FMath::Max(0.0f, FadeOutSeconds), false);
+		MarioTimers::Set(W->GetTimerManager(), FinishToGameplayTimer, this, &AMarioStartFlowActor::FinishAfterFadeOut, FMath::Max(0.0f, FadeOutSeconds), false);
 	}
 	else
 	{
@@ -312,7 +310,8 @@ ABgmManager* AMarioStartFlowActor::ResolveBgmManager()
 
 	if (!GetWorld()) return nullptr;
 
-	ABgmManager* M = Cast<ABgmManager>(UGameplayStatics::GetActorOfClass(GetWorld(), ABgmManager::StaticClass()));
+	// 레지스트리 조회라 매니저가 아직 없을 때 반복 호출돼도 월드 탐색은 일어나지 않는다
+	ABgmManager* M = ABgmManager::Get(this);
 	CachedBgmManager = M;
 	return M;
 }
@@ -0,0 +1,140 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MarioOdyssey/MarioOdysseyStats.h"
+
+/**
+ * 액터 로컬 인라인 타이머 큐.
+ * 소유자 Tick에서 Tick(this, Dt)로 진행되며 월드 전역 FTimerManager 힙을 건드리지 않는다.
+ * - 태그당 항목 1개(같은 태그로 다시 Schedule하면 덮어씀 = ClearTimer+SetTimer)
+ * - 용량은 고정 인라인 배열(초과는 개발 중 ensure로 잡는다)
+ * - Delay <= 0 이면 FTimerManager::SetTimer와 같이 취소로 처리
+ * 소유자 Tick을 따라가므로 일시정지/액터 틱 비활성 중에는 멈춘다.
+ */
+template <typename OwnerType, typename TagType, int32 Capacity>
+class TActorTimeline
+{
+	static_assert(Capacity > 0 && Capacity <= 32, "TActorTimeline capacity out of range");
+
+public:
+	typedef void (OwnerType::*FCallback)();
+
+	// 파생 클래스 멤버도 받는다(소유자가 실제로 DerivedType일 때만 호출됨)
+	template <typename DerivedType>
+	bool Schedule(TagType Tag, float Delay, void (DerivedType::*Callback)())
+	{
+		static_assert(TIsDerivedFrom<DerivedType, OwnerType>::Value, "Callback owner must derive from OwnerType");
+
+		if (Delay <= 0.f || !Callback)
+		{
+			Cancel(Tag);
+			return false;
+		}
+
+		FEntry* Entry = Find(Tag);
+		if (!Entry)
+		{
+			if (!ensureMsgf(Num < Capacity, TEXT("TActorTimeline full (capacity %d)"), Capacity))
+			{
+				return false;
+			}
+			Entry = &Entries[Num++];
+			Entry->Tag = Tag;
+		}
+
+		Entry->Remaining = Delay;
+		Entry->Callback = static_cast<FCallback>(Callback);
+
+		MARIO_COUNT_TIMELINE_SCHEDULE();
+		return true;
+	}
+
+	void Cancel(TagType Tag)
+	{
+		for (int32 i = 0; i < Num; ++i)
+		{
+			if (Entries[i].Tag == Tag)
+			{
+				RemoveAtSwap(i);
+				MARIO_COUNT_TIMELINE_CANCEL();
+				return;
+			}
+		}
+	}
+
+	void CancelAll() { Num = 0; }
+
+	bool IsScheduled(TagType Tag) const { return Find(Tag) != nullptr; }
+
+	// 꺼져 있으면 0
+	float GetRemaining(TagType Tag) const
+	{
+		const FEntry* Entry = Find(Tag);
+		return Entry ? Entry->Remaining : 0.f;
+	}
+
+	bool IsEmpty() const { return Num == 0; }
+
+	void Tick(OwnerType* Owner, float DeltaSeconds)
+	{
+		if (Num == 0)
+		{
+			return;
+		}
+
+		for (int32 i = 0; i < Num; ++i)
+		{
+			Entries[i].Remaining -= DeltaSeconds;
+		}
+
+		// 콜백 안에서 Schedule/Cancel 해도 안전하도록 만료 항목을 하나씩 꺼내 호출
+		// (콜백 안에서 새로 건 항목은 Delay > 0 이라 이번 틱에 다시 만료되지 않는다)
+		for (int32 i = 0; i < Num; )
+		{
+			if (Entries[i].Remaining > 0.f)
+			{
+				++i;
+				continue;
+			}
+
+			const FCallback Callback = Entries[i].Callback;
+			RemoveAtSwap(i);
+			(Owner->*Callback)();
+			i = 0;
+		}
+	}
+
+private:
+	struct FEntry
+	{
+		float Remaining = 0.f;
+		FCallback Callback = nullptr;
+		TagType Tag = TagType();
+	};
+
+	FEntry Entries[Capacity];
+	int32 Num = 0;
+
+	FEntry* Find(TagType Tag)
+	{
+		for (int32 i = 0; i < Num; ++i)
+		{
+			if (Entries[i].Tag == Tag)
+			{
+				return &Entries[i];
+			}
+		}
+		return nullptr;
+	}
+
+	const FEntry* Find(TagType Tag) const
+	{
+		return const_cast<TActorTimeline*>(this)->Find(Tag);
+	}
+
+	void RemoveAtSwap(int32 Index)
+	{
+		Entries[Index] = Entries[Num - 1];
+		--Num;
+	}
+};
@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "Audio/BgmZoneGrid.h"
 #include "BgmManager.generated.h"
 
 class UAudioComponent;
@@ -39,6 +40,33 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="BGM|Zones", meta=(ClampMin="0.02"))
 	float PollIntervalSeconds = 0.10f;
 
+	/** true면 리스너가 PollMinMoveDistance 이상 움직였을 때만 구역을 재판정. 정지 중에는 폴링 타이머를 일시정지하고 리스너가 움직이면 재개 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="BGM|Zones")
+	bool bPollOnlyWhenMoved = true;
+
+	/** 재판정에 필요한 최소 이동 거리(cm) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="BGM|Zones", meta=(ClampMin="0.0", EditCondition="bPollOnlyWhenMoved"))
+	float PollMinMoveDistance = 50.f;
+
+	/** 구역 공간 격자 셀 크기(cm). 대략 평균 구역 크기 정도가 적당(셀에는 등록 시 AABB를 기록, Movable 구역은 이동 시 갱신) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="BGM|Zones", meta=(ClampMin="100.0"))
+	float ZoneGridCellSize = 4000.f;
+
+	/** 동시 재생 보이스 수. 페이드 도중 다시 전환돼도 기존 트랙이 끊기지 않도록 3 이상 권장 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="BGM|Voices", meta=(ClampMin="2", ClampMax="8"))
+	int32 VoiceCount = 3;
+
+	/** 리스너 주변 이 반경(cm) 안에 있는 구역 트랙은 미리 Prime(스트리밍 첫 청크 캐시). 0이면 끔 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="BGM|Voices", meta=(ClampMin="0.0"))
+	float PreloadRadius = 3000.f;
+
+	/** Prime 기록을 유지할 최대 트랙 수(넘으면 가장 오래된 기록부터 버림. 다시 근처에 오면 재Prime) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="BGM|Voices", meta=(ClampMin="1"))
+	int32 MaxPrimedTracks = 16;
+
+	/** 월드의 BgmManager(액터 레지스트리 조회, 월드 탐색 없음) */
+	static ABgmManager* Get(const UObject* WorldContextObject);
+
 	/** 직접 트랙을 전환(구역 로직 무시). 디버그/특수 연출용 */
 	UFUNCTION(BlueprintCallable, Category="BGM")
 	void RequestTrack(USoundBase* NewTrack, float FadeSeconds = 1.0f);
@@ -62,6 +90,24 @@ public:
 	UFUNCTION(BlueprintCallable, Category="BGM")
 	void SetSuppressed(bool bInSuppressed, float FadeSeconds = 0.25f);
 
+	/**
+	 * 동기 스템 재생(보스 강도 레이어 등). 모든 스템을 같은 프레임에 시작하고 InitialVolumes로 믹스.
+	 * 스템이 재생되는 동안 구역 트랙 전환은 보류했다가 StopStems에서 이어 받는다.
+	 */
+	UFUNCTION(BlueprintCallable, Category="BGM|Stems")
+	void PlayStems(const TArray<USoundBase*>& Stems, const TArray<float>& InitialVolumes, float FadeSeconds = 1.0f);
+
+	/** 재생 중인 스템 하나의 볼륨만 페이드(재시작 없음) */
+	UFUNCTION(BlueprintCallable, Category="BGM|Stems")
+	void SetStemVolume(int32 StemIndex, float Volume, float FadeSeconds = 1.0f);
+
+	/** 스템 전체 페이드아웃 후 현재 구역 트랙으로 복귀 */
+	UFUNCTION(BlueprintCallable, Category="BGM|Stems")
+	void StopStems(float FadeSeconds = 1.0f);
+
+	UFUNCTION(BlueprintPure, Category="BGM|Stems")
+	bool IsPlayingStems() const { return bStemsActive; }
+
 
 protected:
 	UPROPERTY(VisibleAnywhere, Category="BGM|Components")
@@ -73,9 +119,35 @@ protected:
 	UPROPERTY(VisibleAnywhere, Category="BGM|Components")
 	UAudioComponent* AudioB = nullptr;
 
+	/** AudioA/AudioB + VoiceCount만큼 런타임 생성한 보이스 */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UAudioComponent>> Voices;
+
+	/** 스템 레이어 전용 보이스(스템 인덱스와 1:1) */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UAudioComponent>> StemVoices;
+
 private:
 	USoundBase* CurrentTrack = nullptr;
-	bool bUsingA = true;
+
+	// Voices와 1:1. 페이드아웃 중인 보이스가 같은 트랙을 다시 요청받으면 재시작 없이 되살린다.
+	struct FVoiceState
+	{
+		TWeakObjectPtr<USoundBase> Track;
+		bool bFadingOut = false;
+		double StartTime = 0.0;
+	};
+
+	TArray<FVoiceState> VoiceStates;
+	int32 ActiveVoice = INDEX_NONE;
+
+	bool bStemsActive = false;
+	TWeakObjectPtr<USoundBase> TrackAfterStems;
+	float FadeAfterStems = 1.0f;
+
+	// 최근 Prime한 트랙(오래된 순). MaxPrimedTracks개로 제한
+	TArray<TWeakObjectPtr<USoundBase>> PrimedTracks;
+	TArray<int32> PreloadCandidateIds;
 
 	// 구역 스택(겹침 대비). Priority 큰 게 우선. 같으면 "마지막으로 들어온" 구역 우선.
 	struct FZoneEntry
@@ -88,24 +160,65 @@ private:
 	TArray<FZoneEntry> ActiveZones;
 	int64 EnterOrderCounter = 0;
 
-	// 폴링용 전체 구역 + 현재 내부 구역(중복 진입/이탈 방지)
+	// 폴링용 전체 구역(슬롯 인덱스 = 격자 Id, 해제된 슬롯은 재사용) + 현재 내부 구역 Id(중복 진입/이탈 방지)
 	TArray<TWeakObjectPtr<ABgmZoneTrigger>> AllZones;
-	TSet<TWeakObjectPtr<ABgmZoneTrigger>> InsideZones;
+	TArray<int32> FreeZoneSlots;
+	TArray<int32> InsideZoneIds;
+
+	// 리스너 위치 -> 후보 구역 조회용 격자
+	FBgmZoneGrid ZoneGrid;
+	TArray<int32> PollCandidateIds;
+	TArray<int32> PollNowInsideIds;
+
+	FVector LastPollLocation = FVector::ZeroVector;
+	bool bForceNextPoll = true;
 
 	FTimerHandle PollTimer;
 
+	// 폴링이 일시정지된 동안 이동을 감시하는 리스너(재개 시 바인딩 해제)
+	TWeakObjectPtr<AActor> PausedListener;
+
 	void UpdateDesiredTrack();
 	ABgmZoneTrigger* PickBestZone(int32& OutPriority, float& OutFadeSeconds) const;
 
 	void CrossFadeTo(USoundBase* NewTrack, float FadeSeconds);
 
+	void BuildVoicePool();
+	UAudioComponent* CreateVoice(FName Name);
+	int32 AcquireVoiceFor(USoundBase* Track);
+	void FadeOutVoice(int32 VoiceIndex, float FadeSeconds);
+	void FadeOutAllVoices(float FadeSeconds);
+
+	void PrimeTrack(USoundBase* Track);
+	void PrimeTracksNear(const FVector& Location);
+
 	void PruneInvalidZones();
 
+	// 구역 스택만 갱신(트랙 선정은 호출 측에서 한 번에). 변경되었으면 true
+	bool AddActiveZone(ABgmZoneTrigger* Zone);
+	bool RemoveActiveZone(ABgmZoneTrigger* Zone);
+
 	void CacheZonesOnce();
+	void AddZoneToIndex(ABgmZoneTrigger* Zone);
+	void RemoveZoneFromIndex(ABgmZoneTrigger* Zone);
+	void HandleRegisteredActorChanged(AActor* Actor, bool bRegistered);
+	void HandleZoneOverlapChanged(ABgmZoneTrigger* Zone, bool bEntered);
+	void HandleZoneBoundsChanged(ABgmZoneTrigger* Zone);
+	FDelegateHandle ZoneRegistryHandle;
 	void StartPollingIfEnabled();
 	void StopPolling();
 
+	// 다음 폴링에서 이동 여부와 무관하게 재판정(일시정지 중이면 재개)
+	void RequestPoll();
+	void PausePollingUntilMoved();
+	void ResumePolling();
+	void HandleListenerMoved(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+
+	UFUNCTION()
+	void HandleListenerEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason);
+
 	void PollZonesByLocation();
 
+	AActor* GetListenerActor() const;
 	FVector GetListenerLocation() const;
 };
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * BGM 구역 AABB용 균일 2D(XY) 격자.
+ * - 구역은 정수 Id로 관리(ABgmManager의 구역 슬롯 인덱스)
+ * - 조회는 리스너가 속한 셀의 후보만 AABB 검사 -> 정확한 판정(회전 박스)은 호출 측에서 수행
+ * - 셀을 너무 많이 덮는 거대 구역은 별도 목록으로 두고 항상 후보에 포함
+ * - AABB는 Add 시점 값으로 고정. 구역이 움직이면 호출 측이 같은 Id로 다시 Add해야 한다
+ */
+struct MARIOODYSSEY_API FBgmZoneGrid
+{
+public:
+	explicit FBgmZoneGrid(float InCellSize = 2000.f);
+
+	void Reset(float InCellSize);
+
+	void Add(int32 Id, const FBox& WorldBounds);
+	void Remove(int32 Id);
+
+	// Location을 AABB로 포함하는 구역 Id를 OutIds에 추가
+	void Query(const FVector& Location, TArray<int32>& OutIds) const;
+
+	// Location에서 Radius 이내(AABB 거리)인 구역 Id를 중복 없이 OutIds에 추가(프리로드 후보용)
+	void QueryRadius(const FVector& Location, float Radius, TArray<int32>& OutIds) const;
+
+	int32 Num() const { return BoundsById.Num(); }
+	float GetCellSize() const { return CellSize; }
+
+private:
+	// 이보다 많은 셀을 덮으면 Oversized로 분류
+	static constexpr int32 MaxCellsPerZone = 64;
+
+	float CellSize = 2000.f;
+
+	TMap<FIntPoint, TArray<int32>> Cells;
+	TMap<int32, FBox> BoundsById;
+	TArray<int32> OversizedIds;
+
+	FIntPoint ToCell(const FVector& Location) const;
+	void GetCellRange(const FBox& Bounds, FIntPoint& OutMin, FIntPoint& OutMax) const;
+};
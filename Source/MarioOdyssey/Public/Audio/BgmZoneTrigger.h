@@ -5,7 +5,15 @@
 #include "BgmZoneTrigger.generated.h"
 
 class UBoxComponent;
+class UPrimitiveComponent;
 class USoundBase;
+class ABgmZoneTrigger;
+
+// 오버랩 기반 진입/이탈 알림(bEntered=false면 이탈)
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnBgmZoneOverlapChanged, ABgmZoneTrigger*, bool /*bEntered*/);
+
+// Movable 구역 트랜스폼 변경 알림(BgmManager 격자 갱신용)
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnBgmZoneBoundsChanged, ABgmZoneTrigger*);
 
 /**
  * BGM Zone Trigger (데이터 + 영역)
@@ -14,6 +22,9 @@ class USoundBase;
  * 장점:
  * - 캡쳐(빙의)로 Pawn이 바뀌어도 ViewTarget(Mario) 위치 기준으로 안정적으로 동작
  * - Collision/Overlap 이벤트에 의존하지 않아서 WallDetector 같은 트레이스에 덜 휘둘림
+ *
+ * bUseOverlapEvents를 켜면 플레이어 오버랩 시점에 즉시 진입/이탈을 알려서
+ * 매니저가 폴링 주기를 기다리지 않고 반응한다(폴링을 끈 레벨에서는 오버랩만으로 동작).
  */
 UCLASS()
 class MARIOODYSSEY_API ABgmZoneTrigger : public AActor
@@ -24,6 +35,7 @@ public:
 	ABgmZoneTrigger();
 
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="BGM|Components")
 	USceneComponent* Root = nullptr;
@@ -47,10 +59,38 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="BGM")
 	bool bRevertOnExit = true;
 
-	/** 월드 좌표가 이 박스 영역 안에 있는지(회전/스케일까지 고려) */
+	/** 이탈 히스테리시스(cm): 진입 후에는 박스보다 이만큼 더 벗어나야 이탈로 본다(경계 떨림 방지) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="BGM", meta=(ClampMin="0.0"))
+	float ExitHysteresis = 100.f;
+
+	/** 플레이어 오버랩으로 즉시 진입/이탈 알림(Trigger 충돌을 QueryOnly로 켠다) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="BGM")
+	bool bUseOverlapEvents = false;
+
+	FOnBgmZoneOverlapChanged OnZoneOverlapChanged;
+
+	/** Trigger가 Movable일 때만 발생. Static/Stationary 구역은 등록 시 계산한 AABB를 계속 사용 */
+	FOnBgmZoneBoundsChanged OnZoneBoundsChanged;
+
+	/** 월드 좌표가 이 박스 영역(+Margin cm) 안에 있는지(회전/스케일까지 고려) */
 	UFUNCTION(BlueprintPure, Category="BGM")
-	bool IsLocationInside(const FVector& WorldLocation) const;
+	bool IsLocationInside(const FVector& WorldLocation, float Margin = 0.f) const;
+
+	/** 영역의 월드 AABB(BgmManager 공간 격자 등록용) */
+	FBox GetZoneWorldBounds() const;
 
 private:
 	FVector GetUnscaledExtent() const;
+
+	bool IsPlayerActor(const AActor* Actor, const UPrimitiveComponent* Comp) const;
+
+	void HandleTriggerTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+
+	UFUNCTION()
+	void OnTriggerBeginOverlap(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp,
+		int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
+
+	UFUNCTION()
+	void OnTriggerEndOverlap(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp,
+		int32 OtherBodyIndex);
 };
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Camera/PlayerCameraManager.h"
+#include "MarioPlayerCameraManager.generated.h"
+
+class AMarioCharacter;
+class USpringArmComponent;
+
+/**
+ * 마리오/캡쳐 공용 카메라 매니저.
+ * - 컨트롤 회전 보간: 마리오의 목표 회전(Look 누적)을 고정 내부 스텝(SmoothingRateHz)으로 따라가고,
+ *   스텝 사이는 보간해서 내보낸다 -> 프레임레이트와 무관하게 같은 궤적
+ * - 스프링암 충돌: 스프링암 자체 프로브를 끄고 여기서 프레임당 MaxCollisionProbesPerFrame,
+ *   초당 CollisionProbeRateHz 이내로만 스윕(사이 프레임은 마지막 결과 재사용, 급변 시 즉시 재프로브)
+ * - 스프링암 CameraLag/CameraRotationLag 설정은 리그를 다시 계산할 때 같은 값으로 적용(지연 튜닝 유지)
+ * - 뷰 타깃 고정: PinViewTarget 대상에서 벗어났을 때만 SetViewTarget(매 틱 재지정 없음)
+ * 캡쳐 중에도 뷰 타깃은 몬스터에 붙은 마리오이므로 리그는 항상 마리오의 스프링암이다.
+ */
+UCLASS()
+class MARIOODYSSEY_API AMarioPlayerCameraManager : public APlayerCameraManager
+{
+	GENERATED_BODY()
+
+public:
+	// Possess 등으로 뷰 타깃이 바뀌어도 Target으로 되돌린다(캡쳐 중 마리오 카메라 유지)
+	void PinViewTarget(AActor* Target);
+	void UnpinViewTarget();
+
+	virtual void UpdateCamera(float DeltaTime) override;
+
+protected:
+	virtual void UpdateViewTarget(FTViewTarget& OutVT, float DeltaTime) override;
+
+	UPROPERTY(EditDefaultsOnly, Category="Mario|Camera", meta=(ClampMin="15.0"))
+	float SmoothingRateHz = 120.f;
+
+	// 히치 후 따라잡기 스텝 상한(넘는 시간은 버림)
+	UPROPERTY(EditDefaultsOnly, Category="Mario|Camera", meta=(ClampMin="1"))
+	int32 MaxSmoothingStepsPerFrame = 8;
+
+	UPROPERTY(EditDefaultsOnly, Category="Mario|Camera|Collision", meta=(ClampMin="0"))
+	int32 MaxCollisionProbesPerFrame = 1;
+
+	UPROPERTY(EditDefaultsOnly, Category="Mario|Camera|Collision", meta=(ClampMin="1.0"))
+	float CollisionProbeRateHz = 30.f;
+
+	// 마지막 프로브 이후 이만큼 돌거나 움직이면 주기와 상관없이 다시 프로브(벽 뚫림 방지)
+	UPROPERTY(EditDefaultsOnly, Category="Mario|Camera|Collision")
+	float ProbeForceAngleDeg = 5.f;
+
+	UPROPERTY(EditDefaultsOnly, Category="Mario|Camera|Collision")
+	float ProbeForceDistance = 50.f;
+
+	// 막혔다가 풀릴 때 암 길이 복귀 속도(전체 길이 비율/초). 막힐 때는 즉시 당긴다
+	UPROPERTY(EditDefaultsOnly, Category="Mario|Camera|Collision")
+	float ArmRecoverRate = 4.f;
+
+private:
+	TWeakObjectPtr<AActor> PinnedViewTarget;
+
+	// 고정 스텝 회전 보간 상태
+	bool bHasRotationState = false;
+	FRotator PrevStepRotation = FRotator::ZeroRotator;
+	FRotator StepRotation = FRotator::ZeroRotator;
+	FRotator LastOutputRotation = FRotator::ZeroRotator;
+	float StepAccumulator = 0.f;
+
+	// 스프링암 충돌 상태
+	TWeakObjectPtr<USpringArmComponent> ManagedArm;
+	float ArmTargetFraction = 1.f; // 마지막 프로브 결과
+	float ArmFraction = 1.f;       // 실제 적용(복귀는 고정 스텝으로 천천히)
+	float LastProbeTime = -1.f;
+	FVector LastProbeOrigin = FVector::ZeroVector;
+	FRotator LastProbeRotation = FRotator::ZeroRotator;
+	uint64 ProbeBudgetFrame = 0;
+	int32 ProbesThisFrame = 0;
+
+	// 스프링암 CameraLag/CameraRotationLag 재현 상태
+	bool bHasArmLagState = false;
+	FVector LaggedArmOrigin = FVector::ZeroVector;
+	FRotator LaggedArmRotation = FRotator::ZeroRotator;
+
+	AMarioCharacter* ResolveMario() const;
+	void StepControlRotation(AMarioCharacter* Mario, float DeltaTime);
+	void AdoptSpringArm(USpringArmComponent* Arm);
+	void ApplySpringArmLag(const USpringArmComponent* Arm, float DeltaTime, FVector& InOutOrigin, FRotator& InOutRotation);
+	bool ShouldProbe(const FVector& Origin, const FRotator& Rotation) const;
+	bool ConsumeProbeBudget();
+	void ProbeArm(const AMarioCharacter* Mario, const USpringArmComponent* Arm, const FVector& Origin, const FVector& Desired);
+};
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+// 클래스 단위 캡쳐 관련 능력(클래스가 바뀌지 않는 한 불변이라 1회 계산 후 캐시)
+enum class ECaptureCapability : uint8
+{
+	None       = 0,
+	Capturable = 1 << 0, // ICapturableInterface 구현
+};
+ENUM_CLASS_FLAGS(ECaptureCapability);
+
+namespace CaptureCapability
+{
+	/**
+	 * 클래스별 능력 비트마스크. 처음 본 클래스만 ImplementsInterface/IsChildOf를 확인하고 이후엔 맵 조회 1회.
+	 * 월드 정리(PIE 종료/레벨 전환) 때 비운다. 그 사이 블루프린트 재컴파일은 새 UClass를 만들어 키가 달라진다. 게임 스레드 전용.
+	 */
+	MARIOODYSSEY_API ECaptureCapability Get(const UClass* Class);
+
+	inline bool IsCapturableClass(const UClass* Class)
+	{
+		return EnumHasAnyFlags(Get(Class), ECaptureCapability::Capturable);
+	}
+}
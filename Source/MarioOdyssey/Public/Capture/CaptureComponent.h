@@ -7,6 +7,7 @@
 
 class AMarioCharacter;
 class APawn;
+class AController;
 class APlayerController;
 
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
@@ -33,9 +34,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Capture")
 	APawn* GetCapturedPawn() const { return CapturedPawn.Get(); }
 
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
 protected:
 	virtual void BeginPlay() override;
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 private:
 	// 정책 값(튜닝은 나중에)
@@ -48,6 +50,17 @@ private:
 	UPROPERTY(EditDefaultsOnly, Category="Capture|Exit")
 	float ExitNavProjectRadius = 250.f;
 
+	// 캡쳐 중 출구 후보 링 갱신 빈도(초당 프로브 수). 해제는 이 결과를 쿼리 없이 쓴다
+	UPROPERTY(EditDefaultsOnly, Category="Capture|Exit", meta=(ClampMin="1.0"))
+	float ExitProbeRateHz = 10.f;
+
+	UPROPERTY(EditDefaultsOnly, Category="Capture|Exit", meta=(ClampMin="1"))
+	int32 MaxExitProbesPerFrame = 1;
+
+	// 확인된 지 이보다 오래된 출구는 해제 시 1회 다시 확인
+	UPROPERTY(EditDefaultsOnly, Category="Capture|Exit")
+	float ExitCacheMaxAge = 0.5f;
+
 private:
 	TWeakObjectPtr<AMarioCharacter> OriginalMario;
 	TWeakObjectPtr<APlayerController> CachedPC;
@@ -55,18 +68,37 @@ private:
 	TWeakObjectPtr<AActor> CapturedActor; // 인터페이스 호출용
 	TWeakObjectPtr<APawn>  CapturedPawn;
 
+	// 캡쳐 전 몬스터를 조종하던 AI 컨트롤러(해제 시 새로 스폰하지 않고 다시 Possess)
+	TWeakObjectPtr<AController> CapturedPawnPrevController;
+
+	// 휴면 진입 직전 캡슐 충돌(복귀 시 그대로 되돌림)
+	TEnumAsByte<ECollisionEnabled::Type> MarioCapsuleCollision = ECollisionEnabled::QueryAndPhysics;
+	bool bMarioDormant = false;
+
 	bool bIsCapturing = false;
 	bool bPrevAutoManageCameraTarget = true;
 
+	// 출구 링: 몬스터 정면 기준 우선순위 순서(정면 -> 좌우 45 -> 좌우 90 -> ... -> 후방)의 후보
+	static constexpr int32 NumExitSlots = 8;
+	TStaticArray<float, NumExitSlots> ExitSlotValidatedTime; // 비어 있음이 확인된 시각(<0 이면 막힘/미확인)
+	int32 ExitProbeCursor = 0;
+	int32 BestExitSlot = INDEX_NONE; // 가장 우선순위 높은 빈 후보
+	float ExitProbeAccumulator = 0.f;
+
 private:
 	void CachePlayerControllerIfNeeded();
 
-	void ApplyMarioCaptureHide(bool bHide);
+	void SetMarioDormant(bool bDormant);
 	void AttachMarioToCapturedPawn();
 	void DetachMario();
 
 	bool ComputeExitLocation(FVector& OutExitLocation) const;
 
+	void ResetExitRing();
+	void RefreshExitRing(float DeltaTime);
+	FVector GetExitSlotLocation(int32 Slot) const;
+	bool IsExitClear(const FVector& Location) const;
+
 private:
 	UFUNCTION()
 	void HandleCapturedPawnAnyDamage(AActor* DamagedActor, float Damage, const UDamageType* DamageType,
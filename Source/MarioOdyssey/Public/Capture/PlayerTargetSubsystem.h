@@ -0,0 +1,52 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PlayerTargetSubsystem.generated.h"
+
+class AMarioCharacter;
+class APawn;
+
+/**
+ * 플레이어 대상(원본 마리오 / 현재 조종 중인 캡쳐 Pawn) 캐시.
+ * 마리오 BeginPlay/EndPlay, 캡쳐 시작/해제 시점에만 갱신되고
+ * AI 쪽은 매 틱 PlayerController/ViewTarget/월드 탐색 없이 O(1)로 조회한다.
+ */
+UCLASS()
+class MARIOODYSSEY_API UPlayerTargetSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UPlayerTargetSubsystem* Get(const UObject* WorldContextObject);
+
+	void RegisterMario(AMarioCharacter* Mario);
+	void UnregisterMario(AMarioCharacter* Mario);
+
+	// 캡쳐 시작 시 캡쳐된 Pawn, 해제 시 nullptr
+	void SetCapturedPawn(APawn* InCapturedPawn);
+
+	// 원본 마리오(캡쳐 중에도 마리오)
+	UFUNCTION(BlueprintPure, Category="PlayerTarget")
+	AMarioCharacter* GetMario() const;
+
+	// 플레이어가 현재 조종 중인 Pawn(평상시=마리오, 캡쳐중=캡쳐 Pawn)
+	UFUNCTION(BlueprintPure, Category="PlayerTarget")
+	APawn* GetControlledPawn() const;
+
+	// 캐시가 비어 있어 PlayerController 경로로 다시 찾은 횟수(정상 상태에서는 0 유지)
+	UFUNCTION(BlueprintPure, Category="PlayerTarget")
+	int32 GetFallbackResolveCount() const { return FallbackResolveCount; }
+
+private:
+	// 등록 전 조회 시 fallback 결과를 캐시하므로 mutable
+	mutable TWeakObjectPtr<AMarioCharacter> Mario;
+	TWeakObjectPtr<APawn> CapturedPawn;
+
+	mutable int32 FallbackResolveCount = 0;
+
+	// fallback이 실패한 프레임(마리오가 없는 맵/스폰 전에는 같은 프레임 재조회를 건너뜀)
+	mutable uint64 FallbackMissFrame = MAX_uint64;
+
+	AMarioCharacter* ResolveMarioFallback() const;
+};
@@ -4,9 +4,34 @@
 #include "GameFramework/Actor.h"
 #include "TimerManager.h"
 #include "Character/Boss/AttrenashinTypes.h"
+#include "Character/Boss/AttrenashinTrajectory.h"
+#include "CollisionResponseSnapshot.h"
 #include "AttrenashinBoss.generated.h"
 
 class UPrimitiveComponent;
+class AAttrenashinBoss;
+
+// 보스 동작 단위별 틱 함수 슬롯(활성 구간에만 켜진다)
+enum class EAttrenashinTickSlot : uint8
+{
+	ReturnToCenter, // Phase1 캡쳐 실패 후 중앙 복귀
+	Retreat,        // 공포 후퇴 이동
+	Phase1,         // 내려치기 주기/캡쳐 안전망
+	Phase2Flow,     // Phase2/3 상태 머신(박수 포함)
+	Num
+};
+
+MARIOODYSSEY_API const TCHAR* LexToString(EAttrenashinTickSlot Slot);
+
+// 슬롯 하나를 보스의 해당 Update로 연결하는 틱 함수
+struct FAttrenashinPhaseTickFunction : public FTickFunction
+{
+	AAttrenashinBoss* Boss = nullptr;
+	EAttrenashinTickSlot Slot = EAttrenashinTickSlot::Phase1;
+
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
+};
 
 UCLASS()
 class MARIOODYSSEY_API AAttrenashinBoss : public AActor
@@ -17,8 +42,26 @@ public:
 	AAttrenashinBoss();
 
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void Tick(float DeltaSeconds) override;
 
+	// 슬롯별 틱 진입점(FAttrenashinPhaseTickFunction에서 호출)
+	void ExecutePhaseTick(EAttrenashinTickSlot Slot, float DeltaSeconds);
+
+#if !UE_BUILD_SHIPPING
+	// 슬롯별 누적 CPU 비용(mario.BossTickCosts)
+	struct FPhaseTickCost
+	{
+		uint64 Cycles = 0;
+		int32 Calls = 0;
+	};
+
+	const FPhaseTickCost& GetPhaseTickCost(EAttrenashinTickSlot Slot) const { return PhaseTickCosts[(int32)Slot]; }
+	bool IsPhaseTickEnabled(EAttrenashinTickSlot Slot) const { return PhaseTicks[(int32)Slot].IsTickFunctionEnabled(); }
+	float GetPhaseTickInterval(EAttrenashinTickSlot Slot) const { return PhaseTicks[(int32)Slot].TickInterval; }
+	void ResetPhaseTickCosts();
+#endif
+
 	UFUNCTION(BlueprintPure, Category="Boss|Anim")
 	EAttrenashinPhase GetPhase() const { return Phase; }
 
@@ -49,6 +92,16 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Boss|IceShard")
 	void StartIceRainByBothFists();
 
+	// 샤드/타일 풀 미리 생성(아레나 컨트롤러가 보스 스폰 직후 호출)
+	void PrewarmIceShardPool(int32 ShardCount, int32 TileCount);
+
+	// 아레나 리셋 중 보스 스폰 전에 CDO 기준으로 풀을 채울 때 사용
+	TSubclassOf<class AIceShardActor> GetIceShardClass() const { return IceShardClass; }
+	TSubclassOf<class AIceTileActor> GetIceTileClass() const { return IceTileClass; }
+
+	// 소유 아레나(ABossArenaController)가 캐시한 바닥 높이. 아레나 없음/격자 미완성/격자 밖이면 false(호출자가 트레이스로 대체)
+	bool SampleArenaGroundZ(const FVector& WorldXY, float& OutZ) const;
+
 	// Fist 콜백(캡쳐 시작/해제)
 	void NotifyFistCaptured(class AAttrenashinFist* CapturedFist);
 	void NotifyFistReleased(class AAttrenashinFist* ReleasedFist);
@@ -249,10 +302,23 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category="Boss|Phase3", meta=(ClampMin="0.0"))
 	float Phase3ClapContactHalfDistance = 35.f;
 
+	// 대기 위주 상태(Rest/Spin/ShardRain)의 Phase2 틱 간격. 0이면 매 프레임
+	UPROPERTY(EditDefaultsOnly, Category="Boss|Tick", meta=(ClampMin="0.0"))
+	float PhaseIdleTickInterval = 0.1f;
+
 
 private:
 	EAttrenashinPhase Phase = EAttrenashinPhase::Phase1;
 
+	// 얼음비 분포 랜덤(결정적 모드에서는 시드 고정)
+	FRandomStream RandomStream;
+
+	FAttrenashinPhaseTickFunction PhaseTicks[(int32)EAttrenashinTickSlot::Num];
+
+#if !UE_BUILD_SHIPPING
+	FPhaseTickCost PhaseTickCosts[(int32)EAttrenashinTickSlot::Num];
+#endif
+
 	enum class EPhase2FlowState : uint8
 	{
 		None,
@@ -311,10 +377,8 @@ private:
 	FVector Phase2HeadVelocity = FVector::ZeroVector;
 	FVector Phase2HeadReturnStartWorldLocation = FVector::ZeroVector;
 
-	FVector Phase2DashStartL = FVector::ZeroVector;
-	FVector Phase2DashStartR = FVector::ZeroVector;
-	FVector Phase2DashTargetL = FVector::ZeroVector;
-	FVector Phase2DashTargetR = FVector::ZeroVector;
+	FAttrenashinTrajectory Phase2DashL;
+	FAttrenashinTrajectory Phase2DashR;
 
 	float SlamAttemptTimer = 0.f;
 	bool bNextLeft = true;
@@ -367,8 +431,13 @@ private:
 	float RetreatT = 0.f;
 	bool bWorldDynamicIgnoredForRetreat = false;
 
-	TMap<TObjectPtr<UPrimitiveComponent>, TEnumAsByte<ECollisionResponse>> CachedWorldDynamicResponses;
-	TMap<TObjectPtr<UPrimitiveComponent>, TEnumAsByte<ECollisionResponse>> CachedWorldStaticResponses;
+	// Retreat 중 월드 충돌 무시 대상(BeginPlay에서 1회 수집). 진입 시 설정 전체를 저장했다가 복귀 시 그대로 되돌린다
+	struct FRetreatCollisionSlot
+	{
+		TWeakObjectPtr<UPrimitiveComponent> Component;
+		FCollisionResponseSnapshot Saved;
+	};
+	TArray<FRetreatCollisionSlot> RetreatCollisionSlots;
 
 	// 캡쳐 카운터 샤드 상태
 	FTimerHandle CaptureBarrageTimerHandle;
@@ -395,6 +464,12 @@ private:
 	void UpdatePhase1CaptureFailReturnToCenter(float DeltaSeconds);
 	void StartRetreatMotion();
 	void UpdateRetreat(float DeltaSeconds);
+	void SetRetreating(bool bNewRetreating);
+
+	void RegisterPhaseTicks();
+	void RefreshPhaseTicks();
+	float GetPhase2TickInterval() const;
+	void UpdatePhase1(float DeltaSeconds);
 
 	void StartCaptureBarrage(class AAttrenashinFist* CapturedFist);
 	void StopCaptureBarrage();
@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "Character/Monster/MonsterCharacterBase.h"
 #include "Character/Boss/AttrenashinTypes.h"
+#include "Character/Boss/AttrenashinTrajectory.h"
 #include "AttrenashinFist.generated.h"
 
 UCLASS()
@@ -13,6 +14,8 @@ class MARIOODYSSEY_API AAttrenashinFist : public AMonsterCharacterBase
 public:
 	AAttrenashinFist();
 
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void Tick(float DeltaSeconds) override;
 
 	void InitFist(class AAttrenashinBoss* InBoss, EFistSide InSide, class USceneComponent* InAnchor);
@@ -112,6 +115,9 @@ private:
 	FVector SeqSlamDownTargetLoc = FVector::ZeroVector;
 	bool bPendingStun = false;
 
+	// 현재 이동 구간(호버/내려치기/앵커 복귀). 경과 시간은 SlamSeqT/ReturnT
+	FAttrenashinTrajectory Motion;
+
 	UPROPERTY(EditDefaultsOnly, Category="Attrenashin|IceRain", meta=(ClampMin="0.01"))
 	float IceRainRiseSeconds = 1.33f;
 
@@ -122,13 +128,17 @@ private:
 	float IceRainRiseZ = 800.f;
 
 	float IceRainT = 0.f;
-	FVector IceRainStartLoc = FVector::ZeroVector;
-	FVector IceRainApexLoc = FVector::ZeroVector;
-	FVector IceRainImpactLoc = FVector::ZeroVector;
+	FAttrenashinTrajectory IceRainRise;
+	FAttrenashinTrajectory IceRainDrop;
 	bool bIceRainImpactFired = false;
 
 	float ReturnT = 0.f;
 	float ReturnDuration = 2.f;
+	FRotator ReturnStartRot = FRotator::ZeroRotator;
+
+	// 착지 지점까지 남은 높이가 이 이하일 때만 스윕(그 위 구간은 곡선 위치로 바로 이동)
+	UPROPERTY(EditDefaultsOnly, Category="Attrenashin|Motion", meta=(ClampMin="0.0"))
+	float ImpactSweepHeight = 300.f;
 
 	FVector2D Steer = FVector2D::ZeroVector;
 
@@ -206,7 +216,10 @@ private:
 
 	void TickSlamSequence(float Dt);
 	FVector GetDesiredHoverLocation() const;
-	void MoveTowardAdaptive(const FVector& Target, float Dt, float TimeRemaining, float MaxSpeed, bool bSweep);
+	void BeginHoverMotion(float DurationSeconds);
+	void MoveAlongMotion(const FVector& Desired, float Dt, float MaxSpeed);
+	void MoveTowardImpact(const FVector& Desired, const FVector& Impact);
+	float ResolveGroundZ(const FVector& WorldXY) const;
 
 	void BeginSlamDown();
 	void TickSlamDown(float Dt);
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * 주먹 이동 구간 1개(닫힌 형태 곡선).
+ * 구간 시작 후 경과 시간만으로 위치를 계산하므로 프레임마다 남은 시간으로 속도를 다시 구하지 않는다.
+ * - Evaluate: Start -> End 고정 곡선(내려치기/얼음비/대시)
+ * - EvaluateTracking: 움직이는 목표 추적(호버/앵커 복귀). 시작 시점의 목표 대비 오프셋이 곡선에 따라 0으로 줄어든다
+ */
+struct FAttrenashinTrajectory
+{
+	enum class EEase : uint8
+	{
+		Linear,
+		EaseIn,
+		EaseOut,
+	};
+
+	FVector Start = FVector::ZeroVector;
+	FVector End = FVector::ZeroVector;
+	float Duration = 0.f;
+	EEase Ease = EEase::Linear;
+	float EaseExp = 2.f;
+
+	static FAttrenashinTrajectory Make(const FVector& InStart, const FVector& InEnd, float InDuration, EEase InEase = EEase::Linear, float InEaseExp = 2.f)
+	{
+		FAttrenashinTrajectory Out;
+		Out.Start = InStart;
+		Out.End = InEnd;
+		Out.Duration = FMath::Max(0.f, InDuration);
+		Out.Ease = InEase;
+		Out.EaseExp = InEaseExp;
+		return Out;
+	}
+
+	// 0 ~ 1 진행도(곡선 적용 후)
+	float GetAlpha(float Elapsed) const
+	{
+		const float T = (Duration > KINDA_SMALL_NUMBER) ? FMath::Clamp(Elapsed / Duration, 0.f, 1.f) : 1.f;
+		switch (Ease)
+		{
+		case EEase::EaseIn:  return FMath::InterpEaseIn(0.f, 1.f, T, EaseExp);
+		case EEase::EaseOut: return FMath::InterpEaseOut(0.f, 1.f, T, EaseExp);
+		default:             return T;
+		}
+	}
+
+	bool IsFinished(float Elapsed) const { return Elapsed >= Duration; }
+
+	FVector Evaluate(float Elapsed) const
+	{
+		return FMath::Lerp(Start, End, GetAlpha(Elapsed));
+	}
+
+	// End는 구간 시작 시점의 목표 위치
+	FVector EvaluateTracking(float Elapsed, const FVector& TargetNow) const
+	{
+		return TargetNow + (Start - End) * (1.f - GetAlpha(Elapsed));
+	}
+};
@@ -19,12 +19,21 @@ class MARIOODYSSEY_API AIceShardActor : public AActor
 public:
 	AIceShardActor();
 
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	// 기본 얼음비 샤드(바닥 충돌 시 타일 생성)
 	void InitShard(AActor* InOwnerBoss, float InDamage, TSubclassOf<class AIceTileActor> InIceTileClass, float InIceTileZOffset);
 
 	// 캡쳐 카운터 샤드(플레이어 데미지 없음, 캡쳐된 주먹 타격 시 카운트)
 	void InitBarrageShard(AActor* InOwnerBoss, class AAttrenashinFist* InCapturedFist, const FVector& InVelocity);
 
+	// 풀링(UIceShardPoolSubsystem) 전용
+	void MarkPooled();
+	bool IsPooled() const { return bPooled; }
+	void ActivateFromPool(const FVector& Location, const FRotator& Rotation, AActor* InOwner);
+	void DeactivateToPool();
+
 protected:
 	UPROPERTY(VisibleAnywhere)
 	TObjectPtr<USceneComponent> Root = nullptr;
@@ -62,6 +71,12 @@ private:
 	bool bDamagedMario = false;
 	bool bStopped = false;
 
+	bool bPooled = false;
+	FTimerHandle PooledLifeTimerHandle;
+
+	// 풀 소속이면 풀로 반환, 아니면 Destroy
+	void RetireShard();
+
 	UFUNCTION()
 	void OnBeginOverlap(UPrimitiveComponent* OverlappedComp, AActor* OtherActor,
 	                    UPrimitiveComponent* OtherComp, int32 OtherBodyIndex,
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "IceShardPoolSubsystem.generated.h"
+
+class AIceShardActor;
+class AIceTileActor;
+
+// 풀 적중/미스 통계(아레나별 프리웜 개수 튜닝용)
+USTRUCT(BlueprintType)
+struct FIceShardPoolStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category="IceShardPool")
+	int32 ShardHits = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category="IceShardPool")
+	int32 ShardMisses = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category="IceShardPool")
+	int32 ShardPeakActive = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category="IceShardPool")
+	int32 TileHits = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category="IceShardPool")
+	int32 TileMisses = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category="IceShardPool")
+	int32 TilePeakActive = 0;
+};
+
+/**
+ * 얼음비/카운터 배러지 샤드와 얼음 타일 재사용 풀.
+ * Spawn/Destroy 대신 비활성(숨김 + 충돌/이동 off) 상태로 보관했다가 재활성화한다.
+ */
+UCLASS()
+class MARIOODYSSEY_API UIceShardPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	// 보스 스폰 시점에 미리 생성(이미 보유한 수만큼은 건너뜀)
+	// MaxSpawns로 이번 호출에서 만들 개수를 제한하면 여러 프레임에 나눠 채울 수 있다. 반환값은 이번에 만든 개수
+	int32 Prewarm(TSubclassOf<AIceShardActor> ShardClass, int32 ShardCount, TSubclassOf<AIceTileActor> TileClass, int32 TileCount, int32 MaxSpawns = MAX_int32);
+
+	AIceShardActor* AcquireShard(TSubclassOf<AIceShardActor> ShardClass, const FVector& Location, const FRotator& Rotation, AActor* InOwner);
+	void ReleaseShard(AIceShardActor* Shard);
+
+	AIceTileActor* AcquireTile(TSubclassOf<AIceTileActor> TileClass, const FVector& Location, const FRotator& Rotation, AActor* InOwner);
+	void ReleaseTile(AIceTileActor* Tile);
+
+	// 재도전/클리어 시 사용 중인 샤드/타일 전부 풀로 회수
+	void RecycleAllActive() { RecycleActive(MAX_int32); }
+
+	// 최대 MaxCount개만 회수(프레임 분할용). 반환값은 남은 사용 중 개수
+	int32 RecycleActive(int32 MaxCount);
+
+	UFUNCTION(BlueprintPure, Category="IceShardPool")
+	FIceShardPoolStats GetPoolStats() const { return Stats; }
+
+	UFUNCTION(BlueprintCallable, Category="IceShardPool")
+	void ResetPoolStats() { Stats = FIceShardPoolStats(); }
+
+private:
+	UPROPERTY()
+	TArray<TObjectPtr<AIceShardActor>> FreeShards;
+
+	UPROPERTY()
+	TArray<TObjectPtr<AIceShardActor>> ActiveShards;
+
+	UPROPERTY()
+	TArray<TObjectPtr<AIceTileActor>> FreeTiles;
+
+	UPROPERTY()
+	TArray<TObjectPtr<AIceTileActor>> ActiveTiles;
+
+	FIceShardPoolStats Stats;
+
+	AIceShardActor* SpawnPooledShard(TSubclassOf<AIceShardActor> ShardClass, const FVector& Location, const FRotator& Rotation);
+	AIceTileActor* SpawnPooledTile(TSubclassOf<AIceTileActor> TileClass, const FVector& Location, const FRotator& Rotation);
+};
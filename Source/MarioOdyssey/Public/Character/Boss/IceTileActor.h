@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "World/IceTileGridSubsystem.h"
 #include "IceTileActor.generated.h"
 
 UCLASS()
@@ -12,6 +13,19 @@ class MARIOODYSSEY_API AIceTileActor : public AActor
 public:
 	AIceTileActor();
 
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	// 풀링(UIceShardPoolSubsystem) 전용
+	void MarkPooled() { bPooled = true; }
+	bool IsPooled() const { return bPooled; }
+	void ActivateFromPool(const FVector& Location, const FRotator& Rotation, AActor* InOwner);
+	void DeactivateToPool();
+
+	// 인스턴스 묶음(UIceTileBatchComponent)이 CDO에서 메시/크기를 가져갈 때 사용
+	const class UBoxComponent* GetTileBox() const { return Box; }
+	const class UStaticMeshComponent* GetTileMesh() const { return Mesh; }
+
 protected:
 	UPROPERTY(VisibleAnywhere)
 	TObjectPtr<USceneComponent> Root = nullptr;
@@ -21,4 +35,13 @@ protected:
 
 	UPROPERTY(VisibleAnywhere)
 	TObjectPtr<class UStaticMeshComponent> Mesh = nullptr;
+
+private:
+	bool bPooled = false;
+
+	// 얼음 점유 격자에 기록한 영역(활성 중에만 등록)
+	FIceTileFootprint IceFootprint;
+
+	void RegisterIceFootprint();
+	void UnregisterIceFootprint();
 };
@@ -100,7 +100,6 @@ private:
 
 	// spawn grace
 	bool bSpawnGraceActive = false;
-	FTimerHandle SpawnGraceTimer;
 
 	void EndSpawnGrace();
 };
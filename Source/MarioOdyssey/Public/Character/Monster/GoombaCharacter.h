@@ -142,7 +142,6 @@ protected:
 	void Input_JumpStarted_Stack(const FInputActionValue& Value);
 	void Input_JumpCompleted_Stack(const FInputActionValue& Value);
 	void Input_ReleaseCapture_Passthrough(const FInputActionValue& Value);
-	void ClearCapturedHitStun_Proxy();
 
 	void ApplyCapturedSpeedToStackRoot();
 
@@ -189,6 +188,9 @@ private:
 	FVector PatrolTarget = FVector::ZeroVector;
 	bool bHasPatrolTarget = false;
 
+	// 결정적 모드 전용 순찰 목적지 랜덤(평상시에는 GetRandomReachablePointInRadius 사용)
+	FRandomStream PatrolRandom;
+
 	float LookAroundRemain = 0.f;
 	float ReturnHomeTimer = 0.f;
 
@@ -204,6 +206,7 @@ private:
 	AAIController* GetAICon() const;
 
 	void UpdatePatrol(float Dt);
+	bool PickPatrolPoint(FVector& OutLocation);
 	void UpdateChase(float Dt, AActor* Target);
 	void UpdateLookAround(float Dt);
 	void UpdateReturnHome(float Dt);
@@ -5,6 +5,7 @@
 #include "Capture/CapturableInterface.h"
 #include "Components/SphereComponent.h"
 #include "InputAction.h"
+#include "ActorTimeline.h"
 #include "MonsterCharacterBase.generated.h"
 
 struct FInputActionValue;
@@ -21,6 +22,7 @@ public:
 	AMonsterCharacterBase();
 
 	virtual void BeginPlay() override;
+	virtual void Tick(float DeltaSeconds) override;
 	virtual void SetupPlayerInputComponent(UInputComponent* PlayerInputComponent) override;
 
 protected:
@@ -142,7 +144,13 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category="Monster|Capture")
 	float CapturedHitKnockbackUp = 140.f;
 
-	FTimerHandle CapturedHitStunTimer;
+	// 몬스터 계열 예약 작업(월드 타이머 대신 몬스터 Tick에서 진행)
+	enum class ETimelineTag : uint8
+	{
+		CapturedHitStun,
+		SpawnGrace, // BulletBill
+	};
+	TActorTimeline<AMonsterCharacterBase, ETimelineTag, 4> Timeline;
 
 	void ClearCapturedHitStun();
 
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+
+class UPrimitiveComponent;
+
+/**
+ * 프리미티브 하나의 충돌 설정 전체(켜짐 종류 + 오브젝트 타입 + 채널 응답 컨테이너). 값 타입이라 힙 할당 없음.
+ * ApplyTo는 현재 값과 다른 항목만 바꾸고, 채널 응답은 SetCollisionResponseToChannel을 채널마다 부르는 대신
+ * 컨테이너를 통째로 1회 교체한다(채널 호출마다 일어나던 물리 필터 갱신을 1회로).
+ */
+struct MARIOODYSSEY_API FCollisionResponseSnapshot
+{
+	FCollisionResponseContainer Responses;
+	TEnumAsByte<ECollisionEnabled::Type> Enabled = ECollisionEnabled::NoCollision;
+	TEnumAsByte<ECollisionChannel> ObjectType = ECC_WorldDynamic;
+
+	// 액터 충돌 on/off와 무관한 컴포넌트 자체 값
+	static FCollisionResponseSnapshot Capture(const UPrimitiveComponent* Component);
+
+	// 프로젝트 세팅 프로필 템플릿(없는 이름이면 기본값 + 경고)
+	static FCollisionResponseSnapshot FromProfile(FName ProfileName);
+
+	FCollisionResponseSnapshot& SetResponse(ECollisionChannel Channel, ECollisionResponse Response)
+	{
+		Responses.SetResponse(Channel, Response);
+		return *this;
+	}
+
+	FCollisionResponseSnapshot& SetAllResponses(ECollisionResponse Response)
+	{
+		Responses.SetAllChannels(Response);
+		return *this;
+	}
+
+	FCollisionResponseSnapshot& SetEnabled(ECollisionEnabled::Type InEnabled)
+	{
+		Enabled = InEnabled;
+		return *this;
+	}
+
+	// 이미 같으면 아무것도 하지 않는다. 실제로 바꾼 게 있으면 true
+	bool ApplyTo(UPrimitiveComponent* Component) const;
+};
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "InputActionValue.h"
+#include "InputReplaySubsystem.generated.h"
+
+class UInputAction;
+class UEnhancedInputLocalPlayerSubsystem;
+
+/**
+ * Enhanced Input 기록/재생.
+ * - 기록: 매 프레임 플레이어 매핑 컨텍스트(IMC_Player)의 액션 값을 읽어 "바뀐 것만" 프레임 번호와 함께 저장
+ *   (캡쳐 중 Pawn도 같은 액션 에셋을 바인딩하므로 캡쳐 조작까지 함께 기록됨)
+ * - 재생: 같은 프레임에 같은 값을 InjectInputForAction으로 주입
+ * - 파일에는 결정적 모드 설정(시드/스텝)을 같이 저장하고 재생 시 그대로 켠다 -> 고정 스텝 + 렌더 대기 없음으로 실시간보다 빠르게 재생
+ *
+ * 기록: -DeterministicSim -InputRecord=<file>            또는 콘솔 input.Record <file> / input.Stop
+ * 재생: -nullrhi -InputReplay=<file> [-InputReplayQuit]   또는 콘솔 input.Replay <file>
+ */
+UCLASS()
+class MARIOODYSSEY_API UInputReplaySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UInputReplaySubsystem* Get(const UObject* WorldContextObject);
+
+	// Shipping에서는 만들지 않는다(개발용)
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickable() const override { return Mode != EMode::Idle || !PendingPath.IsEmpty(); }
+
+	bool StartRecording(const FString& Path);
+	bool StartReplay(const FString& Path);
+	void Stop();
+
+	bool IsRecording() const { return Mode == EMode::Recording; }
+	bool IsReplaying() const { return Mode == EMode::Replaying; }
+
+private:
+	enum class EMode : uint8
+	{
+		Idle,
+		Recording,
+		Replaying,
+	};
+
+	struct FInputEvent
+	{
+		uint32 Frame = 0;
+		uint8 ActionIndex = 0;
+		FVector Value = FVector::ZeroVector;
+	};
+
+	EMode Mode = EMode::Idle;
+
+	// 커맨드라인 자동 시작 대기(마리오/입력 세팅 이후 시작)
+	EMode PendingMode = EMode::Idle;
+	FString PendingPath;
+	bool bQuitWhenDone = false;
+
+	FString FilePath;
+	uint32 Frame = 0;
+	double StartWallSeconds = 0.0;
+
+	UPROPERTY()
+	TArray<TObjectPtr<const UInputAction>> Actions;
+
+	TArray<FVector> LastValues;
+	TArray<FInputEvent> Events;
+	int32 NextEvent = 0;
+
+	bool GatherActions();
+	UEnhancedInputLocalPlayerSubsystem* GetInputSubsystem() const;
+
+	void TickRecord();
+	void TickReplay();
+
+	bool SaveRecording() const;
+	bool LoadRecording(const FString& Path, int32& OutSeed, float& OutStepHz, int32& OutSubsteps);
+
+	// LoadRecording으로 읽어 둔 Actions/Events로 재생 시작
+	void BeginReplay(const FString& Path);
+};
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if !UE_BUILD_SHIPPING
+#include "HAL/IConsoleManager.h"
+#include "Capture/PlayerTargetSubsystem.h"
+#include "MarioOdyssey/MarioOdysseyStats.h"
+
+class AMarioCharacter;
+class UWorld;
+
+/**
+ * 측정 대상 시스템 .cpp 옆에 두는 개발용 벤치 커맨드 공용 도우미(Shipping 제외).
+ * - 커맨드 1개 = FMarioBenchCommand 정적 변수 1개(월드 없으면 실행하지 않음)
+ * - 결과는 LogMarioBench(MarioOdysseyStats.h)로 출력
+ */
+namespace MarioBench
+{
+	// Index번째 정수 인자. 없으면 Default, Min 미만이면 Min
+	inline int32 IntArg(const TArray<FString>& Args, int32 Index, int32 Default, int32 Min = 1)
+	{
+		return Args.IsValidIndex(Index) ? FMath::Max(Min, FCString::Atoi(*Args[Index])) : Default;
+	}
+
+	inline float FloatArg(const TArray<FString>& Args, int32 Index, float Default)
+	{
+		return Args.IsValidIndex(Index) ? FCString::Atof(*Args[Index]) : Default;
+	}
+
+	// 레지스트리의 원본 마리오(캡쳐 중에도 같은 액터)
+	inline AMarioCharacter* FindMario(const UWorld* World)
+	{
+		const UPlayerTargetSubsystem* Targets = UPlayerTargetSubsystem::Get(World);
+		return Targets ? Targets->GetMario() : nullptr;
+	}
+}
+
+struct FMarioBenchCommand : public FAutoConsoleCommandWithWorldAndArgs
+{
+	using FRunFunc = TFunction<void(const TArray<FString>& Args, UWorld* World)>;
+
+	FMarioBenchCommand(const TCHAR* Name, const TCHAR* Help, FRunFunc Run)
+		: FAutoConsoleCommandWithWorldAndArgs(Name, Help,
+			FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([Run = MoveTemp(Run)](const TArray<FString>& Args, UWorld* World)
+			{
+				if (World)
+				{
+					Run(Args, World);
+				}
+			}))
+	{
+	}
+};
+#endif
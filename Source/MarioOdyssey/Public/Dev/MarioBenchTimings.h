@@ -0,0 +1,65 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+
+/**
+ * 마리오 컨트롤러 구간별 누적 사이클(벤치마크 전용).
+ * AMarioCharacter::BenchTimings가 nullptr이면 측정하지 않는다(평상시 비용 = 분기 1회).
+ */
+struct FMarioBenchTimings
+{
+	uint64 TickCycles = 0;
+	uint64 DownhillBoostCycles = 0;
+	uint64 WallSlideCycles = 0;
+	uint64 MovementCycles = 0;
+
+	void Reset() { *this = FMarioBenchTimings(); }
+};
+
+// Accum이 nullptr이면 아무것도 하지 않는 구간 타이머
+struct FMarioBenchScope
+{
+	explicit FMarioBenchScope(uint64* InAccum)
+		: Accum(InAccum)
+		, Start(InAccum ? FPlatformTime::Cycles64() : 0)
+	{
+	}
+
+	~FMarioBenchScope()
+	{
+		if (Accum)
+		{
+			*Accum += FPlatformTime::Cycles64() - Start;
+		}
+	}
+
+private:
+	uint64* Accum;
+	uint64 Start;
+};
+
+// 벤치 샘플(ms) 요약. 각 시스템 옆에 있는 개발용 벤치 커맨드가 같이 쓴다
+struct FMarioBenchSampleStats
+{
+	double Avg = 0.0;
+	double P50 = 0.0;
+	double P95 = 0.0;
+	double Max = 0.0;
+
+	static FMarioBenchSampleStats Compute(TArray<double> Values)
+	{
+		FMarioBenchSampleStats Out;
+		if (Values.Num() == 0) return Out;
+
+		Values.Sort();
+		double Sum = 0.0;
+		for (const double V : Values) Sum += V;
+
+		Out.Avg = Sum / Values.Num();
+		Out.P50 = Values[Values.Num() / 2];
+		Out.P95 = Values[FMath::Min(Values.Num() - 1, (Values.Num() * 95) / 100)];
+		Out.Max = Values.Last();
+		return Out;
+	}
+};
@@ -0,0 +1,142 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineBaseTypes.h"
+#include "Dev/MarioBenchTimings.h"
+#include "MarioOdyssey/MarioOdysseyStats.h"
+#include "MarioBenchmarkSubsystem.generated.h"
+
+class AMarioCharacter;
+class UInputAction;
+class UMarioBenchmarkSubsystem;
+struct FInputActionValue;
+
+// 벤치마크가 주입하는 입력 종류
+enum class EMarioBenchAction : uint8
+{
+	Jump,
+	Crouch,
+	Run,
+	ThrowCap,
+};
+
+// CharacterMovement 틱 앞/뒤에 끼워 넣는 측정용 틱 함수
+struct FMarioBenchTickBracket : public FTickFunction
+{
+	UMarioBenchmarkSubsystem* Owner = nullptr;
+	bool bIsStart = true;
+
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override { return TEXT("FMarioBenchTickBracket"); }
+};
+
+/**
+ * 마리오 컨트롤러 헤드리스 벤치마크.
+ * 스크립트 코스(3단 점프/구르기/엉덩방아/다이브/벽 슬라이드 시도/모자 던지기)를
+ * Enhanced Input 주입으로 N프레임 반복하고 구간별 비용을 CSV/JSON으로 Saved/Profiling/MarioBench에 남긴다.
+ *
+ * 실행 예:
+ *   <Editor>-Cmd <Project> <TestMap> -game -nullrhi -benchmark -fps=60 -MarioBench=5000 -MarioBenchQuit
+ *   또는 콘솔에서 mario.Bench 5000 [Label]
+ *
+ * 타이머 부하 측정: mario.SpawnStress 50 으로 몬스터를 마리오 주변에 깔고 벤치를 돌리면
+ * 결과 JSON의 timer_ops에 FTimerManager 힙 SetTimer/초와 액터 타임라인 Schedule/초가 기록된다.
+ *
+ * 시스템별 벤치 커맨드는 측정 대상 시스템의 .cpp에 있다(전부 Shipping 제외, Dev/MarioBenchCommand.h의 FMarioBenchCommand로 등록):
+ *   mario.SpawnStress(MonsterCharacterBase), mario.BenchSlope(MarioSlope), mario.CapThrowStress(MarioCapProjectile),
+ *   mario.CaptureSpam(CaptureComponent), mario.BossTickCosts(AttrenashinBoss), mario.IceTileStress(IceTileBatchComponent),
+ *   bgm.BenchZonePoll(BgmZoneGrid), mario.DrawLedges(LedgeEdgeSubsystem)
+ * 이 서브시스템과 mario.Bench도 Shipping 빌드에서는 만들어지지 않는다.
+ */
+UCLASS()
+class MARIOODYSSEY_API UMarioBenchmarkSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UMarioBenchmarkSubsystem* Get(const UObject* WorldContextObject);
+
+	// Shipping에서는 만들지 않는다(개발용)
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickable() const override { return bRunning || PendingFrames > 0; }
+
+	// FrameCount 프레임 동안 측정. Label은 결과 파일 이름에 붙는다
+	void StartBenchmark(int32 FrameCount, const FString& Label);
+	void StopBenchmark();
+
+	bool IsRunning() const { return bRunning; }
+
+private:
+	friend struct FMarioBenchTickBracket;
+
+	struct FFrameSample
+	{
+		float DeltaSeconds = 0.f;
+		double TickMs = 0.0;
+		double DownhillBoostMs = 0.0;
+		double WallSlideMs = 0.0;
+		double MovementMs = 0.0;
+	};
+
+	// 코스 단계: 대기/누름/홀드/해제
+	enum class EStepKind : uint8
+	{
+		WaitFrames,
+		WaitGrounded,
+		WaitAirborne,
+		Press,
+		Hold,
+		Release,
+	};
+
+	struct FStep
+	{
+		EStepKind Kind = EStepKind::WaitFrames;
+		EMarioBenchAction Action = EMarioBenchAction::Jump;
+		int32 Frames = 0;
+	};
+
+	TWeakObjectPtr<AMarioCharacter> Mario;
+	FMarioBenchTimings Timings;
+	TArray<FFrameSample> Samples;
+	FMarioTimerOpCounters TimerOpsAtStart;
+
+	FMarioBenchTickBracket MovementStartTick;
+	FMarioBenchTickBracket MovementEndTick;
+	uint64 MovementStartCycles = 0;
+	bool bBracketsRegistered = false;
+
+	bool bRunning = false;
+	bool bQuitWhenDone = false;
+	int32 TargetFrames = 0;
+	int32 PendingFrames = 0;
+	FString RunLabel;
+
+	TArray<FStep> Course;
+	int32 StepIndex = 0;
+	int32 StepFrames = 0;
+	uint8 HeldMask = 0;
+	int32 CourseFrame = 0;
+
+	void BuildCourse();
+	void AdvanceCourse();
+	void InjectHeldInputs();
+	void InjectAction(EMarioBenchAction Action, const FInputActionValue& Value);
+	void InjectRaw(const UInputAction* Action, const FInputActionValue& Value);
+	const UInputAction* ResolveAction(EMarioBenchAction Action) const;
+
+	bool AttachToMario();
+	void DetachFromMario();
+
+	void OnMovementTickStart();
+	void OnMovementTickEnd();
+
+	void WriteResults() const;
+};
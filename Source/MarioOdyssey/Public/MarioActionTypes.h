@@ -60,4 +60,55 @@ enum class ELedgeState : uint8
 	MoveLeft  UMETA(DisplayName="MoveLeft"),
 	MoveRight UMETA(DisplayName="MoveRight"),
 	ClimbEnd  UMETA(DisplayName="ClimbEnd"),
-};
\ No newline at end of file
+};
+// 마리오 행동 상태(한 번에 하나). 테이블(AMarioCharacter::GetMoveStateDesc)로 구동된다.
+UENUM(BlueprintType)
+enum class EMarioMoveState : uint8
+{
+	None               UMETA(DisplayName="None"),
+	RollStart          UMETA(DisplayName="RollStart"),
+	RollLoop           UMETA(DisplayName="RollLoop"),
+	RollEnd            UMETA(DisplayName="RollEnd"),
+	LongJump           UMETA(DisplayName="LongJump"),
+	Backflip           UMETA(DisplayName="Backflip"),
+	PoundJump          UMETA(DisplayName="PoundJump"),
+	Dive               UMETA(DisplayName="Dive"),
+	GroundPoundPrepare UMETA(DisplayName="GroundPoundPrepare"),
+	GroundPound        UMETA(DisplayName="GroundPound"),
+	GroundPoundStun    UMETA(DisplayName="GroundPoundStun"),
+	WallSlideStart     UMETA(DisplayName="WallSlideStart"),
+	WallSlideLoop      UMETA(DisplayName="WallSlideLoop"),
+	WallKick           UMETA(DisplayName="WallKick"),
+	LedgeHangStart     UMETA(DisplayName="LedgeHangStart"),
+	LedgeHang          UMETA(DisplayName="LedgeHang"),
+	LedgeClimb         UMETA(DisplayName="LedgeClimb"),
+
+	Count              UMETA(Hidden)
+};
+
+// 상위 상태(그룹이 바뀔 때만 그룹 Enter/Exit 훅 실행)
+UENUM(BlueprintType)
+enum class EMarioStateGroup : uint8
+{
+	Free        UMETA(DisplayName="Free"),
+	Roll        UMETA(DisplayName="Roll"),
+	Air         UMETA(DisplayName="Air"),
+	GroundPound UMETA(DisplayName="GroundPound"),
+	Wall        UMETA(DisplayName="Wall"),
+	Ledge       UMETA(DisplayName="Ledge"),
+
+	Count       UMETA(Hidden)
+};
+
+// AnimStateWord 플래그 비트(MarioAnimWord::FlagShift + 값)
+UENUM(BlueprintType)
+enum class EMarioAnimFlag : uint8
+{
+	Crouched         UMETA(DisplayName="Crouched"),
+	Running          UMETA(DisplayName="Running"),
+	DownhillBoosting UMETA(DisplayName="DownhillBoosting"),
+	HitStun          UMETA(DisplayName="HitStun"),
+	Dead             UMETA(DisplayName="Dead"),
+	PoundJumpWindow  UMETA(DisplayName="PoundJumpWindow"),
+	WallOverlapping  UMETA(DisplayName="WallOverlapping"),
+};
@@ -17,6 +17,20 @@ enum class ECapPhase : uint8
 	Returning
 };
 
+// 모자가 비활성(풀)로 돌아간 이유
+enum class ECapRetireReason : uint8
+{
+	Caught,   // 마리오가 받음
+	Captured, // 캡쳐 성공
+	Lost,     // 주인 없음/컴포넌트 누락
+};
+
+DECLARE_DELEGATE_OneParam(FOnCapRetired, ECapRetireReason);
+
+/**
+ * 마리오 1명당 1개를 미리 만들어 두고 던질 때마다 Launch/Retire로 재사용하는 모자.
+ * 단계(Outgoing/Hover/Returning)는 타이머 없이 Tick에서 PhaseElapsed로 진행한다.
+ */
 UCLASS()
 class MARIOODYSSEY_API AMarioCapProjectile : public AActor
 {
@@ -25,7 +39,16 @@ class MARIOODYSSEY_API AMarioCapProjectile : public AActor
 public:
 	AMarioCapProjectile();
 
-	void FireInDirection(const FVector& Dir, float Speed);
+	// 풀에서 꺼내 Location에서 Dir 방향으로 발사(스폰 없음)
+	void Launch(const FVector& Location, const FRotator& Rotation, const FVector& Dir, float Speed);
+
+	// 즉시 비활성화하고 OnRetired로 알림. 이미 비활성이면 무시
+	void Retire(ECapRetireReason Reason);
+
+	bool IsInFlight() const { return bInFlight; }
+
+	// 주인(마리오)이 1회 바인딩
+	FOnCapRetired OnRetired;
 
 	// 홀드 종료
 	void NotifyHoldReleased();
@@ -33,9 +56,14 @@ public:
 protected:
 	virtual void BeginPlay() override;
 	
-	bool TryCaptureTarget(AActor* TargetActor, UPrimitiveComponent* TargetComp, const FHitResult* OptionalHit);
-	
-	bool IsCapturableTarget(AActor* TargetActor, UPrimitiveComponent* TargetComp) const;
+	bool TryCaptureTarget(AActor* TargetActor, const FVector& HitLocation);
+
+	// 0이면 캡쳐 대상 아님. 클 수록 우선(액터 인터페이스 > 컴포넌트 인터페이스 > 태그)
+	uint8 GetCapturePriority(const AActor* TargetActor, const UPrimitiveComponent* TargetComp) const;
+
+	// Hit/Overlap 콜백은 후보만 모으고, Tick에서 한 번에 최선 1개만 캡쳐 시도
+	bool QueueCaptureCandidate(AActor* TargetActor, UPrimitiveComponent* TargetComp, const FHitResult* OptionalHit, bool bFromHit);
+	void ResolveCaptureCandidates();
 
 	UFUNCTION()
 	void OnCapHit(UPrimitiveComponent* HitComp, AActor* OtherActor, UPrimitiveComponent* OtherComp,
@@ -46,10 +74,14 @@ protected:
 	UFUNCTION()
 	void OnProjectileStopped(const FHitResult& ImpactResult);
 
+	void FireInDirection(const FVector& Dir, float Speed);
+
 	void EnterHover();
 	void BeginReturn();
-	void OnMinHoverReached();
-	void OnMaxHoverReached();
+	void TickPhaseClock(float DeltaTime);
+
+	// 숨김/충돌 끔/이동 정지/틱 끔(알림 없음)
+	void DeactivateToPool();
 
 	UPROPERTY(VisibleAnywhere, Category="Cap")
 	USphereComponent* Collision;
@@ -99,10 +131,18 @@ protected:
 
 	bool bHoldReleased = false;     // 키를 뗐는가?
 	bool bMinHoverPassed = false;   // 최소 체공(0.5s) 지났는가?
-
-	FTimerHandle OutgoingTimer;
-	FTimerHandle MinHoverTimer;
-	FTimerHandle MaxHoverTimer;
+	bool bInFlight = false;         // 던져져 있는가(false면 풀에서 대기)
+
+	float PhaseElapsed = 0.f;       // 현재 Phase 진입 후 경과 시간
+
+	struct FCaptureCandidate
+	{
+		TWeakObjectPtr<AActor> Actor;
+		FVector HitLocation = FVector::ZeroVector;
+		uint8 Priority = 0;
+		bool bFromHit = false; // 블록 Hit로 들어온 후보(실패 시 Hover 전환)
+	};
+	TArray<FCaptureCandidate, TInlineAllocator<4>> CaptureCandidates;
 
 	TWeakObjectPtr<AActor> OwnerActor;
 
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/World.h"
+#include "NavigationSystem.h"
+#include "MarioOdyssey/MarioOdysseyStats.h"
+
+/**
+ * 게임플레이 씬 쿼리 진입점.
+ * 여기서만 STAT_MarioOdyssey_SceneQueries를 올리므로 호출부마다 카운트 매크로를 붙일 필요가 없다.
+ * 게임플레이 코드는 UWorld/UNavigationSystemV1 쿼리를 직접 부르지 말고 이 함수들을 쓴다
+ * (쿼리별 비용은 각 호출부의 SCENE_QUERY_STAT 태그로 `stat collisiontags`에서 본다).
+ */
+namespace MarioSceneQuery
+{
+	template <typename... TArgs>
+	bool LineTraceSingleByChannel(const UWorld* World, TArgs&&... Args)
+	{
+		INC_DWORD_STAT(STAT_MarioOdyssey_SceneQueries);
+		return World->LineTraceSingleByChannel(Forward<TArgs>(Args)...);
+	}
+
+	template <typename... TArgs>
+	bool LineTraceSingleByObjectType(const UWorld* World, TArgs&&... Args)
+	{
+		INC_DWORD_STAT(STAT_MarioOdyssey_SceneQueries);
+		return World->LineTraceSingleByObjectType(Forward<TArgs>(Args)...);
+	}
+
+	template <typename... TArgs>
+	bool SweepSingleByChannel(const UWorld* World, TArgs&&... Args)
+	{
+		INC_DWORD_STAT(STAT_MarioOdyssey_SceneQueries);
+		return World->SweepSingleByChannel(Forward<TArgs>(Args)...);
+	}
+
+	template <typename... TArgs>
+	bool SweepSingleByObjectType(const UWorld* World, TArgs&&... Args)
+	{
+		INC_DWORD_STAT(STAT_MarioOdyssey_SceneQueries);
+		return World->SweepSingleByObjectType(Forward<TArgs>(Args)...);
+	}
+
+	template <typename... TArgs>
+	bool OverlapBlockingTestByChannel(const UWorld* World, TArgs&&... Args)
+	{
+		INC_DWORD_STAT(STAT_MarioOdyssey_SceneQueries);
+		return World->OverlapBlockingTestByChannel(Forward<TArgs>(Args)...);
+	}
+
+	// NavMesh 쿼리(물리 씬은 아니지만 같은 카운터로 본다)
+	template <typename... TArgs>
+	bool ProjectPointToNavigation(UNavigationSystemV1* NavSys, TArgs&&... Args)
+	{
+		INC_DWORD_STAT(STAT_MarioOdyssey_SceneQueries);
+		return NavSys->ProjectPointToNavigation(Forward<TArgs>(Args)...);
+	}
+
+	template <typename... TArgs>
+	bool GetRandomReachablePointInRadius(UNavigationSystemV1* NavSys, TArgs&&... Args)
+	{
+		INC_DWORD_STAT(STAT_MarioOdyssey_SceneQueries);
+		return NavSys->GetRandomReachablePointInRadius(Forward<TArgs>(Args)...);
+	}
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/HitResult.h"
+
+class UPrimitiveComponent;
+
+// 바닥 한 면의 경사 평가 결과(바닥 노멀에만 의존)
+struct FMarioSlopeEval
+{
+	FVector2D Downhill2D = FVector2D::ZeroVector; // 수평 내리막 방향(단위 벡터)
+	bool bHasDownhill = false;                    // 평지/수직면이면 false(부스트 강제 해제)
+	bool bSteepEnough = false;                    // 최소 경사각 이상
+};
+
+namespace MarioSlope
+{
+	// 0~90도 각도 -> cos^2 (경사각 >= Deg  <=>  Nz^2 <= cos^2 * |N|^2, Nz > 0)
+	MARIOODYSSEY_API float CosSqFromDegrees(float Degrees);
+
+	/**
+	 * 순수 함수: Acos/정규화 없이 경사 판정 + 내리막 방향 계산.
+	 * 중력(-Z)을 바닥 평면에 투영한 벡터의 XY는 Nz * (Nx, Ny) 이므로
+	 * 수평 내리막 방향은 노멀의 수평 성분 방향(Nz < 0이면 반대)과 같다.
+	 */
+	MARIOODYSSEY_API FMarioSlopeEval Evaluate(const FVector& FloorNormal, float MinSlopeCosSq);
+
+	// 속도 방향이 내리막과 충분히 일치하는가(VelDir 정규화 대신 Speed2D를 곱해 비교)
+	inline bool IsMovingDownhill(const FMarioSlopeEval& Eval, const FVector2D& Vel2D, float Speed2D, float DotThreshold)
+	{
+		return Eval.bHasDownhill && FVector2D::DotProduct(Vel2D, Eval.Downhill2D) >= DotThreshold * Speed2D;
+	}
+}
+
+/**
+ * 바닥 (컴포넌트, 면 인덱스, 노멀) 단위 경사 캐시.
+ * 같은 면 위를 달리는 동안은 Evaluate를 다시 돌리지 않는다.
+ * CharacterMovement 바닥 스윕은 보통 FaceIndex를 채우지 않으므로(INDEX_NONE) 노멀 비교로 같은 면을 판정한다.
+ */
+struct MARIOODYSSEY_API FMarioSlopeCache
+{
+	const FMarioSlopeEval& Get(const FHitResult& FloorHit, float MinSlopeAngleDeg);
+	void Invalidate() { bValid = false; }
+
+	// 벤치/디버그용
+	uint32 NumEvaluations = 0;
+	uint32 NumLookups = 0;
+
+private:
+	TWeakObjectPtr<UPrimitiveComponent> Component;
+	int32 FaceIndex = INDEX_NONE;
+	FVector Normal = FVector::ZeroVector;
+
+	float CachedMinSlopeAngleDeg = -1.f;
+	float MinSlopeCosSq = 0.f;
+
+	FMarioSlopeEval Eval;
+	bool bValid = false;
+};
@@ -3,29 +3,82 @@
 #include "CoreMinimal.h"
 #include "MarioActionTypes.h"
 
-//  USTRUCT로 바꿀 수 있음.
+// 상태별 동작 플래그(테이블에서 조회)
+enum class EMarioStateFlags : uint8
+{
+	None      = 0,
+	BlockMove = 1 << 0, // Move 입력 무시
+	NoBoost   = 1 << 1, // 내리막 부스트 금지
+};
+ENUM_CLASS_FLAGS(EMarioStateFlags);
+
+/**
+ * 상태 테이블 한 줄.
+ * Duration(0 이하 = 무제한)이 지나면 OnTimeout을, 없으면 NextOnTimeout으로 전이한다.
+ * Enter/Exit/Tick 훅은 전이를 일으키지 않는다(OnTimeout만 직접 전이 가능).
+ */
+template <typename OwnerType>
+struct TMarioStateDesc
+{
+	EMarioStateGroup Group = EMarioStateGroup::Free;
+	EMarioStateFlags Flags = EMarioStateFlags::None;
+
+	float OwnerType::* Duration = nullptr;
+	EMarioMoveState NextOnTimeout = EMarioMoveState::None;
+	void (OwnerType::* OnTimeout)() = nullptr;
+
+	void (OwnerType::* OnEnter)(EMarioMoveState PrevState) = nullptr;
+	void (OwnerType::* OnExit)(EMarioMoveState NextState) = nullptr;
+	void (OwnerType::* OnTick)(float DeltaSeconds) = nullptr;
+};
+
+template <typename OwnerType>
+struct TMarioStateGroupDesc
+{
+	void (OwnerType::* OnEnter)(EMarioMoveState PrevState) = nullptr;
+	void (OwnerType::* OnExit)(EMarioMoveState NextState) = nullptr;
+};
+
 //  C++에서만 관리하는 컨테이너.
+//  상태별 타이머는 FTimerHandle 대신 경과/잔여 시간으로 들고 Tick에서 한 번에 진행한다.
 struct FMarioState
 {
-	EMarioAirAction     AirAction = EMarioAirAction::None;
-	EMarioGroundAction  GroundAction = EMarioGroundAction::None;
-	EGroundPoundPhase   GroundPound = EGroundPoundPhase::None;
+	EMarioMoveState MoveState = EMarioMoveState::None;
+	float StateElapsed = 0.f; // 현재 상태 진입 후 경과
 
-	bool bRunHeld = false;
-	bool bCrouchHeld = false;
+	// 공중기 출처(벽 슬라이드/킥을 거쳐도 착지 전까지 유지)
+	EMarioAirAction AirOrigin = EMarioAirAction::None;
 
-	// 반동 점프 창
+	// 반동 점프 창(GroundPoundStun 안에서만 의미)
 	bool bPoundJumpWindowOpen = false;
-	bool bPoundJumpConsumed = false;
 
 	// 공중 1회 제한
 	bool bGroundPoundUsed = false;
 
-	// 게이트 (지금 코드의 Move 차단 조건을 여기로 모으는 용도)
-	bool CanMove() const
-	{
-		return !(GroundPound == EGroundPoundPhase::Preparing
-			  || GroundPound == EGroundPoundPhase::Pounding
-			  || GroundPound == EGroundPoundPhase::Stunned);
-	}
+	// 상태와 독립적으로 겹치는 카운트다운(0 = 꺼짐)
+	float HitStunRemaining = 0.f;
+	float WallKickLockRemaining = 0.f;
+
+	// 잡고 있는 모서리(월드 공간 사본, Ledge 그룹 안에서만 의미)
+	FVector LedgeOrigin = FVector::ZeroVector;
+	FVector LedgeTangent = FVector::ZeroVector;
+	FVector LedgeNormal = FVector::ZeroVector; // 바깥(마리오 쪽) 수평 노멀
+	float LedgeLength = 0.f;
+	float LedgeParam = 0.f;   // 모서리 시작점부터 잡은 위치까지 거리
+	int8 LedgeShimmyDir = 0;  // -1 왼쪽 / 0 정지 / 1 오른쪽(마리오 기준)
+	FVector2D LedgeMoveInput = FVector2D::ZeroVector; // 매달린 동안의 Move 입력(Tick에서 소비)
 };
+
+// AnimBP용 패킹 상태 워드 레이아웃
+namespace MarioAnimWord
+{
+	constexpr int32 MoveStateShift = 0;  // 8비트 EMarioMoveState
+	constexpr int32 GroupShift     = 8;  // 4비트 EMarioStateGroup
+	constexpr int32 AirOriginShift = 12; // 4비트 EMarioAirAction
+	constexpr int32 JumpStageShift = 16; // 2비트 (0~3)
+	constexpr int32 FlagShift      = 20; // EMarioAnimFlag 비트들
+
+	constexpr int32 MoveStateMask = 0xFF;
+	constexpr int32 NibbleMask    = 0xF;
+	constexpr int32 JumpStageMask = 0x3;
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TimerManager.h"
+#include "MarioOdyssey/MarioOdysseyStats.h"
+
+/**
+ * 게임플레이 FTimerManager 진입점.
+ * 여기서만 STAT_MarioOdyssey_TimersSet과 벤치마크용 누적 카운터를 올린다.
+ * 게임플레이 코드는 SetTimer/SetTimerForNextTick을 직접 부르지 말고 이 함수들을 쓴다.
+ */
+namespace MarioTimers
+{
+	template <typename... TArgs>
+	void Set(FTimerManager& TimerManager, TArgs&&... Args)
+	{
+		MARIO_COUNT_TIMER_SET();
+		TimerManager.SetTimer(Forward<TArgs>(Args)...);
+	}
+
+	template <typename... TArgs>
+	FTimerHandle SetForNextTick(FTimerManager& TimerManager, TArgs&&... Args)
+	{
+		MARIO_COUNT_TIMER_SET();
+		return TimerManager.SetTimerForNextTick(Forward<TArgs>(Args)...);
+	}
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ActorRegistrySubsystem.generated.h"
+
+class ULevel;
+
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnRegisteredActorChanged, AActor* /*Actor*/, bool /*bRegistered*/);
+
+/**
+ * 태그/클래스 인덱스 액터 레지스트리.
+ * - 네이티브 게임플레이 액터(주먹/샤드/타일/BGM 구역 등)는 BeginPlay/EndPlay에서 AutoRegister/AutoUnregister 한 줄로 등록/해제한다.
+ * - 레벨 배치 액터의 태그는 월드 시작/레벨 스트리밍 추가/스폰 시점에 1회 인덱싱한다.
+ * - 액터 파괴/레벨 스트리밍 제거 시 버킷에서 빠진다(버킷은 TSet이라 등록/해제 O(1)).
+ * 조회는 TActorIterator/GetAllActorsOfClass 같은 월드 전체 탐색 없이 일치하는 개수만큼만 비용이 든다.
+ */
+UCLASS()
+class MARIOODYSSEY_API UActorRegistrySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UActorRegistrySubsystem* Get(const UObject* WorldContextObject);
+
+	// Actor 월드의 레지스트리에 등록/해제(레지스트리가 없는 월드면 아무것도 안 함). BeginPlay/EndPlay에서 호출
+	static void AutoRegister(AActor* Actor);
+	static void AutoUnregister(AActor* Actor);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	// 클래스 + 현재 태그로 등록(중복 등록 안전)
+	void RegisterActor(AActor* Actor);
+	void UnregisterActor(AActor* Actor);
+
+	// 태그가 붙은 유효 액터 수집
+	void GetActorsWithTag(FName Tag, TArray<AActor*>& OutActors) const;
+
+	// 등록된 액터 중 Class(하위 포함) 수집
+	void GetActorsOfClass(const UClass* Class, TArray<AActor*>& OutActors) const;
+
+	template <typename T>
+	void GetActorsOfClass(TArray<T*>& OutActors) const
+	{
+		TArray<AActor*> Found;
+		GetActorsOfClass(T::StaticClass(), Found);
+
+		OutActors.Reserve(OutActors.Num() + Found.Num());
+		for (AActor* A : Found)
+		{
+			OutActors.Add(CastChecked<T>(A));
+		}
+	}
+
+	// 클래스 등록/해제 알림(스트리밍 등으로 뒤늦게 들어오는 액터 추적용)
+	FOnRegisteredActorChanged OnRegisteredActorChanged;
+
+private:
+	TMap<FName, TSet<TWeakObjectPtr<AActor>>> ActorsByTag;
+	TMap<const UClass*, TSet<TWeakObjectPtr<AActor>>> ActorsByClass;
+
+	FDelegateHandle ActorSpawnedHandle;
+	FDelegateHandle ActorDestroyedHandle;
+	FDelegateHandle LevelAddedHandle;
+	FDelegateHandle LevelRemovedHandle;
+
+	void IndexTags(AActor* Actor);
+	void UnindexTags(AActor* Actor);
+	void IndexLevelTags(ULevel* Level);
+
+	void HandleActorSpawned(AActor* Actor);
+	void HandleActorDestroyed(AActor* Actor);
+	void HandleLevelAddedToWorld(ULevel* Level, UWorld* InWorld);
+	void HandleLevelRemovedFromWorld(ULevel* Level, UWorld* InWorld);
+};
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+class UWorld;
+
+/**
+ * 아레나 바닥 높이 격자(아레나당 1회 수직 트레이스로 채움).
+ * - WorldStatic만 기록(아레나 바닥). 얼음 타일/캐릭터 등 동적 액터는 들어가지 않는다
+ * - 프레임마다 나눠 채운다(완료 전에는 조회가 false)
+ * - 조회는 셀 꼭짓점 4개 쌍선형 보간. 격자 밖이거나 꼭짓점 중 바닥이 없는 곳이면 false(호출자가 트레이스로 대체)
+ */
+struct MARIOODYSSEY_API FArenaHeightfield
+{
+	// Center(XY) 기준 한 변 2*Radius 정사각형을 CellSize 간격으로 샘플링.
+	// BeginBuild 1회 후 완료될 때까지 프레임마다 StepBuild(예산 내, 최소 1샘플). 완료되면 true
+	void BeginBuild(UWorld* World, const FVector2D& Center, float Radius, float CellSize, float TraceTopZ, float TraceBottomZ, const AActor* IgnoredActor);
+	bool StepBuild(double BudgetSeconds);
+
+	void Reset();
+
+	bool SampleGroundZ(const FVector2D& WorldXY, float& OutZ) const;
+
+	bool IsBuilt() const { return Heights.Num() > 0 && NextSample >= Heights.Num(); }
+	bool IsBuilding() const { return Heights.Num() > 0 && NextSample < Heights.Num(); }
+	int32 GetNumSamples() const { return Heights.Num(); }
+
+private:
+	FVector2D Origin = FVector2D::ZeroVector; // (0,0) 샘플의 월드 XY
+	float CellSize = 0.f;
+	int32 Resolution = 0; // 한 변 샘플 수
+
+	// 바닥이 없는 샘플 표시
+	static constexpr float NoGround = -MAX_flt;
+
+	TArray<float> Heights;
+
+	// 나눠 채우기 상태
+	TWeakObjectPtr<UWorld> BuildWorld;
+	TWeakObjectPtr<const AActor> BuildIgnoredActor;
+	float BuildTopZ = 0.f;
+	float BuildBottomZ = 0.f;
+	int32 NextSample = 0;
+
+	float GetHeight(int32 X, int32 Y) const { return Heights[Y * Resolution + X]; }
+	void TraceSample(UWorld* World, int32 Index);
+};
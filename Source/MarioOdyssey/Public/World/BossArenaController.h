@@ -2,9 +2,12 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "Character/Boss/AttrenashinTypes.h"
+#include "World/ArenaHeightfield.h"
 #include "BossArenaController.generated.h"
 
 class UBoxComponent;
+class UIceTileBatchComponent;
 class UPrimitiveComponent;
 struct FHitResult;
 class AAttrenashinBoss;
@@ -15,8 +18,25 @@ class AMarioCharacter;
 class ALevelSequenceActor;
 class USoundBase;
 class UAudioComponent;
+class ABgmManager;
 struct FTimerHandle;
 
+/** 보스전 BGM 스템 레이어(페이즈가 FromPhase 이상이면 Volume으로, 아니면 무음) */
+USTRUCT(BlueprintType)
+struct FBossBgmStem
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Boss|Audio")
+    TObjectPtr<USoundBase> Sound = nullptr;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Boss|Audio")
+    EAttrenashinPhase FromPhase = EAttrenashinPhase::Phase0;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Boss|Audio", meta=(ClampMin="0.0"))
+    float Volume = 1.0f;
+};
+
 UCLASS()
 class MARIOODYSSEY_API ABossArenaController : public AActor
 {
@@ -35,6 +55,9 @@ public:
     UFUNCTION(BlueprintCallable, Category="Boss|Audio")
     void StopBossBGMNative();
 
+    /** 아레나 바닥 높이(BeginPlay부터 프레임 분할로 1회 채움). 미완성/격자 밖이면 false(호출자가 트레이스로 대체) */
+    bool SampleArenaGroundZ(const FVector& WorldXY, float& OutZ) const { return ArenaHeightfield.SampleGroundZ(FVector2D(WorldXY), OutZ); }
+
     UFUNCTION(BlueprintPure, Category="Boss")
     bool IsEncounterActive() const { return BossActor.IsValid() || bIsCutscenePlaying || bWaitingForBossSpawn || bWaitingForEncounterDelay; }
 
@@ -44,6 +67,10 @@ protected:
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Boss|Encounter")
     TObjectPtr<UBoxComponent> EncounterTrigger;
 
+    /** 샤드가 남기는 얼음 타일 인스턴스 묶음(메시가 비어 있으면 보스 IceTileClass에서 가져옴) */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Boss|Pool")
+    TObjectPtr<UIceTileBatchComponent> IceTileBatch;
+
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Boss|Encounter")
     TSubclassOf<AAttrenashinBoss> BossClass;
 
@@ -117,6 +144,37 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Boss|Encounter", meta=(ClampMin="0.0"))
     float EncounterCutsceneStartDelaySeconds = 2.0f;
 
+    /** 보스 스폰 시 미리 생성해 둘 얼음 샤드/타일 풀 크기(아레나별 튜닝) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Boss|Pool", meta=(ClampMin="0"))
+    int32 IceShardPoolPrewarmCount = 32;
+
+    /** 얼음 타일을 액터 대신 IceTileBatch 인스턴스로 추가(끄면 타일 액터 풀 사용) */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Boss|Pool")
+    bool bBatchIceTiles = true;
+
+    /** bBatchIceTiles가 꺼져 있을 때만 사용 */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Boss|Pool", meta=(ClampMin="0", EditCondition="!bBatchIceTiles"))
+    int32 IceTilePoolPrewarmCount = 96;
+
+    /** 재도전/클리어 정리(잔존 액터 파괴, 풀 회수, 프록시 원복, 풀 프리웜)에 프레임당 쓰는 시간. 최소 1건은 매 프레임 처리 */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Boss|Reset", meta=(ClampMin="0.0", Units="ms"))
+    float ArenaResetBudgetMs = 1.0f;
+
+    /** 풀 회수를 몇 개씩 묶어 예산을 확인할지(프리웜은 SpawnActor라 1개씩) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Boss|Reset", meta=(ClampMin="1"))
+    int32 ArenaResetBatchSize = 8;
+
+    /** 주먹 착지 높이용 바닥 격자(월드 원점 중심, 보스 스폰 높이 기준). 바닥은 고정이라 아레나당 1회만 채운다 */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Boss|Arena", meta=(ClampMin="0.0"))
+    float ArenaHeightfieldRadius = 7600.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Boss|Arena", meta=(ClampMin="50.0"))
+    float ArenaHeightfieldCellSize = 200.f;
+
+    /** 격자 채우기에 프레임당 쓰는 시간. 최소 1샘플은 매 프레임 처리 */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Boss|Arena", meta=(ClampMin="0.0", Units="ms"))
+    float ArenaHeightfieldBudgetMs = 0.5f;
+
     // ===== Audio =====
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Boss|Audio")
     TObjectPtr<USoundBase> BossBattleBGM = nullptr;
@@ -130,6 +188,13 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Boss|Audio", meta=(ClampMin="0.0"))
     float BossBGMFadeOutSeconds = 0.25f;
 
+    /** 비어 있지 않으면 BossBattleBGM 대신 BgmManager 스템으로 재생하고, 보스 페이즈에 따라 레이어를 올린다 */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Boss|Audio")
+    TArray<FBossBgmStem> BossBGMStems;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Boss|Audio", meta=(ClampMin="0.0"))
+    float BossBGMStemFadeSeconds = 1.5f;
+
     UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category="Boss|Audio", meta=(AllowPrivateAccess="true"))
     TObjectPtr<UAudioComponent> BossBgmComp = nullptr;
 
@@ -139,6 +204,10 @@ protected:
 private:
     TWeakObjectPtr<AMarioCharacter> CachedMario;
     TWeakObjectPtr<AAttrenashinBoss> BossActor;
+    TWeakObjectPtr<ABgmManager> CachedBgmManager;
+
+    /** 스템 볼륨을 마지막으로 맞춘 페이즈 */
+    EAttrenashinPhase LastBgmStemPhase = EAttrenashinPhase::Phase0;
 
     bool bHasEncounterStarted = false;
     bool bWaitingForEncounterDelay = false;
@@ -151,6 +220,32 @@ private:
     /** 아레나 진입 -> 컷신 시작 지연 타이머 */
     FTimerHandle EncounterDelayTimerHandle;
 
+    /** 프레임 분할 정리 작업(BeginArenaReset -> 매 Tick StepArenaReset -> OnComplete) */
+    struct FArenaResetJob
+    {
+        bool bActive = false;
+
+        TArray<TWeakObjectPtr<AActor>> PendingDestroys;
+        int32 DestroyIndex = 0;
+
+        TArray<TWeakObjectPtr<AActor>> PendingProxies;
+        int32 ProxyIndex = 0;
+
+        bool bRecyclePool = false;
+        bool bClearTileBatch = false;
+        bool bPrewarmPool = false;
+
+        // 통계(완료 로그)
+        int32 Frames = 0;
+        double WorkSeconds = 0.0;
+
+        TFunction<void()> OnComplete;
+    };
+    FArenaResetJob ArenaReset;
+
+    /** 보스 인스턴스/재도전과 무관하게 아레나가 1회 채워 유지 */
+    FArenaHeightfield ArenaHeightfield;
+
     /** 프록시 원래 상태 캐시(액터 포인터 기준) */
     TArray<TWeakObjectPtr<AActor>> CutsceneProxyCachedActors;
     TArray<FTransform> CutsceneProxyInitialTransforms;
@@ -183,10 +278,20 @@ private:
     void HandleBossDefeated();
     void HandlePlayerEliminated();
 
-    void CleanupLiveBossActors();
+    // 보스 본체는 즉시 제거하고 나머지(주먹/샤드/타일/프록시/풀 프리웜)는 예산 안에서 나눠 처리
+    void BeginArenaReset(bool bRestoreProxies, bool bPrewarmPool, TFunction<void()> OnComplete);
+    void StepArenaReset();
+    void FinishArenaReset();
+    void QueueLiveBossActors();
+    void StartEncounterSequence();
+
+    ABgmManager* ResolveBgmManager();
+    EAttrenashinPhase GetBgmStemPhase() const;
+    void ApplyBossBgmStemPhase(EAttrenashinPhase NewPhase, float FadeSeconds);
 
     void CacheCutsceneProxyInitialTransforms();
     void RestoreCutsceneProxyTransforms();
+    void RestoreCutsceneProxy(AActor* Proxy);
     void SetCutsceneProxyVisible(bool bVisible);
     int32 FindCachedProxyIndex(const AActor* Proxy) const;
     void CollectAllProxyActors(TArray<AActor*>& OutProxies) const;
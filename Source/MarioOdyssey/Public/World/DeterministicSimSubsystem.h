@@ -0,0 +1,66 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DeterministicSimSubsystem.generated.h"
+
+class UCharacterMovementComponent;
+struct FRandomStream;
+
+/**
+ * 결정적(고정 스텝) 시뮬레이션 모드.
+ * - 켜면 엔진 프레임 DeltaTime을 FixedStep으로 고정(FApp 고정 타임스텝) -> Tick/FTimerManager가 모두 같은 간격으로 진행
+ *   (렌더 대기 없이 돌기 때문에 -nullrhi에서는 실시간보다 빠르게 시뮬레이션됨)
+ * - CharacterMovement 서브스텝도 FixedStep / Substeps로 고정
+ * - 게임플레이 랜덤은 액터별 FRandomStream(시드 + 액터 이름)으로 뽑는다
+ *   (레벨에 배치된 액터는 이름이 고정이라 실행 순서와 무관, 런타임 스폰 액터는 스폰 순서가 같을 때만 재현)
+ * - 설정은 월드마다 이 서브시스템이 가진다(Initialize에서 커맨드라인을 읽음)
+ *
+ * 켜는 법: -DeterministicSim [-SimSeed=N] [-SimStepHz=60] [-SimSubsteps=1]  또는 콘솔 sim.Deterministic 1 [Seed] [StepHz]
+ * (콘솔로 켠 경우 현재 월드에만 적용되고 이미 BeginPlay된 액터의 랜덤 스트림은 바뀌지 않는다.
+ *  레벨을 다시 열어도 유지하려면 커맨드라인으로 켠다)
+ */
+UCLASS()
+class MARIOODYSSEY_API UDeterministicSimSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UDeterministicSimSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// WorldContextObject의 월드가 결정적 모드인지(서브시스템이 없으면 false)
+	static bool IsDeterministic(const UObject* WorldContextObject);
+
+	bool IsEnabled() const { return bEnabled; }
+	int32 GetSeed() const { return Seed; }
+	float GetFixedStep() const { return 1.f / StepHz; }
+	int32 GetSubsteps() const { return Substeps; }
+
+	void SetDeterministic(bool bEnable, int32 InSeed, float InStepHz, int32 InSubsteps);
+
+	/**
+	 * 게임플레이 랜덤 스트림 초기화. 액터 월드가 결정적 모드가 아니면 매번 다른 시드.
+	 * Salt는 같은 액터가 스트림을 여러 개 쓸 때 구분용.
+	 */
+	static void InitRandomStream(const AActor* Actor, FRandomStream& OutStream, uint32 Salt = 0);
+
+	// 결정적 모드일 때 CharacterMovement 서브스텝을 고정(Mario/몬스터 BeginPlay에서 호출)
+	static void ApplyToMovement(UCharacterMovementComponent* Move);
+
+private:
+	bool bEnabled = false;
+	int32 Seed = 0;
+	float StepHz = 60.f;
+	int32 Substeps = 1;
+
+	// 모드 해제/월드 종료 시 복구할 엔진 설정(FApp 고정 타임스텝은 프로세스 전체 설정)
+	bool bAppliedToEngine = false;
+	bool bPrevUseFixedTimeStep = false;
+	double PrevFixedDeltaTime = 0.0;
+
+	void ApplyEngineTimeStep();
+	void RestoreEngineTimeStep();
+};
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "World/IceTileGridSubsystem.h"
+#include "IceTileBatchComponent.generated.h"
+
+class AIceTileActor;
+
+/**
+ * 아레나가 소유하는 얼음 타일 인스턴스 묶음.
+ * - 샤드가 남기는 타일을 AIceTileActor 대신 인스턴스 1개로 추가(액터/컴포넌트 수 고정, 인스턴싱으로 렌더)
+ * - 충돌 응답은 타일 Box와 같은 채널. 단 ISM이라 물리 바디는 인스턴스마다 1개이고 모양은 메시의 단순 충돌이다
+ *   (타일 Box 크기가 아님). 타일 메시는 타일 Box와 같은 크기의 박스 단순 충돌 하나만 두어야 하고, 다르면 경고 로그
+ * - 타일마다 UIceTileGridSubsystem에 영역을 기록해 주먹 스턴/마리오 얼음 바닥 판정은 그대로 격자 조회
+ * 메시/타일 크기는 비어 있으면 첫 AddTile 시 타일 클래스 CDO(Mesh/Box)에서 가져온다.
+ */
+UCLASS(ClassGroup=(MarioOdyssey), meta=(BlueprintSpawnableComponent))
+class MARIOODYSSEY_API UIceTileBatchComponent : public UInstancedStaticMeshComponent
+{
+	GENERATED_BODY()
+
+public:
+	UIceTileBatchComponent(const FObjectInitializer& ObjectInitializer);
+
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	// 월드 위치에 타일 1개 추가(AIceTileActor 스폰 위치와 같은 기준). 반환값은 인스턴스 인덱스
+	int32 AddTile(TSubclassOf<AIceTileActor> TileClass, const FVector& Location, const FRotator& Rotation);
+
+	// 재도전/클리어 시 전부 제거
+	void ClearTiles();
+
+	int32 GetNumTiles() const { return TileFootprints.Num(); }
+
+protected:
+	// 인스턴스 메시 기준 타일 영역 반 크기(0이면 타일 클래스 Box에서 가져옴)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="IceTile")
+	FVector TileExtent = FVector::ZeroVector;
+
+	// 타일 원점 -> 메시/영역 중심 오프셋(타일 클래스에서 가져오면 덮어씀)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="IceTile")
+	FTransform TileMeshOffset = FTransform::Identity;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="IceTile")
+	FVector TileExtentOffset = FVector::ZeroVector;
+
+private:
+	// 인스턴스 인덱스와 같은 순서
+	TArray<FIceTileFootprint> TileFootprints;
+
+	bool bConfiguredFromClass = false;
+
+	void ConfigureFromTileClass(TSubclassOf<AIceTileActor> TileClass);
+
+	// 메시 단순 충돌이 타일 Box 한 개와 같은지 확인(인스턴스 바디가 타일 영역과 어긋나면 경고)
+	void ValidateCollisionShape() const;
+};
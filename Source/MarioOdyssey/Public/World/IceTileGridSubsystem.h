@@ -0,0 +1,73 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "IceTileGridSubsystem.generated.h"
+
+class ULevel;
+class UIceTileBatchComponent;
+
+// 격자에 기록한 얼음 영역 1개(등록한 쪽이 보관했다가 같은 값으로 해제)
+struct FIceTileFootprint
+{
+	FIntPoint MinCell = FIntPoint::ZeroValue;
+	FIntPoint MaxCell = FIntPoint::ZeroValue;
+	float TopZ = 0.f;
+	bool bRegistered = false;
+};
+
+/**
+ * 얼음 타일 2D 점유 격자.
+ * - 타일이 활성화/스폰될 때 XY 영역을 셀에 기록하고, 풀 회수/파괴 시 지운다(겹친 타일을 위해 셀마다 개수 유지)
+ * - 레벨에 배치된 "IceTile" 태그 액터는 월드 시작 시 1회 기록
+ * - 아레나의 UIceTileBatchComponent가 등록되어 있으면 샤드는 타일 액터 대신 여기에 인스턴스를 추가
+ * 조회는 셀 몇 개 확인이 전부(오버랩/트레이스 없음). 보스 주먹 스턴 판정과 마리오 얼음 바닥 마찰이 같이 쓴다.
+ */
+UCLASS()
+class MARIOODYSSEY_API UIceTileGridSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UIceTileGridSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Deinitialize() override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	// 영역 기록(이미 기록된 Footprint면 지우고 다시 기록)
+	void AddFootprint(const FBox& Bounds, FIceTileFootprint& InOutFootprint);
+	void RemoveFootprint(FIceTileFootprint& InOutFootprint);
+
+	// Location 주변 Radius 안에 얼음 셀이 있고, 그 셀 윗면이 Location.Z와 ZTolerance 이내인가
+	bool IsIceAt(const FVector& Location, float Radius = 0.f, float ZTolerance = 100.f) const;
+
+	int32 GetNumOccupiedCells() const { return NumOccupiedCells; }
+
+	// 현재 전투 아레나의 타일 인스턴스 묶음(없으면 nullptr -> 타일 풀/스폰 사용)
+	void SetTileBatch(UIceTileBatchComponent* InBatch) { TileBatch = InBatch; }
+	UIceTileBatchComponent* GetTileBatch() const { return TileBatch.Get(); }
+
+private:
+	static constexpr float CellSize = 50.f;
+	static constexpr int32 ChunkDim = 32; // 청크 한 변 셀 수
+
+	struct FChunk
+	{
+		uint16 Counts[ChunkDim * ChunkDim] = {};
+		float TopZ[ChunkDim * ChunkDim] = {};
+	};
+
+	// 아레나 밖 영역까지 대비해 청크 단위로만 할당
+	TMap<FIntPoint, TUniquePtr<FChunk>> Chunks;
+
+	// 타일이 2개 이상 겹친 셀의 타일별 윗면(일부 제거 시 TopZ를 남은 타일 기준으로 다시 계산)
+	TMap<FIntPoint, TArray<float, TInlineAllocator<4>>> StackedTopZ;
+	int32 NumOccupiedCells = 0;
+
+	TWeakObjectPtr<UIceTileBatchComponent> TileBatch;
+
+	FIntPoint ToCell(const FVector& Location) const;
+	static FIntPoint ToChunk(const FIntPoint& Cell, int32& OutIndex);
+
+	void IndexTaggedActors(ULevel* Level);
+};
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "LedgeEdgeSubsystem.generated.h"
+
+class ULevel;
+class UStaticMesh;
+class UStaticMeshComponent;
+
+// 잡을 수 있는 모서리 1개(월드 공간 수평 선분)
+struct FLedgeEdge
+{
+	FVector3f Start = FVector3f::ZeroVector;
+	FVector3f End = FVector3f::ZeroVector;
+	FVector3f Normal = FVector3f::ZeroVector; // 윗면 바깥(매달리는 쪽) 수평 노멀
+
+	// 제거된 컴포넌트의 빈 슬롯(길이 0)이면 false
+	bool IsValid() const { return Start != End; }
+};
+
+struct FLedgeGrabQuery
+{
+	FVector Hand = FVector::ZeroVector;   // 손 위치(마리오 LedgeDetector)
+	FVector Facing = FVector::ZeroVector; // 수평 정면
+	float Reach = 30.f;                   // 손 ~ 모서리 수평 거리 상한
+	float Below = 25.f;                   // 손보다 이만큼 아래까지
+	float Above = 25.f;                   // 손보다 이만큼 위까지
+	float EndMargin = 20.f;               // 모서리 양 끝 잡기 금지 구간
+	float MinFacingDot = 0.5f;            // 정면 · (-Normal) 하한
+};
+
+struct FLedgeGrabResult
+{
+	FVector Origin = FVector::ZeroVector;  // 모서리 시작점
+	FVector Tangent = FVector::ZeroVector; // 시작 -> 끝 단위벡터
+	FVector Normal = FVector::ZeroVector;
+	float Length = 0.f;
+	float Param = 0.f; // 시작점부터 잡는 위치까지 거리
+
+	FVector GetPoint() const { return Origin + Tangent * Param; }
+};
+
+/**
+ * 정적 메시 윗면 모서리 캐시.
+ * - 메시별 로컬 모서리는 처음 쓰일 때 심플 콜리전(박스/컨벡스 AABB, 없으면 메시 바운드)에서 1회 추출
+ * - 레벨 시작/스트리밍 추가 시 Static 모빌리티 + Pawn 블록 컴포넌트를 월드 공간으로 펼쳐 XY 격자에 넣는다
+ * - 액터가 파괴되면 그 컴포넌트의 모서리만 격자에서 빼고, 스트리밍 해제 시에는 남은 레벨로 재구성
+ * 런타임 탐지는 손 주변 셀 후보만 확인(트레이스 없음). 실제 윗면 확인 트레이스 1회는 호출자가 한다.
+ */
+UCLASS()
+class MARIOODYSSEY_API ULedgeEdgeSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static ULedgeEdgeSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	// 조건을 만족하는 가장 가까운 모서리(손 기준 수평 거리)
+	bool FindGrabEdge(const FLedgeGrabQuery& Query, FLedgeGrabResult& OutResult) const;
+
+	// 중복 등록 안전. Static 모빌리티가 아니거나 Pawn을 막지 않으면 무시
+	void RegisterComponent(UStaticMeshComponent* Component);
+
+	// 등록된 컴포넌트의 모서리를 격자에서 뺀다. 미등록이면 무시
+	void UnregisterComponent(UStaticMeshComponent* Component);
+
+	// 제거된 슬롯(IsValid() == false)이 섞여 있다
+	const TArray<FLedgeEdge>& GetEdges() const { return Edges; }
+
+private:
+	struct FLocalEdge
+	{
+		FVector Start;
+		FVector End;
+		FVector FaceCenter; // 윗면 중심(바깥 방향 계산용)
+		FVector Up; // 모서리가 속한 면의 위쪽(월드에서 위를 향할 때만 사용)
+	};
+
+	static constexpr float CellSize = 512.f;
+
+	// 이보다 많은 셀을 덮는 긴 모서리는 Oversized로 분류(항상 후보)
+	static constexpr int32 MaxCellsPerEdge = 64;
+
+	TArray<FLedgeEdge> Edges;
+	TMap<FIntPoint, TArray<int32>> Cells;
+	TArray<int32> OversizedEdges;
+	TArray<int32> FreeEdges; // 제거된 모서리 슬롯(AddEdge가 재사용)
+
+	TMap<TObjectKey<UStaticMesh>, TArray<FLocalEdge>> LocalEdgesByMesh;
+	TMap<TObjectKey<UStaticMeshComponent>, TArray<int32>> EdgesByComponent;
+
+	FDelegateHandle ActorDestroyedHandle;
+	FDelegateHandle LevelAddedHandle;
+	FDelegateHandle LevelRemovedHandle;
+
+	const TArray<FLocalEdge>& GetLocalEdges(UStaticMesh* Mesh);
+	void AddWorldEdges(const TArray<FLocalEdge>& LocalEdges, const FTransform& Transform, TArray<int32>& OutEdgeIndices);
+	int32 AddEdge(const FLedgeEdge& Edge);
+	void RemoveEdge(int32 EdgeIndex);
+	void GetCellRange(const FLedgeEdge& Edge, FIntPoint& OutMin, FIntPoint& OutMax) const;
+
+	void IndexLevel(ULevel* Level);
+	void RebuildAll(const ULevel* ExcludedLevel);
+
+	FIntPoint ToCell(const FVector& Location) const;
+
+	void HandleActorDestroyed(AActor* Actor);
+	void HandleLevelAddedToWorld(ULevel* Level, UWorld* InWorld);
+	void HandleLevelRemovedFromWorld(ULevel* Level, UWorld* InWorld);
+};
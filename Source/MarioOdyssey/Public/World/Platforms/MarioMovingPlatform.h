@@ -89,6 +89,9 @@ private:
 
 	float MoveElapsed = 0.f;
 
+	// 랜덤 시작 위상(결정적 모드에서는 시드 고정)
+	FRandomStream PhaseRandom;
+
 	FVector StartLocation = FVector::ZeroVector;
 	FRotator StartRotation = FRotator::ZeroRotator;
 	FVector OffsetWorld = FVector::ZeroVector;
@@ -74,7 +74,7 @@ protected:
 	UPROPERTY(EditInstanceOnly, Category="Start|Cutscene")
 	TObjectPtr<ALevelSequenceActor> IntroSequenceActor = nullptr;
 
-	/** IntroSequenceActor를 못 찾을 때, 이 Tag로 월드에서 검색 */
+	/** IntroSequenceActor가 비어 있을 때 이 Tag가 붙은 LevelSequenceActor 사용(액터 레지스트리 태그 인덱스 조회) */
 	UPROPERTY(EditAnywhere, Category="Start|Cutscene")
 	FName IntroSequenceTag = FName(TEXT("MapIntro"));
 